@@ -0,0 +1,126 @@
+#include "BenchRecorder.h"
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+using namespace test;
+
+namespace
+{
+string jsonEscape(string const& _str)
+{
+    string escaped;
+    for (char const c : _str)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+struct Stats
+{
+    uint64_t min = 0;
+    uint64_t max = 0;
+    uint64_t median = 0;
+    uint64_t mean = 0;
+    uint64_t total = 0;
+};
+
+Stats calculateStats(vector<uint64_t> _samples)
+{
+    Stats stats;
+    if (_samples.empty())
+        return stats;
+    sort(_samples.begin(), _samples.end());
+    stats.min = _samples.front();
+    stats.max = _samples.back();
+    stats.median = _samples.at(_samples.size() / 2);
+    for (auto const& sample : _samples)
+        stats.total += sample;
+    stats.mean = stats.total / _samples.size();
+    return stats;
+}
+}  // namespace
+
+namespace test::bench
+{
+BenchRecorder& BenchRecorder::get()
+{
+    static BenchRecorder instance;
+    return instance;
+}
+
+void BenchRecorder::measure(string const& _name, size_t _iterations, function<void()> const& _body, size_t _items)
+{
+    size_t const iterations = max<size_t>(1, (size_t)llround(_iterations * m_scale));
+    _body();
+
+    Result result;
+    result.name = _name;
+    result.items = _items;
+    result.samplesNs.reserve(iterations);
+    for (size_t i = 0; i < iterations; i++)
+    {
+        auto const start = chrono::steady_clock::now();
+        _body();
+        auto const elapsed = chrono::steady_clock::now() - start;
+        result.samplesNs.emplace_back(chrono::duration_cast<chrono::nanoseconds>(elapsed).count());
+    }
+    m_results.emplace_back(std::move(result));
+}
+
+string BenchRecorder::asJson() const
+{
+    std::ostringstream out;
+    out << "{\n";
+    out << "    \"retesteth\" : \"" << jsonEscape(test::prepareVersionString()) << "\",\n";
+    out << "    \"scale\" : " << m_scale << ",\n";
+    out << "    \"benchmarks\" : {";
+    for (size_t i = 0; i < m_results.size(); i++)
+    {
+        Result const& result = m_results.at(i);
+        Stats const stats = calculateStats(result.samplesNs);
+        out << (i == 0 ? "\n" : ",\n");
+        out << "        \"" << jsonEscape(result.name) << "\" : {\n";
+        out << "            \"iterations\" : " << result.samplesNs.size() << ",\n";
+        out << "            \"items\" : " << result.items << ",\n";
+        out << "            \"min_ns\" : " << stats.min << ",\n";
+        out << "            \"median_ns\" : " << stats.median << ",\n";
+        out << "            \"mean_ns\" : " << stats.mean << ",\n";
+        out << "            \"max_ns\" : " << stats.max << ",\n";
+        out << "            \"total_ns\" : " << stats.total << "\n";
+        out << "        }";
+    }
+    out << "\n    }\n}\n";
+    return out.str();
+}
+
+void BenchRecorder::printSummary() const
+{
+    std::cout << std::left << setw(50) << "benchmark" << std::right << setw(12) << "iterations" << setw(16)
+              << "median us" << setw(16) << "us/item" << "\n";
+    for (auto const& result : m_results)
+    {
+        Stats const stats = calculateStats(result.samplesNs);
+        std::cout << std::left << setw(50) << result.name << std::right << setw(12) << result.samplesNs.size()
+                  << setw(16) << fixed << setprecision(2) << stats.median / 1000.0 << setw(16)
+                  << stats.median / 1000.0 / max<size_t>(1, result.items) << "\n";
+    }
+}
+
+BenchFixture::BenchFixture()
+{
+    auto& dynOpt = Options::getDynamicOptions();
+    if (!dynOpt.currentConfigIsSet())
+        dynOpt.setCurrentConfig(dynOpt.getClientConfigs().at(0));
+}
+
+}  // namespace test::bench
@@ -0,0 +1,53 @@
+#pragma once
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <boost/filesystem/path.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace test::bench
+{
+// Timings of the benchmarks run by retesteth-bench
+class BenchRecorder
+{
+public:
+    static BenchRecorder& get();
+
+    // Run _body once to warm up, then _iterations times (multiplied by --scale) and record each run under _name
+    // _items is the number of elements one run processes, so the results can be compared per element
+    void measure(std::string const& _name, size_t _iterations, std::function<void()> const& _body, size_t _items = 1);
+
+    void setScale(double _scale) { m_scale = _scale; }
+
+    // Results as json: {"retesteth": version, "scale": x, "benchmarks": {name: {iterations, min_ns, ...}}}
+    std::string asJson() const;
+    void printSummary() const;
+
+private:
+    BenchRecorder() {}
+    struct Result
+    {
+        std::string name;
+        size_t items;
+        std::vector<uint64_t> samplesNs;
+    };
+    std::vector<Result> m_results;
+    double m_scale = 1;
+};
+
+// Keep the compiler from optimizing away the value computed in a benchmark body
+template <class T>
+inline void doNotOptimize(T const& _value)
+{
+    asm volatile("" : : "g"(&_value) : "memory");
+}
+
+// Select the client config of the bench datadir for the benchmarks
+class BenchFixture : public TestOutputHelperFixture
+{
+public:
+    BenchFixture();
+};
+
+}  // namespace test::bench
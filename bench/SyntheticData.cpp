@@ -0,0 +1,177 @@
+#include "SyntheticData.h"
+#include <libdevcore/CommonData.h>
+#include <libdevcore/FixedHash.h>
+#include <retesteth/helpers/TestHelper.h>
+
+using namespace std;
+using namespace dev;
+using namespace dataobject;
+
+namespace
+{
+string const c_sender = "0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b";
+string const c_senderKey = "0x45a915e4d060149eb4365960e6a7a45f334393093061116b197e3240065ff2d8";
+string const c_contract = "0x095e7baea6a6c7c4c2dfeb977efac326af552d87";
+string const c_coinbase = "0x2adc25665018aa1fe0e6bc666dac8fc2697ff9ba";
+
+// [[0]] (ADD 1 1)
+string const c_code = "0x600160010160005500";
+
+spDataObject makeAccount(string const& _balance, string const& _code, size_t _slots, size_t _seed)
+{
+    spDataObject account;
+    (*account)["balance"] = _balance;
+    (*account)["code"] = _code;
+    (*account)["nonce"] = "0x00";
+    spDataObject storage(new DataObject(DataType::Object));
+    for (size_t i = 0; i < _slots; i++)
+        (*storage)[toCompactHexPrefixed(i, 1)] = toCompactHexPrefixed(u256(_seed) * 1000 + i + 1, 1);
+    (*account).addSubObject("storage", storage);
+    return account;
+}
+
+spDataObject makeStringArray(vector<string> const& _values)
+{
+    spDataObject array(new DataObject(DataType::Array));
+    for (auto const& value : _values)
+        (*array).addArrayObject(spDataObject(new DataObject(value)));
+    return array;
+}
+
+spDataObject makeNetworks()
+{
+    return makeStringArray({">=Shanghai"});
+}
+}  // namespace
+
+namespace test::bench
+{
+spDataObject makeAlloc(size_t _accounts, size_t _slots)
+{
+    spDataObject alloc(new DataObject(DataType::Object));
+    for (size_t i = 0; i < _accounts; i++)
+    {
+        string const address = toHexPrefixed(h160(u160(0x1000 + i)));
+        (*alloc).addSubObject(address, makeAccount("0x0de0b6b3a7640000", i % 2 ? c_code : "0x", _slots, i));
+    }
+    return alloc;
+}
+
+spDataObject makeStateTestFiller(string const& _name, size_t _accounts)
+{
+    spDataObject test;
+    (*test)["_info"]["comment"] = "retesteth-bench synthetic state test";
+
+    DataObject& env = (*test)["env"];
+    env["currentCoinbase"] = c_coinbase;
+    env["currentDifficulty"] = "0x020000";
+    env["currentGasLimit"] = "0xff112233445566";
+    env["currentNumber"] = "1";
+    env["currentTimestamp"] = "1000";
+    env["previousHash"] = "0x5e20a0453cecd065ea59c37ac63e079ee08998b6045136a8ce6635c7912ec0b6";
+
+    spDataObject pre = makeAlloc(_accounts, 16);
+    (*pre).addSubObject(c_contract, makeAccount("0x0de0b6b3a7640000", c_code, 1, 0));
+    (*pre).addSubObject(c_sender, makeAccount("0x0de0b6b3a7640000", "0x", 0, 0));
+    (*pre).addSubObject(c_coinbase, makeAccount("0x00", "0x", 0, 0));
+    (*test).addSubObject("pre", pre);
+
+    DataObject& tr = (*test)["transaction"];
+    tr.addSubObject("data", makeStringArray({":raw 0x01", ":raw 0x02"}));
+    tr.addSubObject("gasLimit", makeStringArray({"400000"}));
+    tr["gasPrice"] = "10";
+    tr["nonce"] = "0";
+    tr["secretKey"] = c_senderKey;
+    tr["to"] = c_contract;
+    tr.addSubObject("value", makeStringArray({"0", "100000"}));
+
+    spDataObject expect;
+    (*expect)["indexes"]["data"] = -1;
+    (*expect)["indexes"]["gas"] = -1;
+    (*expect)["indexes"]["value"] = -1;
+    (*expect).addSubObject("network", makeNetworks());
+    (*expect)["result"][c_sender]["nonce"] = "1";
+    (*expect)["result"][c_contract]["storage"]["0x00"] = "0x01";
+    (*test)["expect"].addArrayObject(expect);
+
+    spDataObject filler;
+    (*filler).addSubObject(_name, test);
+    return filler;
+}
+
+spDataObject makeBlockchainTestFiller(string const& _name, size_t _blocks)
+{
+    spDataObject test;
+    (*test)["_info"]["comment"] = "retesteth-bench synthetic blockchain test";
+
+    DataObject& genesis = (*test)["genesisBlockHeader"];
+    genesis["bloom"] = toHexPrefixed(h2048());
+    genesis["coinbase"] = c_coinbase;
+    genesis["difficulty"] = "131072";
+    genesis["extraData"] = "0x42";
+    genesis["gasLimit"] = "0x7fffffffffffffff";
+    genesis["gasUsed"] = "0";
+    genesis["mixHash"] = "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421";
+    genesis["nonce"] = "0x0102030405060708";
+    genesis["number"] = "0";
+    genesis["parentHash"] = toHexPrefixed(h256());
+    genesis["receiptTrie"] = "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421";
+    genesis["stateRoot"] = "0xf99eb1626cfa6db435c0836235942d7ccaa935f1ae247d3f1c21e495685f903a";
+    genesis["timestamp"] = "0x03b6";
+    genesis["transactionsTrie"] = "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421";
+    genesis["uncleHash"] = "0x1dcc4de8dec75d7aab85b567b6ccd41ad312451b948a7413f0a142fd40d49347";
+    (*test)["sealEngine"] = "NoProof";
+
+    spDataObject pre = makeAlloc(8, 16);
+    (*pre).addSubObject(c_contract, makeAccount("0x0de0b6b3a7640000", c_code, 1, 0));
+    (*pre).addSubObject(c_sender, makeAccount("0x0de0b6b3a7640000", "0x", 0, 0));
+    (*test).addSubObject("pre", pre);
+
+    size_t nonce = 0;
+    for (size_t i = 0; i < _blocks; i++)
+    {
+        spDataObject block;
+        (*block).atKeyPointer("transactions") = spDataObject(new DataObject(DataType::Array));
+        for (size_t k = 0; k < 2; k++)
+        {
+            spDataObject tr;
+            (*tr)["data"] = ":raw " + toCompactHexPrefixed(nonce + 1, 32);
+            (*tr)["gasLimit"] = "400000";
+            (*tr)["gasPrice"] = "0xa0";
+            (*tr)["nonce"] = toCompactHexPrefixed(nonce++, 1);
+            (*tr)["to"] = c_contract;
+            (*tr)["secretKey"] = c_senderKey;
+            (*tr)["value"] = "0x00";
+            (*block)["transactions"].addArrayObject(tr);
+        }
+        (*block).atKeyPointer("uncleHeaders") = spDataObject(new DataObject(DataType::Array));
+        (*test)["blocks"].addArrayObject(block);
+    }
+
+    spDataObject expect;
+    (*expect).addSubObject("network", makeNetworks());
+    (*expect)["result"][c_sender]["nonce"] = test::fto_string(nonce);
+    (*expect)["result"][c_contract]["storage"]["0x00"] = "0x01";
+    (*test)["expect"].addArrayObject(expect);
+
+    spDataObject filler;
+    (*filler).addSubObject(_name, test);
+    return filler;
+}
+
+void setFilledInfo(DataObject& _filled)
+{
+    for (auto& test : _filled.getSubObjectsUnsafe())
+    {
+        DataObject& info = test.getContent()["_info"];
+        info["filling-rpc-server"] = "retesteth-bench mock t8n";
+        info["filling-tool-version"] = test::prepareVersionString();
+        info["generatedTestHash"] = toHex(h256());
+        info["lllcversion"] = "none";
+        info["solidity"] = "none";
+        info["source"] = "retesteth-bench";
+        info["sourceHash"] = toHex(h256());
+    }
+}
+
+}  // namespace test::bench
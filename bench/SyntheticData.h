@@ -0,0 +1,20 @@
+#pragma once
+#include <libdataobj/DataObject.h>
+
+namespace test::bench
+{
+// Deterministic inputs of the benchmarks. Codes are raw bytecode so no compiler is needed
+
+// {"0xaddress" : {"balance", "code", "nonce", "storage"}} with _accounts accounts of _slots storage records each
+dataobject::spDataObject makeAlloc(size_t _accounts, size_t _slots);
+
+// State test filler `_name` with a prestate of _accounts accounts and 2x2 transaction vectors
+dataobject::spDataObject makeStateTestFiller(std::string const& _name, size_t _accounts);
+
+// Blockchain test filler `_name` with _blocks blocks of two transactions each
+dataobject::spDataObject makeBlockchainTestFiller(std::string const& _name, size_t _blocks);
+
+// Set the _info fields that retesteth adds when writing filled tests to a file
+void setFilledInfo(dataobject::DataObject& _filled);
+
+}  // namespace test::bench
@@ -0,0 +1,121 @@
+#define BOOST_TEST_MODULE RetestethBench
+#define BOOST_TEST_NO_MAIN
+#include "BenchRecorder.h"
+#include <libdevcore/CommonIO.h>
+#include <retesteth/configs/Options.h>
+#include <retesteth/mainHelper.h>
+#include <boost/filesystem.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <iostream>
+
+using namespace std;
+using namespace boost::unit_test;
+namespace fs = boost::filesystem;
+
+namespace
+{
+string const c_benchClient = "benchtool";
+
+// The in-process mock t8n. Difficulty and basefee are calculated by retesteth
+string const c_benchToolConfig = R"({
+    "name" : "retesteth-bench mock t8n",
+    "socketType" : "mock-tool",
+    "socketAddress" : "mock",
+    "initializeTime" : "0",
+    "checkDifficulty" : false,
+    "calculateDifficulty" : true,
+    "checkBasefee" : false,
+    "calculateBasefee" : true,
+    "checkLogsHash" : true,
+    "support1559" : true,
+    "supportBigint" : true,
+    "transactionsAsJson" : true,
+    "tmpDir" : "TMPDIR",
+    "defaultChainID" : 1,
+    "forks" : [
+        "Frontier",
+        "Homestead",
+        "EIP150",
+        "EIP158",
+        "Byzantium",
+        "Constantinople",
+        "ConstantinopleFix",
+        "Istanbul",
+        "Berlin",
+        "London",
+        "Merge",
+        "Shanghai",
+        "Cancun"
+    ],
+    "additionalForks" : [
+    ],
+    "exceptions" : {
+    }
+})";
+
+// Datadir with the default configs and the `benchtool` client on the mock t8n
+fs::path prepareDataDir(fs::path const& _workDir)
+{
+    fs::path const dataDir = _workDir / "datadir";
+    fs::path const tmpDir = _workDir / "tmp";
+    fs::create_directories(tmpDir);
+    retesteth::options::deployFirstRunConfigs(dataDir);
+
+    string config = c_benchToolConfig;
+    config.replace(config.find("TMPDIR"), 6, tmpDir.string());
+    dev::writeFile(dataDir / c_benchClient / "config", config);
+    return dataDir;
+}
+}  // namespace
+
+// retesteth-bench [--out <file.json>] [--scale <x>] [-t RetestethBench/<Micro|EndToEnd>] [-- <retesteth options>]
+int main(int argc, const char* argv[])
+{
+    string outFile;
+    bool suiteSelected = false;
+    bool hasRetestethOptions = false;
+    vector<string> args = {argv[0]};
+    for (int i = 1; i < argc; i++)
+    {
+        string const arg = argv[i];
+        if (arg == "--out" && i + 1 < argc && !hasRetestethOptions)
+            outFile = argv[++i];
+        else if (arg == "--scale" && i + 1 < argc && !hasRetestethOptions)
+            test::bench::BenchRecorder::get().setScale(atof(argv[++i]));
+        else
+        {
+            suiteSelected = suiteSelected || (arg == "-t" && !hasRetestethOptions);
+            hasRetestethOptions = hasRetestethOptions || arg == "--";
+            args.emplace_back(arg);
+        }
+    }
+
+    fs::path const workDir = fs::temp_directory_path() / fs::unique_path("retesteth-bench-%%%%-%%%%");
+    fs::path const dataDir = prepareDataDir(workDir);
+    if (!suiteSelected)
+        args.insert(args.begin() + 1, {"-t", "RetestethBench"});
+    if (!hasRetestethOptions)
+        args.emplace_back("--");
+    for (auto const& arg : vector<string>{"--datadir", dataDir.string(), "--clients", c_benchClient, "--filltests"})
+        args.emplace_back(arg);
+
+    vector<const char*> argv2;
+    for (auto const& arg : args)
+        argv2.emplace_back(arg.c_str());
+    int argc2 = argv2.size();
+
+    test::main::initializeOptions(argc2, argv2.data());
+    auto fakeInit = [](int, char* []) -> boost::unit_test::test_suite* { return nullptr; };
+    int const result = unit_test_main(fakeInit, argc2, const_cast<char**>(argv2.data()));
+
+    test::bench::BenchRecorder::get().printSummary();
+    string const json = test::bench::BenchRecorder::get().asJson();
+    if (outFile.empty())
+        std::cout << json;
+    else
+        dev::writeFile(outFile, json);
+
+    boost::system::error_code ec;
+    fs::remove_all(workDir, ec);
+    return result;
+}
@@ -0,0 +1,237 @@
+#include "BenchRecorder.h"
+#include "SyntheticData.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/RLP.h>
+#include <libdevcore/SHA3.h>
+#include <retesteth/session/ToolBackend/ToolChainHelper.h>
+#include <retesteth/testStructures/types/Ethereum/Blocks/BlockHeaderReader.h>
+#include <retesteth/testStructures/types/Ethereum/State.h>
+#include <retesteth/testStructures/types/Ethereum/StateIncomplete.h>
+#include <retesteth/testStructures/types/Ethereum/Storage.h>
+#include <retesteth/testStructures/types/Ethereum/TrieRoots.h>
+#include <retesteth/testStructures/types/Ethereum/Transactions/TransactionReader.h>
+#include <retesteth/testStructures/types/RPC/VMTraceLog.h>
+#include <retesteth/testSuites/Common.h>
+#include <retesteth/unitTests/testSuites.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace dev;
+using namespace test;
+using namespace test::bench;
+using namespace test::teststruct;
+using namespace dataobject;
+
+namespace
+{
+vector<string> const& samples()
+{
+    static vector<string> const c_samples = {test::unittests::c_sampleStateTestFiller,
+        test::unittests::c_sampleStateTestFilled, test::unittests::c_sampleBlockchainTestFiller,
+        test::unittests::c_sampleBlockchainTestFilled};
+    return c_samples;
+}
+
+spDataObject makeTransactionData(size_t _nonce)
+{
+    spDataObject tr;
+    (*tr)["data"] = "0x00112233";
+    (*tr)["gasLimit"] = "0x112233";
+    (*tr)["gasPrice"] = "0x0a";
+    (*tr)["nonce"] = toCompactHexPrefixed(_nonce, 1);
+    (*tr)["secretKey"] = "0x45a915e4d060149eb4365960e6a7a45f334393093061116b197e3240065ff2d8";
+    (*tr)["to"] = "0x095e7baea6a6c7c4c2dfeb977efac326af552d87";
+    (*tr)["value"] = "0x11";
+    return tr;
+}
+
+spDataObject makeHeaderData()
+{
+    spDataObject header;
+    (*header)["baseFeePerGas"] = "0x0a";
+    (*header)["bloom"] = toHexPrefixed(bytes(256, 0));
+    (*header)["coinbase"] = "0x8888f1f195afa192cfee860698584c030f4c9db1";
+    (*header)["difficulty"] = "0x020000";
+    (*header)["extraData"] = "0x42";
+    (*header)["gasLimit"] = "0x7fffffffffffffff";
+    (*header)["gasUsed"] = "0x5208";
+    (*header)["hash"] = toHexPrefixed(h256(1));
+    (*header)["mixHash"] = toHexPrefixed(h256(2));
+    (*header)["nonce"] = "0x0000000000000000";
+    (*header)["number"] = "0x01";
+    (*header)["parentHash"] = toHexPrefixed(h256(3));
+    (*header)["receiptTrie"] = toHexPrefixed(h256(4));
+    (*header)["stateRoot"] = toHexPrefixed(h256(5));
+    (*header)["timestamp"] = "0x54c99069";
+    (*header)["transactionsTrie"] = toHexPrefixed(h256(6));
+    (*header)["uncleHash"] = toHexPrefixed(h256(7));
+    return header;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(RetestethBench, BenchFixture)
+BOOST_AUTO_TEST_SUITE(Micro)
+
+BOOST_AUTO_TEST_CASE(jsonParse_samples)
+{
+    BenchRecorder::get().measure("Micro/jsonParse_samples", 500, []() {
+        for (auto const& sample : samples())
+            doNotOptimize(ConvertJsoncppStringToData(sample));
+    }, samples().size());
+}
+
+BOOST_AUTO_TEST_CASE(asJson_samples)
+{
+    vector<spDataObject> parsed;
+    for (auto const& sample : samples())
+        parsed.emplace_back(ConvertJsoncppStringToData(sample));
+    BenchRecorder::get().measure("Micro/asJson_samples", 500, [&parsed]() {
+        for (auto const& data : parsed)
+            doNotOptimize(data->asJson());
+    }, parsed.size());
+}
+
+BOOST_AUTO_TEST_CASE(restoreFullState)
+{
+    spDataObject const alloc = makeAlloc(200, 16);
+    BenchRecorder::get().measure("Micro/restoreFullState_200acc", 50, [&alloc]() {
+        spDataObject toolState = alloc->copy();
+        doNotOptimize(toolimpl::restoreFullState(toolState.getContent()));
+    }, 200);
+}
+
+BOOST_AUTO_TEST_CASE(storageConstruct)
+{
+    spDataObject storage(new DataObject(DataType::Object));
+    for (size_t i = 0; i < 1024; i++)
+        (*storage)[toCompactHexPrefixed(u256(i) * 7919, 1)] = toCompactHexPrefixed(u256(i) + 1, 1);
+    BenchRecorder::get().measure("Micro/storageConstruct_1024", 200, [&storage]() {
+        Storage const constructed(storage.getCContent());
+        doNotOptimize(constructed);
+    }, 1024);
+}
+
+BOOST_AUTO_TEST_CASE(transactionSignRLP)
+{
+    size_t nonce = 0;
+    BenchRecorder::get().measure("Micro/transactionSign_RLP", 200, [&nonce]() {
+        spDataObject data = makeTransactionData(nonce++);
+        spTransaction const tr = readTransaction(dataobject::move(data));
+        doNotOptimize(tr->asRLPStream().out());
+    });
+}
+
+BOOST_AUTO_TEST_CASE(transactionFromRLP)
+{
+    spDataObject data = makeTransactionData(1);
+    spTransaction const tr = readTransaction(dataobject::move(data));
+    BYTES const rlp(tr->getRawBytes());
+    BenchRecorder::get().measure("Micro/transactionFromRLP", 200, [&rlp]() {
+        spTransaction const decoded = readTransaction(rlp);
+        doNotOptimize(decoded->hash());
+    });
+}
+
+BOOST_AUTO_TEST_CASE(blockHeaderRLP)
+{
+    spBlockHeader const header = readBlockHeader(makeHeaderData());
+    bytes const rlp = header->asRLPStream().out();
+    BenchRecorder::get().measure("Micro/blockHeader_toRLP", 2000, [&header]() {
+        doNotOptimize(header->asRLPStream().out());
+    });
+    BenchRecorder::get().measure("Micro/blockHeader_fromRLP", 2000, [&rlp]() {
+        spBlockHeader const decoded = readBlockHeader(RLP(rlp));
+        doNotOptimize(decoded->hash());
+    });
+}
+
+BOOST_AUTO_TEST_CASE(keccak)
+{
+    bytes const data(4096, 0x5b);
+    BenchRecorder::get().measure("Micro/keccak_4k", 2000, [&data]() {
+        doNotOptimize(sha3(data));
+    });
+}
+
+BOOST_AUTO_TEST_CASE(valueFHConstruct)
+{
+    vector<string> values;
+    vector<string> hashes;
+    for (size_t i = 0; i < 256; i++)
+    {
+        values.emplace_back(toCompactHexPrefixed(u256(i) << (i % 200), 1));
+        hashes.emplace_back(toHexPrefixed(sha3(toCompactHexPrefixed(i, 1))));
+    }
+    BenchRecorder::get().measure("Micro/VALUE_FH32_construct", 500, [&values, &hashes]() {
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            doNotOptimize(VALUE(values[i]));
+            doNotOptimize(FH32(hashes[i]));
+        }
+    }, values.size() * 2);
+}
+
+BOOST_AUTO_TEST_CASE(compareStates)
+{
+    spDataObject const alloc = makeAlloc(200, 16);
+    spDataObject postData = alloc->copy();
+    State const post(dataobject::move(postData));
+    spDataObject expectData = alloc->copy();
+    for (auto& account : expectData.getContent().getSubObjectsUnsafe())
+        account.getContent().removeKey("code");
+    StateIncomplete const expect(dataobject::move(expectData));
+    BenchRecorder::get().measure("Micro/compareStates_200acc", 100, [&expect, &post]() {
+        test::compareStates(expect, post);
+    }, 200);
+}
+
+BOOST_AUTO_TEST_CASE(stateRoot)
+{
+    spDataObject alloc = makeAlloc(200, 16);
+    State const state(dataobject::move(alloc));
+    BenchRecorder::get().measure("Micro/stateRoot_200acc", 100, [&state]() {
+        doNotOptimize(teststruct::stateRoot(state));
+    }, 200);
+}
+
+BOOST_AUTO_TEST_CASE(hexCodec)
+{
+    // Init code sized blob and a large calldata blob
+    for (size_t const size : {size_t(49152), size_t(1) << 20})
+    {
+        bytes data(size);
+        for (size_t i = 0; i < size; i++)
+            data[i] = (uint8_t)(i * 131);
+        string const hex = toHexPrefixed(data);
+        string const kb = to_string(size / 1024) + "k";
+        BenchRecorder::get().measure("Micro/toHex_" + kb, 50, [&data]() {
+            doNotOptimize(toHex(data));
+        });
+        BenchRecorder::get().measure("Micro/fromHex_" + kb, 50, [&hex]() {
+            doNotOptimize(fromHex(hex));
+        });
+        BenchRecorder::get().measure("Micro/BYTES_" + kb, 50, [&hex]() {
+            doNotOptimize(BYTES(hex).asString());
+        });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vmtrace_parse)
+{
+    // EIP-3155 trace of a long running transaction as the t8n tools write it
+    size_t const c_lines = 200000;
+    string trace;
+    for (size_t i = 0; i < c_lines; i++)
+        trace += R"({"pc":)" + to_string(i) + R"(,"op":96,"gas":"0x5c878","gasCost":"0x3","memory":"0x","memSize":0,"stack":["0x)" +
+                 toCompactHex(i + 1) + R"(","0xff"],"returnStack":[],"returnData":null,"depth":1,"refund":0,"opName":"PUSH1"})" + "\n";
+    trace += R"({"output":"","gasUsed":"0x5208","time":1434,"error":""})" + string("\n");
+
+    BenchRecorder::get().measure("Micro/vmtrace_parse_200k", 5, [&trace]() {
+        VMTraceLog log;
+        log.read(trace);
+        doNotOptimize(log.size());
+    }, c_lines);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
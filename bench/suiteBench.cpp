@@ -0,0 +1,83 @@
+#include "BenchRecorder.h"
+#include "SyntheticData.h"
+#include <retesteth/EthChecks.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <retesteth/testSuites/blockchain/BlockchainTests.h>
+#include <retesteth/testSuites/statetests/StateTests.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace test;
+using namespace test::bench;
+using namespace dataobject;
+
+namespace
+{
+size_t const c_stateTests = 8;
+size_t const c_stateTestAccounts = 32;
+size_t const c_blockchainTests = 4;
+size_t const c_blockchainTestBlocks = 4;
+
+template <class T>
+spDataObject fillTest(spDataObject const& _filler)
+{
+    T suite;
+    TestSuite::TestSuiteOptions opt;
+    opt.doFilling = true;
+    spDataObject input = _filler->copy();
+    spDataObject filled = suite.doTests(input, opt);
+    ETH_FAIL_REQUIRE_MESSAGE(!filled.isEmpty() && filled->type() == DataType::Object,
+        "retesteth-bench: filling " + _filler->getSubObjects().at(0)->getKey() + " failed");
+    setFilledInfo(filled.getContent());
+    return filled;
+}
+
+template <class T>
+void runTest(spDataObject const& _filled)
+{
+    T suite;
+    TestSuite::TestSuiteOptions opt;
+    spDataObject input = _filled->copy();
+    suite.doTests(input, opt);
+}
+
+// Fill the synthetic tests, then run the filled tests, against the mock t8n of the bench datadir
+template <class T>
+void benchSuite(string const& _name, vector<spDataObject> const& _fillers)
+{
+    BenchRecorder::get().measure("EndToEnd/" + _name + "_fill", 3, [&_fillers]() {
+        for (auto const& filler : _fillers)
+            fillTest<T>(filler);
+    }, _fillers.size());
+
+    vector<spDataObject> filled;
+    for (auto const& filler : _fillers)
+        filled.emplace_back(fillTest<T>(filler));
+    BenchRecorder::get().measure("EndToEnd/" + _name + "_run", 3, [&filled]() {
+        for (auto const& test : filled)
+            runTest<T>(test);
+    }, filled.size());
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(RetestethBench, BenchFixture)
+BOOST_AUTO_TEST_SUITE(EndToEnd)
+
+BOOST_AUTO_TEST_CASE(stateTests)
+{
+    vector<spDataObject> fillers;
+    for (size_t i = 0; i < c_stateTests; i++)
+        fillers.emplace_back(makeStateTestFiller("benchState" + test::fto_string(i), c_stateTestAccounts));
+    benchSuite<StateTestSuite>("stateTests", fillers);
+}
+
+BOOST_AUTO_TEST_CASE(blockchainTests)
+{
+    vector<spDataObject> fillers;
+    for (size_t i = 0; i < c_blockchainTests; i++)
+        fillers.emplace_back(makeBlockchainTestFiller("benchBlockchain" + test::fto_string(i), c_blockchainTestBlocks));
+    benchSuite<BlockchainTestValidSuite>("blockchainTests", fillers);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,6 @@
 #pragma once
 #include "DataObject.h"
+#include <string_view>
 
 namespace dataobject
 {
@@ -17,6 +18,11 @@ struct CJOptions
 };
 
 /// Convert Json object represented as string to DataObject
+/// The input is only read while parsing, a view of a mapped file can be passed directly
 spDataObject ConvertJsoncppStringToData(
-    std::string const& _input, CJOptions const& _opt = CJOptions());
+    std::string_view _input, CJOptions const& _opt = CJOptions());
+
+/// Convert Yaml document represented as string to DataObject without building yaml-cpp nodes
+/// The result is the same as ConvertYamlToData(YAML::Load(_input), _sort)
+spDataObject ConvertYamlStringToData(std::string_view _input, bool _sort = false);
 }
@@ -0,0 +1,49 @@
+#include "DataObjectNormalizer.h"
+using namespace std;
+
+namespace dataobject
+{
+DataObjectNormalizer::DataObjectNormalizer(std::initializer_list<Modifier> _modifiers)
+{
+    for (auto const& f : _modifiers)
+        add(f);
+}
+
+DataObjectNormalizer& DataObjectNormalizer::add(Modifier _f, std::set<std::string> const& _exceptionKeys)
+{
+    if (m_stages.size() >= sizeof(ActiveMask) * 8)
+        throw DataObjectException() << "DataObjectNormalizer::add too many modifiers in one normalizer!";
+    m_stages.push_back({_f, _exceptionKeys});
+    return *this;
+}
+
+void DataObjectNormalizer::perform(DataObject& _data, DataObject::ModifierOption _opt) const
+{
+    if (m_stages.empty())
+        return;
+    ActiveMask const all = m_stages.size() == sizeof(ActiveMask) * 8 ? ActiveMask(-1) : (ActiveMask(1) << m_stages.size()) - 1;
+    _perform(_data, all, _opt);
+}
+
+void DataObjectNormalizer::_perform(DataObject& _data, ActiveMask _active, DataObject::ModifierOption _opt) const
+{
+    for (size_t i = 0; i < m_stages.size(); i++)
+    {
+        ActiveMask const bit = ActiveMask(1) << i;
+        if (!(_active & bit))
+            continue;
+        Stage const& stage = m_stages[i];
+        if (!stage.exceptionKeys.empty() && stage.exceptionKeys.count(_data.getKey()))
+            _active &= ~bit;
+        else
+            stage.f(_data);
+    }
+
+    if (_active && _opt == DataObject::ModifierOption::RECURSIVE && _data.isArray())
+    {
+        for (auto& el : _data.getSubObjectsUnsafe())
+            _perform(el.getContent(), _active, _opt);
+    }
+}
+
+}  // namespace dataobject
@@ -0,0 +1,35 @@
+#pragma once
+#include "DataObject.h"
+#include <set>
+#include <string>
+#include <vector>
+
+namespace dataobject
+{
+/// A list of DataObject modifiers applied in a single tree traversal
+/// Each node gets all active modifiers in the order they were added, then its subobjects are visited
+/// Modifier is skipped for the node (and its subtree) whose key is in the modifier's exception keys
+/// Same result as chained performModifier calls as long as a modifier only touches the node it is given
+class DataObjectNormalizer
+{
+public:
+    typedef void (*Modifier)(DataObject&);
+    DataObjectNormalizer() {}
+    DataObjectNormalizer(std::initializer_list<Modifier> _modifiers);
+
+    DataObjectNormalizer& add(Modifier _f, std::set<std::string> const& _exceptionKeys = {});
+    void perform(DataObject& _data, DataObject::ModifierOption _opt = DataObject::ModifierOption::RECURSIVE) const;
+
+private:
+    typedef uint32_t ActiveMask;
+    void _perform(DataObject& _data, ActiveMask _active, DataObject::ModifierOption _opt) const;
+
+    struct Stage
+    {
+        Modifier f;
+        std::set<std::string> exceptionKeys;
+    };
+    std::vector<Stage> m_stages;
+};
+
+}  // namespace dataobject
@@ -7,11 +7,11 @@
 using namespace std;
 using namespace dataobject;
 
-JsonParser::JsonParser(std::string const& _input, CJOptions const& _opt)
+JsonParser::JsonParser(std::string_view _input, CJOptions const& _opt)
   : m_input(_input), m_opt(_opt)
 {
     if (_input.size() < 2 || _input.find("{") == string::npos || _input.rfind("}") == string::npos)
-        throw DataObjectException() << "ConvertJsoncppStringToData can't read json structure in file: `" + _input.substr(0, 50);
+        throw DataObjectException() << "ConvertJsoncppStringToData can't read json structure in file: `" + string(_input.substr(0, 50));
 
     m_applyDepth.clear();
     m_root.getContent().setAutosort(_opt.autosort);
@@ -23,9 +23,9 @@ string JsonParser::printDebug(size_t const& _i) const
     static const short c_debugSize = 120;
     string debug;
     if (_i > c_debugSize)
-        debug = m_input.substr(_i - c_debugSize, c_debugSize);
+        debug = string(m_input.substr(_i - c_debugSize, c_debugSize));
     else
-        debug = m_input.substr(0, c_debugSize);
+        debug = string(m_input.substr(0, c_debugSize));
     return "\n\"------\n" + debug + "\n\"------";
 }
 
@@ -54,6 +54,10 @@ void JsonParser::parse()
 
         tryParseDigitBoolNull(i);
     }
+
+    // Complete json returns on its last closing bracket
+    if (!m_input.empty())
+        throw DataObjectException() << errorPrefix + "unexpected end of json! around: " + printDebug(m_input.length());
 }
 
 void JsonParser::checkJsonCommaEnding(size_t& _i) const
@@ -188,7 +192,7 @@ JsonParser::RET JsonParser::tryParseArrayEnd(size_t& _i, bool _seenCommaBefore)
             _i++;
             _i = skipSpaces(_i);
             if (_i != m_input.length())
-                throw DataObjectException() << errorPrefix + "expected end of json! " + m_input;
+                throw DataObjectException() << errorPrefix + "expected end of json! " + string(m_input);
             return RET::RETURN;
         }
         else
@@ -251,7 +255,7 @@ JsonParser::RET JsonParser::tryParseDigitBoolNull(size_t& _i)
             m_actualRoot = m_applyDepth.at(m_applyDepth.size() - 1);
             m_applyDepth.pop_back();
         }
-        if (m_input.at(_i) != ',')
+        if (_i == m_input.length() || m_input.at(_i) != ',')
             _i--;
         return RET::CONTINUE;
     }
@@ -286,7 +290,7 @@ string JsonParser::parseKeyValue(size_t& _i) const
                 endPos = m_input.find('"', endPos + 1);
         }
 
-        const string key = m_input.substr(_i + 1, endPos - _i - 1);
+        const string key(m_input.substr(_i + 1, endPos - _i - 1));
         _i = endPos + 1;
         return key;
     }
@@ -301,7 +305,7 @@ bool JsonParser::readBoolOrNull(size_t& _i, bool& _result, bool& _readNull) cons
         return false;
 
     // true false
-    const string text = m_input.substr(_i, 4);
+    string_view const text = m_input.substr(_i, 4);
     if (text == "null")
     {
         _i += 4;
@@ -328,31 +332,19 @@ bool JsonParser::readBoolOrNull(size_t& _i, bool& _result, bool& _readNull) cons
 
 bool JsonParser::readDigit(size_t& _i, int& _result) const
 {
+    // m_input might be a view into a mapped file, never read past its end
     bool readMinus = false;
-    auto const& e = m_input[_i];
-    if (e == '-')
+    if (_i < m_input.size() && m_input[_i] == '-')
     {
         readMinus = true;
         _i++;
     }
 
-    bool digit = true;
     string readNumber;
-    while (digit)
-    {
-        auto const& e = m_input[_i];
-        if (e == '0' || e == '1' || e == '2' || e == '3' || e == '4' || e == '5' || e == '6' ||
-            e == '7' || e == '8' || e == '9')
-        {
-            readNumber += e;
-            _i++;
-        }
-        else
-        {
-            digit = false;
-            _i = skipSpaces(_i);
-        }
-    }
+    while (_i < m_input.size() && m_input[_i] >= '0' && m_input[_i] <= '9')
+        readNumber += m_input[_i++];
+    _i = skipSpaces(_i);
+
     if (readNumber.size())
     {
         _result = std::atoi(readNumber.c_str());
@@ -1,6 +1,7 @@
 #pragma once
 #include "DataObject.h"
 #include "ConvertFile.h"
+#include <string_view>
 
 namespace dataobject
 {
@@ -8,7 +9,7 @@ namespace dataobject
 class JsonParser
 {
 public:
-    JsonParser(std::string const& _input, CJOptions const& _opt = CJOptions());
+    JsonParser(std::string_view _input, CJOptions const& _opt = CJOptions());
     void parse();
     spDataObject root() { return  m_root; }
 private:
@@ -36,7 +37,7 @@ private:
     bool readDigit(size_t& _i, int& _result) const;
     void checkJsonCommaEnding(size_t& _i) const;
 private:
-    std::string const& m_input;
+    std::string_view const m_input;
     CJOptions const m_opt;
 
     std::vector<DataObject*> m_applyDepth;  // indexes at root array of objects that we are reading into
@@ -0,0 +1,922 @@
+#include "YamlParser.h"
+#include "ConvertYaml.h"
+#include "Exception.h"
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+using namespace dataobject;
+using namespace dataobject::ymlinternal;
+
+namespace
+{
+bool isSpace(char _c)
+{
+    return _c == ' ' || _c == '\t';
+}
+
+bool isBreakOrSpace(char _c)
+{
+    return _c == ' ' || _c == '\t' || _c == '\n' || _c == '\r';
+}
+
+bool isFlowIndicator(char _c)
+{
+    return _c == ',' || _c == '[' || _c == ']' || _c == '{' || _c == '}';
+}
+
+bool isNullString(string const& _str)
+{
+    return _str.empty() || _str == "~" || _str == "null" || _str == "Null" || _str == "NULL";
+}
+
+string rtrim(string_view _str)
+{
+    size_t end = _str.size();
+    while (end > 0 && isSpace(_str.at(end - 1)))
+        end--;
+    return string(_str.substr(0, end));
+}
+
+void appendUtf8(string& _out, unsigned long _code)
+{
+    if (_code < 0x80)
+        _out += (char)_code;
+    else if (_code < 0x800)
+    {
+        _out += (char)(0xC0 | (_code >> 6));
+        _out += (char)(0x80 | (_code & 0x3F));
+    }
+    else if (_code < 0x10000)
+    {
+        _out += (char)(0xE0 | (_code >> 12));
+        _out += (char)(0x80 | ((_code >> 6) & 0x3F));
+        _out += (char)(0x80 | (_code & 0x3F));
+    }
+    else
+    {
+        _out += (char)(0xF0 | (_code >> 18));
+        _out += (char)(0x80 | ((_code >> 12) & 0x3F));
+        _out += (char)(0x80 | ((_code >> 6) & 0x3F));
+        _out += (char)(0x80 | (_code & 0x3F));
+    }
+}
+
+// Same rules as yaml-cpp convert<bool>: y/yes/true/on, n/no/false/off in lower, upper or capitalized case
+bool isFlexibleCase(string const& _str)
+{
+    if (_str.empty())
+        return true;
+    auto const allOf = [](string_view _s, int (*_f)(int)) {
+        return std::all_of(_s.begin(), _s.end(), [_f](char _c) { return _f((unsigned char)_c); });
+    };
+    if (allOf(_str, ::islower))
+        return true;
+    string_view const rest = string_view(_str).substr(1);
+    return ::isupper((unsigned char)_str.at(0)) && (allOf(rest, ::islower) || allOf(rest, ::isupper));
+}
+
+bool readBool(string const& _str, bool& _result)
+{
+    if (!isFlexibleCase(_str))
+        return false;
+    string lower = _str;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    static vector<pair<string, string>> const names = {{"y", "n"}, {"yes", "no"}, {"true", "false"}, {"on", "off"}};
+    for (auto const& name : names)
+    {
+        if (lower == name.first || lower == name.second)
+        {
+            _result = lower == name.first;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Same rules as yaml-cpp convert<int>: base is detected by the prefix, no spaces before the number
+bool readInt(string const& _str, int& _result)
+{
+    std::stringstream stream(_str);
+    stream.unsetf(std::ios::dec);
+    return (stream >> std::noskipws >> _result) && (stream >> std::ws).eof();
+}
+
+string normalizeTag(string const& _tag)
+{
+    if (_tag.size() > 2 && _tag.substr(0, 2) == "!!")
+        return "tag:yaml.org,2002:" + _tag.substr(2);
+    if (_tag.size() > 3 && _tag.at(1) == '<' && _tag.back() == '>')
+        return _tag.substr(2, _tag.size() - 3);
+    return _tag;
+}
+}  // namespace
+
+YamlParser::YamlParser(std::string_view _input, bool _sort) : m_input(_input), m_sort(_sort)
+{
+    splitLines();
+}
+
+void YamlParser::error(string const& _message, size_t _pos) const
+{
+    throw DataObjectException() << errorPrefix + _message + " at line " + to_string(lineNumber(_pos));
+}
+
+size_t YamlParser::lineNumber(size_t _pos) const
+{
+    return std::count(m_input.begin(), m_input.begin() + min(_pos, m_input.size()), '\n') + 1;
+}
+
+void YamlParser::splitLines()
+{
+    size_t pos = 0;
+    if (m_input.substr(0, 3) == "\xEF\xBB\xBF")
+        pos = 3;
+
+    bool seenDocumentStart = false;
+    bool seenContent = false;
+    while (pos < m_input.size())
+    {
+        size_t lineEnd = m_input.find('\n', pos);
+        size_t const next = (lineEnd == string::npos) ? m_input.size() : lineEnd + 1;
+        if (lineEnd == string::npos)
+            lineEnd = m_input.size();
+        if (lineEnd > pos && m_input.at(lineEnd - 1) == '\r')
+            lineEnd--;
+
+        Line line{0, pos, pos, lineEnd};
+        while (line.begin < line.end && m_input.at(line.begin) == ' ')
+            line.begin++;
+        line.indent = line.begin - line.start;
+        while (line.begin < line.end && isSpace(m_input.at(line.begin)))
+            line.begin++;
+
+        string_view const text = m_input.substr(pos, lineEnd - pos);
+        bool const marker = text.size() == 3 || (text.size() > 3 && isSpace(text.at(3)));
+        if (marker && text.substr(0, 3) == "...")
+            break;
+        if (marker && text.substr(0, 3) == "---")
+        {
+            // Only the first document is read
+            if (seenDocumentStart || seenContent)
+                break;
+            seenDocumentStart = true;
+            line.begin = skipSpaces(pos + 3, lineEnd);
+            line.indent = line.begin - line.start;
+            if (isLineRestEmpty(line.begin, lineEnd))
+            {
+                pos = next;
+                continue;
+            }
+        }
+        else if (!seenDocumentStart && !seenContent && text.size() && text.at(0) == '%')
+        {
+            pos = next;
+            continue;
+        }
+
+        if (!isLineRestEmpty(line.begin, line.end))
+            seenContent = true;
+        m_lines.push_back(line);
+        pos = next;
+    }
+}
+
+size_t YamlParser::skipSpaces(size_t _pos, size_t _end) const
+{
+    while (_pos < _end && isSpace(m_input.at(_pos)))
+        _pos++;
+    return _pos;
+}
+
+bool YamlParser::isLineRestEmpty(size_t _pos, size_t _end) const
+{
+    _pos = skipSpaces(_pos, _end);
+    return _pos == _end || m_input.at(_pos) == '#';
+}
+
+void YamlParser::skipEmptyLines()
+{
+    while (!eof() && isLineRestEmpty(line().begin, line().end))
+        m_line++;
+}
+
+size_t YamlParser::lineOf(size_t _pos) const
+{
+    auto const it = std::upper_bound(
+        m_lines.begin(), m_lines.end(), _pos, [](size_t _p, Line const& _line) { return _p < _line.start; });
+    return (it == m_lines.begin()) ? 0 : std::distance(m_lines.begin(), it) - 1;
+}
+
+void YamlParser::finishLineAt(size_t _pos)
+{
+    m_line = lineOf(_pos);
+    if (!eof() && !isLineRestEmpty(_pos, line().end))
+        error("unexpected characters after the value", _pos);
+    m_line++;
+}
+
+bool YamlParser::isSequenceItem(Line const& _line) const
+{
+    return _line.begin < _line.end && m_input.at(_line.begin) == '-'
+           && (_line.begin + 1 == _line.end || isSpace(m_input.at(_line.begin + 1)));
+}
+
+bool YamlParser::isMappingLine(Line const& _line) const
+{
+    if (_line.begin == _line.end)
+        return false;
+
+    size_t pos = _line.begin;
+    char const first = m_input.at(pos);
+    if (first == '"' || first == '\'')
+    {
+        // Quoted key has to be closed on the same line
+        for (pos++; pos < _line.end; pos++)
+        {
+            char const c = m_input.at(pos);
+            if (first == '"' && c == '\\')
+                pos++;
+            else if (first == '\'' && c == '\'' && pos + 1 < _line.end && m_input.at(pos + 1) == '\'')
+                pos++;
+            else if (c == first)
+                break;
+        }
+        if (pos >= _line.end)
+            return false;
+        pos = skipSpaces(pos + 1, _line.end);
+        return pos < _line.end && m_input.at(pos) == ':'
+               && (pos + 1 == _line.end || isSpace(m_input.at(pos + 1)));
+    }
+
+    if (isSequenceItem(_line) || first == '#' || first == '[' || first == '{' || first == '|' || first == '>'
+        || first == '&' || first == '*' || first == '!' || first == '?')
+        return false;
+
+    for (; pos < _line.end; pos++)
+    {
+        char const c = m_input.at(pos);
+        if (c == '#' && pos > _line.begin && isSpace(m_input.at(pos - 1)))
+            return false;
+        if (c == ':' && (pos + 1 == _line.end || isSpace(m_input.at(pos + 1))))
+            return true;
+    }
+    return false;
+}
+
+spDataObject YamlParser::parse()
+{
+    spDataObject root = parseBlockNode(-1, false);
+    skipEmptyLines();
+    if (!eof())
+        error("unexpected content after the root node", line().begin);
+    return root;
+}
+
+spDataObject YamlParser::parseBlockNode(int _parentIndent, bool _allowIndentless)
+{
+    skipEmptyLines();
+    if (eof())
+        return sDataObject(DataType::Null);
+
+    Line const& current = line();
+    if (current.indent > _parentIndent)
+    {
+        if (isSequenceItem(current))
+            return parseBlockSequence(current.indent);
+        if (isMappingLine(current))
+            return parseBlockMapping(current.indent);
+        return parseValue(current.begin, _parentIndent, false);
+    }
+
+    // Sequence under a mapping key may have the same indentation as the key
+    if (_allowIndentless && current.indent == _parentIndent && isSequenceItem(current))
+        return parseBlockSequence(_parentIndent);
+
+    return sDataObject(DataType::Null);
+}
+
+spDataObject YamlParser::parseBlockMapping(int _indent)
+{
+    spDataObject jObject = sDataObject(DataType::Object);
+    if (m_sort)
+        (*jObject).setAutosort(true);
+
+    while (true)
+    {
+        skipEmptyLines();
+        if (eof() || line().indent < _indent)
+            break;
+        if (line().indent > _indent)
+            error("bad indentation of a mapping entry", line().begin);
+        if (isSequenceItem(line()))
+            break;
+        if (!isMappingLine(line()))
+            error("expected `key: value`", line().begin);
+
+        size_t pos = line().begin;
+        string const key = parseBlockKey(pos);
+        if (jObject->count(key))
+            throw DataObjectException() << "parsing .yml encountered dublicated key `" + key + "`";
+        (*jObject).addSubObject(key, parseValue(pos + 1, _indent, true));
+    }
+    return jObject;
+}
+
+spDataObject YamlParser::parseBlockSequence(int _indent)
+{
+    spDataObject jArray = sDataObject(DataType::Array);
+    if (m_sort)
+        (*jArray).setAutosort(true);
+
+    while (true)
+    {
+        skipEmptyLines();
+        if (eof() || line().indent < _indent)
+            break;
+        if (line().indent > _indent)
+            error("bad indentation of a sequence entry", line().begin);
+        if (!isSequenceItem(line()))
+            break;
+
+        // Compact nested collection `- key: value` or `- - value` continues at the column of its content
+        size_t const pos = skipSpaces(line().begin + 1, line().end);
+        if (!isLineRestEmpty(pos, line().end))
+        {
+            Line nested = line();
+            nested.begin = pos;
+            nested.indent = pos - nested.start;
+            if (isSequenceItem(nested) || isMappingLine(nested))
+            {
+                line() = nested;
+                if (isSequenceItem(nested))
+                    (*jArray).addArrayObject(parseBlockSequence(nested.indent));
+                else
+                    (*jArray).addArrayObject(parseBlockMapping(nested.indent));
+                continue;
+            }
+        }
+        (*jArray).addArrayObject(parseValue(pos, _indent, false));
+    }
+    return jArray;
+}
+
+string YamlParser::parseBlockKey(size_t& _pos)
+{
+    string key;
+    char const first = m_input.at(_pos);
+    if (first == '"')
+        key = parseDoubleQuoted(_pos);
+    else if (first == '\'')
+        key = parseSingleQuoted(_pos);
+    else
+    {
+        size_t const begin = _pos;
+        while (!(m_input.at(_pos) == ':' && (_pos + 1 == line().end || isSpace(m_input.at(_pos + 1)))))
+            _pos++;
+        key = rtrim(m_input.substr(begin, _pos - begin));
+    }
+    _pos = skipSpaces(_pos, line().end);
+    if (_pos == line().end || m_input.at(_pos) != ':')
+        error("expected `:` after the key `" + key + "`", _pos);
+    return key;
+}
+
+// _pos points after `key:` or `- `, the value may start on the same line or on the next lines
+spDataObject YamlParser::parseValue(size_t _pos, int _parentIndent, bool _inMapping)
+{
+    size_t const end = line().end;
+    _pos = skipSpaces(_pos, end);
+    Properties const props = parseProperties(_pos, end);
+
+    spDataObject node(0);
+    bool plain = false;
+    if (isLineRestEmpty(_pos, end))
+    {
+        m_line++;
+        node = parseBlockNode(_parentIndent, _inMapping);
+    }
+    else
+    {
+        char const c = m_input.at(_pos);
+        if (c == '|' || c == '>')
+            node = parseBlockScalar(_pos, _parentIndent);
+        else if (c == '*')
+        {
+            _pos++;
+            node = alias(readAnchorName(_pos, end));
+            finishLineAt(_pos);
+        }
+        else if (c == '[' || c == '{' || c == '"' || c == '\'')
+        {
+            node = parseFlowNode(_pos);
+            finishLineAt(_pos);
+        }
+        else
+        {
+            node = parsePlainScalar(_pos, _parentIndent);
+            plain = true;
+        }
+    }
+    return applyProperties(node, props, plain);
+}
+
+spDataObject YamlParser::parsePlainScalar(size_t _pos, int _parentIndent)
+{
+    // `key: value` can not be a part of a plain scalar, yaml-cpp calls it an illegal map value
+    auto const readLine = [this](size_t _begin, size_t _end, bool& _comment) {
+        size_t pos = _begin;
+        for (; pos < _end; pos++)
+        {
+            char const c = m_input.at(pos);
+            if (c == '#' && pos > _begin && isSpace(m_input.at(pos - 1)))
+            {
+                _comment = true;
+                break;
+            }
+            if (c == ':' && (pos + 1 == _end || isSpace(m_input.at(pos + 1))))
+                error("mapping value is not allowed in a plain scalar", pos);
+        }
+        return rtrim(m_input.substr(_begin, pos - _begin));
+    };
+
+    // Indicators which can not start a plain scalar in a block
+    char const first = m_input.at(_pos);
+    bool const separated = _pos + 1 == line().end || isSpace(m_input.at(_pos + 1));
+    if (first == '-' && separated)
+        error("block sequence entry is not allowed here", _pos);
+    if (first == '?' && separated)
+        error("explicit mapping keys `? ` are not supported", _pos);
+    if (first == '@' || first == '`')
+        error(string("reserved indicator `") + first + "` can not start a plain scalar", _pos);
+
+    bool comment = false;
+    string value = readLine(_pos, line().end, comment);
+    m_line++;
+
+    // Continuation lines are indented more than the parent node and are folded with a space
+    size_t emptyLines = 0;
+    size_t lastLine = m_line;
+    for (size_t i = m_line; !comment && i < m_lines.size(); i++)
+    {
+        Line const& next = m_lines.at(i);
+        if (next.begin == next.end)
+        {
+            emptyLines++;
+            continue;
+        }
+        if (next.indent <= _parentIndent || m_input.at(next.begin) == '#')
+            break;
+
+        string const text = readLine(next.begin, next.end, comment);
+        value += emptyLines ? string(emptyLines, '\n') : string(" ");
+        value += text;
+        emptyLines = 0;
+        lastLine = i + 1;
+    }
+    m_line = lastLine;
+    return sDataObject(value);
+}
+
+spDataObject YamlParser::parseBlockScalar(size_t _pos, int _parentIndent)
+{
+    bool const literal = m_input.at(_pos) == '|';
+    char chomping = 0;
+    int indent = 0;
+    size_t const end = line().end;
+    for (_pos++; _pos < end && !isSpace(m_input.at(_pos)); _pos++)
+    {
+        char const c = m_input.at(_pos);
+        if ((c == '-' || c == '+') && chomping == 0)
+            chomping = c;
+        else if (c >= '1' && c <= '9' && indent == 0)
+            indent = c - '0';
+        else
+            error(string("unexpected block scalar indicator `") + c + "`", _pos);
+    }
+    if (!isLineRestEmpty(_pos, end))
+        error("unexpected characters after the block scalar header", _pos);
+    m_line++;
+
+    // Content indentation is given by the indicator or by the first non empty line
+    bool hasIndent = indent != 0;
+    if (hasIndent)
+        indent += max(_parentIndent, 0);
+    else
+    {
+        for (size_t i = m_line; i < m_lines.size() && !hasIndent; i++)
+        {
+            hasIndent = m_lines.at(i).begin != m_lines.at(i).end;
+            indent = m_lines.at(i).indent;
+        }
+        hasIndent = hasIndent && indent > _parentIndent;
+    }
+
+    string value;
+    size_t emptyLines = 0;
+    bool hasContent = false;
+    bool prevMoreIndented = false;
+    bool lastHasBreak = true;
+    for (; hasIndent && !eof(); m_line++)
+    {
+        Line const& current = line();
+        // Spaces beyond the content indentation are content even on a line without text
+        if (current.begin == current.end && current.end - current.start <= size_t(indent))
+        {
+            emptyLines++;
+            continue;
+        }
+        if (current.indent < indent)
+            break;
+
+        string_view const text = m_input.substr(current.start + indent, current.end - current.start - indent);
+        bool const moreIndented = isSpace(text.at(0));
+        if (!hasContent)
+            value += string(emptyLines, '\n');
+        else if (!literal && !moreIndented && !prevMoreIndented)
+            value += emptyLines ? string(emptyLines, '\n') : string(" ");
+        else
+            value += string(emptyLines + 1, '\n');
+        value += text;
+        emptyLines = 0;
+        hasContent = true;
+        prevMoreIndented = moreIndented;
+        lastHasBreak = current.end < m_input.size();
+    }
+
+    if (chomping == '+')
+        value += string((hasContent && lastHasBreak ? 1 : 0) + emptyLines, '\n');
+    else if (chomping == 0 && hasContent && lastHasBreak)
+        value += "\n";
+    return sDataObject(value);
+}
+
+YamlParser::Properties YamlParser::parseProperties(size_t& _pos, size_t _end)
+{
+    Properties props;
+    while (_pos < _end && (m_input.at(_pos) == '&' || m_input.at(_pos) == '!'))
+    {
+        if (m_input.at(_pos) == '&')
+        {
+            _pos++;
+            props.anchor = readAnchorName(_pos, _end);
+        }
+        else
+        {
+            size_t const begin = _pos;
+            while (_pos < _end && !isBreakOrSpace(m_input.at(_pos)))
+                _pos++;
+            props.tag = normalizeTag(string(m_input.substr(begin, _pos - begin)));
+        }
+        _pos = skipSpaces(_pos, _end);
+    }
+    return props;
+}
+
+string YamlParser::readAnchorName(size_t& _pos, size_t _end) const
+{
+    size_t const begin = _pos;
+    while (_pos < _end && !isBreakOrSpace(m_input.at(_pos)) && !isFlowIndicator(m_input.at(_pos)))
+        _pos++;
+    if (_pos == begin)
+        error("empty anchor name", _pos);
+    return string(m_input.substr(begin, _pos - begin));
+}
+
+spDataObject YamlParser::alias(string const& _name)
+{
+    auto const it = m_anchors.find(_name);
+    if (it == m_anchors.end())
+        throw DataObjectException() << errorPrefix + "unknown alias `" + _name + "`";
+    // The anchored node may be a mapping value, the alias takes the key of its own place
+    spDataObject node = it->second->copy();
+    (*node).setKey(string());
+    return node;
+}
+
+spDataObject YamlParser::applyProperties(spDataObject const& _node, Properties const& _props, bool _plain)
+{
+    spDataObject node = _node;
+    if (node->type() == DataType::String)
+    {
+        string const& value = node->asString();
+        if (_plain && _props.tag.empty() && isNullString(value))
+            node = sDataObject(DataType::Null);
+        else if (_props.tag == YML_INT_TAG)
+        {
+            int result = 0;
+            if (!readInt(value, result))
+                throw DataObjectException() << errorPrefix + "can't convert `" + value + "` to !!int";
+            node = sDataObject(result);
+        }
+        else if (_props.tag == YML_BOOL_TAG)
+        {
+            bool result = false;
+            if (!readBool(value, result))
+                throw DataObjectException() << errorPrefix + "can't convert `" + value + "` to !!bool";
+            node = sDataObject(DataType::Bool, result);
+        }
+    }
+
+    if (!_props.anchor.empty())
+        m_anchors[_props.anchor] = node;
+    return node;
+}
+
+void YamlParser::skipFlowSpaces(size_t& _pos) const
+{
+    while (_pos < m_input.size())
+    {
+        char const c = m_input.at(_pos);
+        if (isBreakOrSpace(c))
+            _pos++;
+        else if (c == '#' && (_pos == 0 || isBreakOrSpace(m_input.at(_pos - 1))))
+        {
+            while (_pos < m_input.size() && m_input.at(_pos) != '\n')
+                _pos++;
+        }
+        else
+            break;
+    }
+}
+
+spDataObject YamlParser::parseFlowNode(size_t& _pos)
+{
+    skipFlowSpaces(_pos);
+    Properties const props = parseProperties(_pos, m_input.size());
+    skipFlowSpaces(_pos);
+    if (_pos == m_input.size())
+        error("unexpected end of flow collection", _pos);
+
+    spDataObject node(0);
+    bool plain = false;
+    switch (m_input.at(_pos))
+    {
+    case '[':
+        node = parseFlowSequence(_pos);
+        break;
+    case '{':
+        node = parseFlowMapping(_pos);
+        break;
+    case '"':
+        node = sDataObject(parseDoubleQuoted(_pos));
+        break;
+    case '\'':
+        node = sDataObject(parseSingleQuoted(_pos));
+        break;
+    case '*':
+        _pos++;
+        node = alias(readAnchorName(_pos, m_input.size()));
+        break;
+    default:
+        node = sDataObject(parseFlowPlain(_pos));
+        plain = true;
+    }
+    return applyProperties(node, props, plain);
+}
+
+spDataObject YamlParser::parseFlowSequence(size_t& _pos)
+{
+    spDataObject jArray = sDataObject(DataType::Array);
+    if (m_sort)
+        (*jArray).setAutosort(true);
+
+    _pos++;
+    while (true)
+    {
+        skipFlowSpaces(_pos);
+        if (_pos == m_input.size())
+            error("flow sequence is not closed", _pos);
+        if (m_input.at(_pos) == ']')
+            break;
+        spDataObject entry = parseFlowNode(_pos);
+        skipFlowSpaces(_pos);
+        if (_pos < m_input.size() && m_input.at(_pos) == ':')
+        {
+            // Single pair `[key: value]` is a mapping with one key
+            if (entry->type() != DataType::String)
+                error("flow sequence pair needs a scalar key", _pos);
+            spDataObject pair = sDataObject(DataType::Object);
+            if (m_sort)
+                (*pair).setAutosort(true);
+            (*pair).addSubObject(entry->asString(), parseFlowPairValue(_pos));
+            entry = pair;
+            skipFlowSpaces(_pos);
+        }
+        (*jArray).addArrayObject(entry);
+        if (_pos < m_input.size() && m_input.at(_pos) == ',')
+            _pos++;
+        else if (_pos == m_input.size() || m_input.at(_pos) != ']')
+            error("expected `,` or `]` in flow sequence", _pos);
+    }
+    _pos++;
+    return jArray;
+}
+
+spDataObject YamlParser::parseFlowMapping(size_t& _pos)
+{
+    spDataObject jObject = sDataObject(DataType::Object);
+    if (m_sort)
+        (*jObject).setAutosort(true);
+
+    _pos++;
+    while (true)
+    {
+        skipFlowSpaces(_pos);
+        if (_pos == m_input.size())
+            error("flow mapping is not closed", _pos);
+        if (m_input.at(_pos) == '}')
+            break;
+
+        string key;
+        if (m_input.at(_pos) == '"')
+            key = parseDoubleQuoted(_pos);
+        else if (m_input.at(_pos) == '\'')
+            key = parseSingleQuoted(_pos);
+        else
+            key = parseFlowPlain(_pos);
+        if (jObject->count(key))
+            throw DataObjectException() << "parsing .yml encountered dublicated key `" + key + "`";
+
+        skipFlowSpaces(_pos);
+        (*jObject).addSubObject(key, parseFlowPairValue(_pos));
+
+        skipFlowSpaces(_pos);
+        if (_pos < m_input.size() && m_input.at(_pos) == ',')
+            _pos++;
+        else if (_pos == m_input.size() || m_input.at(_pos) != '}')
+            error("expected `,` or `}` in flow mapping", _pos);
+    }
+    _pos++;
+    return jObject;
+}
+
+// Value after the flow key, null when there is no `:` or nothing follows it
+spDataObject YamlParser::parseFlowPairValue(size_t& _pos)
+{
+    if (_pos == m_input.size() || m_input.at(_pos) != ':')
+        return sDataObject(DataType::Null);
+    _pos++;
+    skipFlowSpaces(_pos);
+    if (_pos == m_input.size() || m_input.at(_pos) == ',' || m_input.at(_pos) == '}' || m_input.at(_pos) == ']')
+        return sDataObject(DataType::Null);
+    return parseFlowNode(_pos);
+}
+
+// Plain scalar inside a flow collection, ends at a flow indicator, `: ` or a comment
+string YamlParser::parseFlowPlain(size_t& _pos)
+{
+    string value;
+    size_t emptyLines = 0;
+    bool lineStart = false;
+    for (; _pos < m_input.size(); _pos++)
+    {
+        char const c = m_input.at(_pos);
+        if (isFlowIndicator(c))
+            break;
+        if (c == ':' && (_pos + 1 == m_input.size() || isBreakOrSpace(m_input.at(_pos + 1))
+                            || isFlowIndicator(m_input.at(_pos + 1))))
+            break;
+        if (c == '#' && _pos > 0 && isBreakOrSpace(m_input.at(_pos - 1)))
+            break;
+        if (c == '\n')
+        {
+            if (lineStart)
+                emptyLines++;
+            value = rtrim(value);
+            lineStart = true;
+            continue;
+        }
+        if (lineStart && isBreakOrSpace(c))
+            continue;
+        if (lineStart && !value.empty())
+            value += emptyLines ? string(emptyLines, '\n') : string(" ");
+        lineStart = false;
+        emptyLines = 0;
+        value += c;
+    }
+    return rtrim(value);
+}
+
+string YamlParser::parseDoubleQuoted(size_t& _pos)
+{
+    size_t const begin = _pos;
+    string value;
+    size_t escapedLength = 0;  // trailing spaces before a line break are trimmed, unless they were escaped
+    for (_pos++; _pos < m_input.size(); _pos++)
+    {
+        char const c = m_input.at(_pos);
+        if (c == '"')
+        {
+            _pos++;
+            return value;
+        }
+        if (c == '\\')
+        {
+            if (++_pos == m_input.size())
+                break;
+            char const e = m_input.at(_pos);
+            size_t hexLength = 0;
+            switch (e)
+            {
+            case '0': value += '\0'; break;
+            case 'a': value += '\a'; break;
+            case 'b': value += '\b'; break;
+            case 't':
+            case '\t': value += '\t'; break;
+            case 'n': value += '\n'; break;
+            case 'v': value += '\v'; break;
+            case 'f': value += '\f'; break;
+            case 'r': value += '\r'; break;
+            case 'e': value += '\x1b'; break;
+            case ' ': value += ' '; break;
+            case '"': value += '"'; break;
+            case '/': value += '/'; break;
+            case '\\': value += '\\'; break;
+            case 'N': appendUtf8(value, 0x85); break;
+            case '_': appendUtf8(value, 0xA0); break;
+            case 'L': appendUtf8(value, 0x2028); break;
+            case 'P': appendUtf8(value, 0x2029); break;
+            case 'x': hexLength = 2; break;
+            case 'u': hexLength = 4; break;
+            case 'U': hexLength = 8; break;
+            case '\r':
+            case '\n':
+                // Escaped line break is removed together with the indentation of the next line
+                if (e == '\r' && _pos + 1 < m_input.size() && m_input.at(_pos + 1) == '\n')
+                    _pos++;
+                while (_pos + 1 < m_input.size() && isSpace(m_input.at(_pos + 1)))
+                    _pos++;
+                break;
+            default:
+                error(string("unknown escape character `") + e + "`", _pos);
+            }
+            if (hexLength)
+            {
+                if (_pos + hexLength >= m_input.size())
+                    break;
+                string const hex(m_input.substr(_pos + 1, hexLength));
+                if (!std::all_of(hex.begin(), hex.end(), ::isxdigit))
+                    error("bad escape sequence `\\" + string(1, e) + hex + "`", _pos);
+                appendUtf8(value, std::stoul(hex, nullptr, 16));
+                _pos += hexLength;
+            }
+            escapedLength = value.size();
+            continue;
+        }
+        if (c == '\n' || c == '\r')
+        {
+            while (value.size() > escapedLength && isSpace(value.back()))
+                value.pop_back();
+            size_t breaks = 0;
+            while (_pos < m_input.size() && isBreakOrSpace(m_input.at(_pos)))
+            {
+                if (m_input.at(_pos) == '\n')
+                    breaks++;
+                _pos++;
+            }
+            value += breaks > 1 ? string(breaks - 1, '\n') : string(" ");
+            _pos--;
+            continue;
+        }
+        value += c;
+    }
+    error("double quoted string is not closed", begin);
+}
+
+string YamlParser::parseSingleQuoted(size_t& _pos)
+{
+    size_t const begin = _pos;
+    string value;
+    for (_pos++; _pos < m_input.size(); _pos++)
+    {
+        char const c = m_input.at(_pos);
+        if (c == '\'')
+        {
+            if (_pos + 1 < m_input.size() && m_input.at(_pos + 1) == '\'')
+            {
+                value += '\'';
+                _pos++;
+                continue;
+            }
+            _pos++;
+            return value;
+        }
+        if (c == '\n' || c == '\r')
+        {
+            value = rtrim(value);
+            size_t breaks = 0;
+            while (_pos < m_input.size() && isBreakOrSpace(m_input.at(_pos)))
+            {
+                if (m_input.at(_pos) == '\n')
+                    breaks++;
+                _pos++;
+            }
+            value += breaks > 1 ? string(breaks - 1, '\n') : string(" ");
+            _pos--;
+            continue;
+        }
+        value += c;
+    }
+    error("single quoted string is not closed", begin);
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "DataObject.h"
+#include <map>
+#include <string_view>
+
+namespace dataobject
+{
+
+// Builds DataObject directly from the yaml text, without the yaml-cpp node tree
+// Supports the yaml used by test fillers: block maps and sequences, flow collections,
+// plain, quoted and block scalars, comments, anchors and aliases, !!int and !!bool tags.
+// Produces the same DataObject as ConvertYamlToData(YAML::Load(_input))
+class YamlParser
+{
+public:
+    YamlParser(std::string_view _input, bool _sort = false);
+    spDataObject parse();
+
+private:
+    struct Line
+    {
+        int indent;    // spaces before the content
+        size_t start;  // first char of the line
+        size_t begin;  // first char of the content
+        size_t end;    // end of the line without line break
+    };
+
+    struct Properties
+    {
+        std::string anchor;
+        std::string tag;
+    };
+
+private:
+    // Block context, works with the current line m_line
+    spDataObject parseBlockNode(int _parentIndent, bool _allowIndentless);
+    spDataObject parseBlockMapping(int _indent);
+    spDataObject parseBlockSequence(int _indent);
+    spDataObject parseValue(size_t _pos, int _parentIndent, bool _inMapping);
+    spDataObject parsePlainScalar(size_t _pos, int _parentIndent);
+    spDataObject parseBlockScalar(size_t _pos, int _parentIndent);
+    std::string parseBlockKey(size_t& _pos);
+
+    // Flow context, works with the absolute position and may cross lines
+    spDataObject parseFlowNode(size_t& _pos);
+    spDataObject parseFlowSequence(size_t& _pos);
+    spDataObject parseFlowMapping(size_t& _pos);
+    spDataObject parseFlowPairValue(size_t& _pos);
+    std::string parseFlowPlain(size_t& _pos);
+    std::string parseDoubleQuoted(size_t& _pos);
+    std::string parseSingleQuoted(size_t& _pos);
+    void skipFlowSpaces(size_t& _pos) const;
+
+    // Helpers
+    void splitLines();
+    void skipEmptyLines();
+    bool eof() const { return m_line >= m_lines.size(); }
+    Line& line() { return m_lines.at(m_line); }
+    bool isSequenceItem(Line const& _line) const;
+    bool isMappingLine(Line const& _line) const;
+    size_t skipSpaces(size_t _pos, size_t _end) const;
+    bool isLineRestEmpty(size_t _pos, size_t _end) const;
+    void finishLineAt(size_t _pos);
+    size_t lineOf(size_t _pos) const;
+    Properties parseProperties(size_t& _pos, size_t _end);
+    spDataObject applyProperties(spDataObject const& _node, Properties const& _props, bool _plain);
+    spDataObject alias(std::string const& _name);
+    std::string readAnchorName(size_t& _pos, size_t _end) const;
+    size_t lineNumber(size_t _pos) const;
+    [[noreturn]] void error(std::string const& _message, size_t _pos) const;
+
+private:
+    std::string_view const m_input;
+    bool const m_sort;
+    std::vector<Line> m_lines;
+    size_t m_line = 0;
+    std::map<std::string, spDataObject> m_anchors;
+    std::string const errorPrefix = "Error parsing yaml: ";
+};
+
+}
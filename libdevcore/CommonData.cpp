@@ -43,10 +43,8 @@ int fromHexChar(char _i) noexcept
 
 bool dev::isHex(string const& _s) noexcept
 {
-	auto it = _s.begin();
-	if (_s.compare(0, 2, "0x") == 0)
-		it += 2;
-	return std::all_of(it, _s.end(), [](char c){ return fromHexChar(c) != -1; });
+	size_t const s = (_s.compare(0, 2, "0x") == 0) ? 2 : 0;
+	return decodeHex(_s.data() + s, _s.size() - s, nullptr);
 }
 
 std::string dev::escaped(std::string const& _s, bool _all)
@@ -81,29 +79,23 @@ std::string dev::escaped(std::string const& _s, bool _all)
 bytes dev::fromHex(std::string const& _s, WhenError _throw)
 {
 	unsigned s = (_s.size() >= 2 && _s[0] == '0' && _s[1] == 'x') ? 2 : 0;
-	std::vector<uint8_t> ret;
-	ret.reserve((_s.size() - s + 1) / 2);
+	bytes ret((_s.size() - s + 1) / 2);
 
 	if (_s.size() % 2)
 	{
 		int h = fromHexChar(_s[s++]);
 		if (h != -1)
-			ret.push_back(h);
+			ret[0] = h;
 		else if (_throw == WhenError::Throw)
 			BOOST_THROW_EXCEPTION(BadHexCharacter());
 		else
 			return bytes();
 	}
-	for (unsigned i = s; i < _s.size(); i += 2)
+	if (!decodeHex(_s.data() + s, _s.size() - s, ret.data() + ret.size() - (_s.size() - s) / 2))
 	{
-		int h = fromHexChar(_s[i]);
-		int l = fromHexChar(_s[i + 1]);
-		if (h != -1 && l != -1)
-			ret.push_back((byte)(h * 16 + l));
-		else if (_throw == WhenError::Throw)
+		if (_throw == WhenError::Throw)
 			BOOST_THROW_EXCEPTION(BadHexCharacter());
-		else
-			return bytes();
+		return bytes();
 	}
 	return ret;
 }
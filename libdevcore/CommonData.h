@@ -28,8 +28,11 @@
 #include <unordered_set>
 #include <type_traits>
 #include <cstring>
+#include <iterator>
+#include <memory>
 #include <string>
 #include "Common.h"
+#include "HexCodec.h"
 
 namespace dev
 {
@@ -52,6 +55,11 @@ std::string toHex(Iterator _it, Iterator _end, std::string const& _prefix)
 	size_t off = _prefix.size();
 	std::string hex(std::distance(_it, _end)*2 + off, '0');
 	hex.replace(0, off, _prefix);
+	if constexpr (std::contiguous_iterator<Iterator>)
+	{
+		encodeHex((uint8_t const*)std::to_address(_it), std::distance(_it, _end), hex.data() + off);
+		return hex;
+	}
 	for (; _it != _end; _it++)
 	{
 		hex[off++] = hexdigits[(*_it >> 4) & 0x0f];
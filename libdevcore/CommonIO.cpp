@@ -22,13 +22,18 @@
 #include "CommonIO.h"
 #include "FileSystem.h"
 #include <iostream>
+#include <cerrno>
 #include <cstdlib>
 #include <fstream>
 #include <stdio.h>
 #if defined(_WIN32)
 #include <windows.h>
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <termios.h>
+#include <unistd.h>
 #endif
 #include "Exceptions.h"
 #include <boost/filesystem.hpp>
@@ -88,8 +93,10 @@ string memDump(bytes const& _bytes, unsigned _width, bool _html)
 	return ret.str();
 }
 
+namespace
+{
 template <typename _T>
-inline _T contentsGeneric(boost::filesystem::path const& _file)
+_T contentsStream(boost::filesystem::path const& _file)
 {
 	_T ret;
 	size_t const c_elementSize = sizeof(typename _T::value_type);
@@ -109,6 +116,54 @@ inline _T contentsGeneric(boost::filesystem::path const& _file)
 	return ret;
 }
 
+#if !defined(_WIN32)
+// Smaller files are read with one read() call, mapping them costs more than the copy
+size_t const c_mapThreshold = 64 * 1024;
+
+// Read _size bytes of the opened file into _out, stops early if the file got shorter
+template <typename _T>
+void readOpenedFile(int _fd, size_t _size, _T& _out)
+{
+	size_t const c_elementSize = sizeof(typename _T::value_type);
+	_out.resize((_size + c_elementSize - 1) / c_elementSize);
+	char* const data = reinterpret_cast<char*>(&_out[0]);
+	size_t done = 0;
+	while (done < _size)
+	{
+		ssize_t const n = read(_fd, data + done, _size - done);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			break;
+		done += n;
+	}
+	_out.resize((done + c_elementSize - 1) / c_elementSize);
+}
+#endif
+}  // namespace
+
+template <typename _T>
+inline _T contentsGeneric(boost::filesystem::path const& _file)
+{
+#if !defined(_WIN32)
+	// Regular files skip the stream, their size is known up front
+	int const fd = open(_file.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return _T();
+	struct stat st;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+	{
+		_T ret;
+		if (st.st_size > 0)
+			readOpenedFile(fd, st.st_size, ret);
+		close(fd);
+		return ret;
+	}
+	close(fd);
+#endif
+	return contentsStream<_T>(_file);
+}
+
 bytes contents(boost::filesystem::path const& _file)
 {
 	return contentsGeneric<bytes>(_file);
@@ -127,6 +182,49 @@ string contentsString(boost::filesystem::path const& _file)
 	return contentsGeneric<string>(_file);
 }
 
+MappedFile::MappedFile(boost::filesystem::path const& _file)
+{
+#if !defined(_WIN32)
+	int const fd = open(_file.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd >= 0)
+	{
+		struct stat st;
+		bool const isRegular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+		if (isRegular && size_t(st.st_size) >= c_mapThreshold)
+		{
+			void* const map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (map != MAP_FAILED)
+			{
+				madvise(map, st.st_size, MADV_SEQUENTIAL);
+				m_data = static_cast<char const*>(map);
+				m_size = st.st_size;
+				m_mapped = true;
+			}
+		}
+		else if (isRegular)
+		{
+			readOpenedFile(fd, st.st_size, m_fallback);
+			m_data = m_fallback.data();
+			m_size = m_fallback.size();
+		}
+		close(fd);
+		if (isRegular && (m_mapped || size_t(st.st_size) < c_mapThreshold))
+			return;
+	}
+#endif
+	m_fallback = contentsString(_file);
+	m_data = m_fallback.data();
+	m_size = m_fallback.size();
+}
+
+MappedFile::~MappedFile()
+{
+#if !defined(_WIN32)
+	if (m_mapped)
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
 void writeFileInternal(boost::filesystem::path const& _file, bytesConstRef _data, bool _exec = false)
 {
     createDirectoryIfNotExistent(_file.parent_path());
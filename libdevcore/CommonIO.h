@@ -31,6 +31,7 @@
 #include <vector>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <iosfwd>
 #include <chrono>
 #include "Common.h"
@@ -53,6 +54,27 @@ bytesSec contentsSec(boost::filesystem::path const& _file);
 /// If the file doesn't exist or isn't readable, returns an empty container / bytes.
 std::string contentsString(boost::filesystem::path const& _file);
 
+/// Read-only view of the contents of the given file, memory mapped where possible.
+/// Small files are read into memory instead. If the file doesn't exist or isn't readable, the view is empty.
+class MappedFile
+{
+public:
+	explicit MappedFile(boost::filesystem::path const& _file);
+	~MappedFile();
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator=(MappedFile const&) = delete;
+
+	char const* data() const { return m_data; }
+	size_t size() const { return m_size; }
+	std::string_view view() const { return std::string_view(m_data, m_size); }
+
+private:
+	char const* m_data = nullptr;
+	size_t m_size = 0;
+	bool m_mapped = false;
+	std::string m_fallback;  ///< Contents when the file could not be mapped
+};
+
 /// Write the given binary data into the given file, replacing the file if it pre-exists.
 /// Throws exception on error.
 /// @param _writeDeleteRename useful not to lose any data: If set, first writes to another file in
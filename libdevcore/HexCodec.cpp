@@ -0,0 +1,251 @@
+/*
+	This file is part of cpp-ethereum.
+
+	cpp-ethereum is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	cpp-ethereum is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with cpp-ethereum.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/** @file HexCodec.cpp
+ */
+
+#include "HexCodec.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define DEV_HEX_SSE2 1
+#include <immintrin.h>
+#if defined(__GNUC__)
+#define DEV_HEX_AVX2 1
+#endif
+#endif
+
+namespace
+{
+uint8_t const c_badNibble = 0xff;
+
+struct HexTables
+{
+	uint8_t nibble[256];  // hex character => value, c_badNibble for the rest
+	char digits[512];	  // byte => two lowercase hex characters
+};
+
+constexpr HexTables makeHexTables()
+{
+	HexTables t{};
+	char const* hexdigits = "0123456789abcdef";
+	for (int c = 0; c < 256; c++)
+	{
+		if (c >= '0' && c <= '9')
+			t.nibble[c] = c - '0';
+		else if (c >= 'a' && c <= 'f')
+			t.nibble[c] = c - 'a' + 10;
+		else if (c >= 'A' && c <= 'F')
+			t.nibble[c] = c - 'A' + 10;
+		else
+			t.nibble[c] = c_badNibble;
+		t.digits[c * 2] = hexdigits[c >> 4];
+		t.digits[c * 2 + 1] = hexdigits[c & 0x0f];
+	}
+	return t;
+}
+
+constexpr HexTables c_hexTables = makeHexTables();
+
+void encodeScalar(uint8_t const* _data, size_t _size, char* _out)
+{
+	for (size_t i = 0; i < _size; i++)
+		std::memcpy(_out + i * 2, c_hexTables.digits + _data[i] * 2, 2);
+}
+
+bool decodeScalar(char const* _hex, size_t _size, uint8_t* _out, char* _lowerOut)
+{
+	for (size_t i = 0; i < _size; i++)
+	{
+		char const c = _hex[i];
+		uint8_t const nibble = c_hexTables.nibble[(uint8_t)c];
+		if (nibble == c_badNibble)
+			return false;
+		if (_out && i % 2)
+			_out[i / 2] |= nibble;
+		else if (_out)
+			_out[i / 2] = nibble << 4;
+		if (_lowerOut)
+			_lowerOut[i] = (c >= 'A' && c <= 'F') ? (c | 0x20) : c;
+	}
+	return true;
+}
+
+#ifdef DEV_HEX_SSE2
+// Characters are classified with signed compares, so bytes above 0x7f never pass as hex
+
+__m128i nibblesToAsciiSSE2(__m128i _nibbles)
+{
+	__m128i const letters = _mm_and_si128(_mm_cmpgt_epi8(_nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+	return _mm_add_epi8(_mm_add_epi8(_nibbles, _mm_set1_epi8('0')), letters);
+}
+
+// 16 bytes into 32 characters per step, @returns the number of bytes done
+size_t encodeSSE2(uint8_t const* _data, size_t _size, char* _out)
+{
+	size_t i = 0;
+	for (; i + 16 <= _size; i += 16)
+	{
+		__m128i const bytes = _mm_loadu_si128((__m128i const*)(_data + i));
+		__m128i const hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0f));
+		__m128i const lo = _mm_and_si128(bytes, _mm_set1_epi8(0x0f));
+		_mm_storeu_si128((__m128i*)(_out + i * 2), nibblesToAsciiSSE2(_mm_unpacklo_epi8(hi, lo)));
+		_mm_storeu_si128((__m128i*)(_out + i * 2 + 16), nibblesToAsciiSSE2(_mm_unpackhi_epi8(hi, lo)));
+	}
+	return i;
+}
+
+// 16 characters per step, @returns the number of characters done or _size + 1 on a bad character
+size_t decodeSSE2(char const* _hex, size_t _size, uint8_t* _out, char* _lowerOut)
+{
+	size_t i = 0;
+	for (; i + 16 <= _size; i += 16)
+	{
+		__m128i const chars = _mm_loadu_si128((__m128i const*)(_hex + i));
+		__m128i const lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+		__m128i const digit = _mm_and_si128(
+			_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+		__m128i const letter = _mm_and_si128(
+			_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+		if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xffff)
+			return _size + 1;
+
+		__m128i const normalized = _mm_or_si128(chars, _mm_and_si128(letter, _mm_set1_epi8(0x20)));
+		if (_lowerOut)
+			_mm_storeu_si128((__m128i*)(_lowerOut + i), normalized);
+		if (_out)
+		{
+			__m128i const nibbles = _mm_sub_epi8(_mm_sub_epi8(normalized, _mm_set1_epi8('0')),
+				_mm_and_si128(letter, _mm_set1_epi8('a' - '0' - 10)));
+			// Each 16 bit lane holds the high nibble in its low byte and the low nibble in its high byte
+			__m128i const bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00ff)), 4),
+				_mm_srli_epi16(nibbles, 8));
+			_mm_storel_epi64((__m128i*)(_out + i / 2), _mm_packus_epi16(bytes, bytes));
+		}
+	}
+	return i;
+}
+#endif
+
+#ifdef DEV_HEX_AVX2
+bool hasAVX2()
+{
+	static bool const c_hasAVX2 = __builtin_cpu_supports("avx2");
+	return c_hasAVX2;
+}
+
+__attribute__((target("avx2"))) __m256i nibblesToAsciiAVX2(__m256i _nibbles)
+{
+	__m256i const letters =
+		_mm256_and_si256(_mm256_cmpgt_epi8(_nibbles, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '0' - 10));
+	return _mm256_add_epi8(_mm256_add_epi8(_nibbles, _mm256_set1_epi8('0')), letters);
+}
+
+// 32 bytes into 64 characters per step
+__attribute__((target("avx2"))) size_t encodeAVX2(uint8_t const* _data, size_t _size, char* _out)
+{
+	size_t i = 0;
+	for (; i + 32 <= _size; i += 32)
+	{
+		__m256i const bytes = _mm256_loadu_si256((__m256i const*)(_data + i));
+		__m256i const hi = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0f));
+		__m256i const lo = _mm256_and_si256(bytes, _mm256_set1_epi8(0x0f));
+		// Unpack works inside 128 bit lanes: first holds bytes 0-7 and 16-23, second 8-15 and 24-31
+		__m256i const first = _mm256_unpacklo_epi8(hi, lo);
+		__m256i const second = _mm256_unpackhi_epi8(hi, lo);
+		_mm256_storeu_si256((__m256i*)(_out + i * 2), nibblesToAsciiAVX2(_mm256_permute2x128_si256(first, second, 0x20)));
+		_mm256_storeu_si256(
+			(__m256i*)(_out + i * 2 + 32), nibblesToAsciiAVX2(_mm256_permute2x128_si256(first, second, 0x31)));
+	}
+	return i;
+}
+
+// 32 characters per step
+__attribute__((target("avx2"))) size_t decodeAVX2(char const* _hex, size_t _size, uint8_t* _out, char* _lowerOut)
+{
+	size_t i = 0;
+	for (; i + 32 <= _size; i += 32)
+	{
+		__m256i const chars = _mm256_loadu_si256((__m256i const*)(_hex + i));
+		__m256i const lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+		__m256i const digit = _mm256_and_si256(
+			_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+		__m256i const letter = _mm256_and_si256(
+			_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+		if (_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1)
+			return _size + 1;
+
+		__m256i const normalized = _mm256_or_si256(chars, _mm256_and_si256(letter, _mm256_set1_epi8(0x20)));
+		if (_lowerOut)
+			_mm256_storeu_si256((__m256i*)(_lowerOut + i), normalized);
+		if (_out)
+		{
+			__m256i const nibbles = _mm256_sub_epi8(_mm256_sub_epi8(normalized, _mm256_set1_epi8('0')),
+				_mm256_and_si256(letter, _mm256_set1_epi8('a' - '0' - 10)));
+			__m256i const bytes = _mm256_or_si256(
+				_mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0x00ff)), 4), _mm256_srli_epi16(nibbles, 8));
+			// Pack works inside 128 bit lanes, take the low 8 bytes of each lane
+			__m256i const packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08);
+			_mm_storeu_si128((__m128i*)(_out + i / 2), _mm256_castsi256_si128(packed));
+		}
+	}
+	return i;
+}
+#endif
+}
+
+namespace dev
+{
+
+void encodeHex(uint8_t const* _data, size_t _size, char* _out)
+{
+	size_t done = 0;
+#ifdef DEV_HEX_AVX2
+	if (hasAVX2())
+		done = encodeAVX2(_data, _size, _out);
+#endif
+#ifdef DEV_HEX_SSE2
+	done += encodeSSE2(_data + done, _size - done, _out + done * 2);
+#endif
+	encodeScalar(_data + done, _size - done, _out + done * 2);
+}
+
+bool decodeHex(char const* _hex, size_t _size, uint8_t* _out, char* _lowerOut)
+{
+	if (_out && _size % 2)
+		return false;
+
+	size_t done = 0;
+#ifdef DEV_HEX_AVX2
+	if (hasAVX2())
+	{
+		done = decodeAVX2(_hex, _size, _out, _lowerOut);
+		if (done > _size)
+			return false;
+	}
+#endif
+#ifdef DEV_HEX_SSE2
+	size_t const sse = decodeSSE2(_hex + done, _size - done, _out ? _out + done / 2 : nullptr,
+		_lowerOut ? _lowerOut + done : nullptr);
+	if (sse > _size - done)
+		return false;
+	done += sse;
+#endif
+	return decodeScalar(_hex + done, _size - done, _out ? _out + done / 2 : nullptr,
+		_lowerOut ? _lowerOut + done : nullptr);
+}
+
+}
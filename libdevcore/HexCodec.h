@@ -0,0 +1,45 @@
+/*
+	This file is part of cpp-ethereum.
+
+	cpp-ethereum is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	cpp-ethereum is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with cpp-ethereum.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/** @file HexCodec.h
+ * Block hex encoding and decoding. Uses AVX2 when the cpu has it, SSE2 on other x86-64
+ * and a table lookup everywhere else.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dev
+{
+
+/// Write 2 * _size lowercase hex characters of _data to _out.
+void encodeHex(uint8_t const* _data, size_t _size, char* _out);
+
+/// Validate _size hex characters in one pass and optionally:
+/// decode them into _size / 2 bytes of _out (_size has to be even then),
+/// write their lowercase form into _lowerOut (may be the same memory as _hex).
+/// @returns false if there is a character that is not hex, the outputs are incomplete then.
+bool decodeHex(char const* _hex, size_t _size, uint8_t* _out, char* _lowerOut = nullptr);
+
+/// Lowercase the hex string in place. @returns false if there is a character that is not hex.
+inline bool normalizeHex(char* _hex, size_t _size)
+{
+	return decodeHex(_hex, _size, nullptr, _hex);
+}
+
+}
@@ -75,19 +75,41 @@ RLP::iterator::iterator(RLP const& _parent, bool _begin)
 
 RLP RLP::operator[](size_t _i) const
 {
+	bytesConstRef const pl = payload();
 	if (_i < m_lastIndex)
 	{
-		m_lastEnd = sizeAsEncoded(payload());
-		m_lastItem = payload().cropped(0, m_lastEnd);
+		m_lastEnd = sizeAsEncoded(pl);
+		m_lastItem = pl.cropped(0, m_lastEnd);
 		m_lastIndex = 0;
 	}
 	for (; m_lastIndex < _i && m_lastItem.size(); ++m_lastIndex)
 	{
-		m_lastItem = payload().cropped(m_lastEnd);
+		m_lastItem = pl.cropped(m_lastEnd);
 		m_lastItem = m_lastItem.cropped(0, sizeAsEncoded(m_lastItem));
 		m_lastEnd += m_lastItem.size();
 	}
-	return RLP(m_lastItem, ThrowOnFail | FailIfTooSmall);
+	// The item is cropped to its encoded size already, no need to check it again
+	return RLP(m_lastItem, 0);
+}
+
+size_t RLP::sizeAsEncoded(bytesConstRef _data)
+{
+	size_t const size = RLP(_data, 0).actualSize();
+	if (size > _data.size())
+		BOOST_THROW_EXCEPTION(UndersizeRLP());
+	return size;
+}
+
+RLPList::RLPList(RLP const& _rlp)
+{
+	if (!_rlp.isList())
+		return;
+	for (bytesConstRef d = _rlp.payload(); d.size();)
+	{
+		size_t const size = RLP::sizeAsEncoded(d);
+		m_items.push_back(d.cropped(0, size));
+		d = d.cropped(size);
+	}
 }
 
 RLPs RLP::toList(int _flags) const
@@ -241,14 +263,22 @@ void RLPStream::noteAppended(size_t _itemCount)
 //	cdebug << "noteAppended(" << _itemCount << ")";
 	while (m_listStack.size())
 	{
-		if (m_listStack.back().first < _itemCount)
-			BOOST_THROW_EXCEPTION(RLPException() << errinfo_comment("itemCount too large") << RequirementError((bigint)m_listStack.back().first, (bigint)_itemCount));
-		m_listStack.back().first -= _itemCount;
-		if (m_listStack.back().first)
+		if (m_listStack.back().items < _itemCount)
+			BOOST_THROW_EXCEPTION(RLPException() << errinfo_comment("itemCount too large") << RequirementError((bigint)m_listStack.back().items, (bigint)_itemCount));
+		m_listStack.back().items -= _itemCount;
+		if (m_listStack.back().items)
 			break;
+		else if (m_listStack.back().payloadSize != c_unknownSize)
+		{
+			// The header is in place already
+			ListFrame const frame = m_listStack.back();
+			m_listStack.pop_back();
+			if (m_out.size() - frame.begin != frame.payloadSize)
+				BOOST_THROW_EXCEPTION(RLPException() << errinfo_comment("list payload differs from the precomputed size") << RequirementError((bigint)frame.payloadSize, (bigint)(m_out.size() - frame.begin)));
+		}
 		else
 		{
-			auto p = m_listStack.back().second;
+			auto p = m_listStack.back().begin;
 			m_listStack.pop_back();
 			size_t s = m_out.size() - p;		// list size
 			auto brs = bytesRequired(s);
@@ -277,22 +307,41 @@ RLPStream& RLPStream::appendList(size_t _items)
 {
 //	cdebug << "appendList(" << _items << ")";
 	if (_items)
-		m_listStack.push_back(std::make_pair(_items, m_out.size()));
+		m_listStack.push_back({_items, m_out.size(), c_unknownSize});
 	else
 		appendList(bytes());
 	return *this;
 }
 
+RLPStream& RLPStream::appendList(size_t _items, size_t _payloadSize)
+{
+	if (!_items)
+	{
+		if (_payloadSize)
+			BOOST_THROW_EXCEPTION(RLPException() << errinfo_comment("empty list with non empty payload"));
+		return appendList(bytes());
+	}
+	pushListHeader(_payloadSize);
+	m_out.reserve(m_out.size() + _payloadSize);
+	m_listStack.push_back({_items, m_out.size(), _payloadSize});
+	return *this;
+}
+
 RLPStream& RLPStream::appendList(bytesConstRef _rlp)
 {
-	if (_rlp.size() < c_rlpListImmLenCount)
-		m_out.push_back((byte)(_rlp.size() + c_rlpListStart));
-	else
-		pushCount(_rlp.size(), c_rlpListIndLenZero);
+	pushListHeader(_rlp.size());
 	appendRaw(_rlp, 1);
 	return *this;
 }
 
+void RLPStream::pushListHeader(size_t _payloadSize)
+{
+	if (_payloadSize < c_rlpListImmLenCount)
+		m_out.push_back((byte)(_payloadSize + c_rlpListStart));
+	else
+		pushCount(_payloadSize, c_rlpListIndLenZero);
+}
+
 RLPStream& RLPStream::append(bytesConstRef _s, bool _compact)
 {
 	size_t s = _s.size();
@@ -28,6 +28,7 @@
 #include <exception>
 #include <iosfwd>
 #include <iomanip>
+#include <boost/container/small_vector.hpp>
 #include "vector_ref.h"
 #include "Exceptions.h"
 #include "FixedHash.h"
@@ -62,6 +63,8 @@ template <class T> struct Converter { static T convert(RLP const&, int) { BOOST_
  */
 class RLP
 {
+	friend class RLPList;
+
 public:
 	/// Conversion flags
 	enum
@@ -354,7 +357,7 @@ private:
 	size_t items() const;
 
 	/// @returns the size encoded into the RLP in @a _data and throws if _data is too short.
-	static size_t sizeAsEncoded(bytesConstRef _data) { return RLP(_data, ThrowOnFail | FailIfTooSmall).actualSize(); }
+	static size_t sizeAsEncoded(bytesConstRef _data);
 
 	/// Our byte data.
 	bytesConstRef m_data;
@@ -365,6 +368,27 @@ private:
 	mutable bytesConstRef m_lastItem;
 };
 
+/**
+ * @brief Items of an RLP list, located in one pass over the list.
+ * Access by index in any order does not walk the list again and does not re-validate the items.
+ */
+class RLPList
+{
+public:
+	/// Index the items of @a _rlp. Data or null RLP has no items, as in RLP::itemCount().
+	explicit RLPList(RLP const& _rlp);
+
+	/// @returns the number of items in the list.
+	size_t size() const { return m_items.size(); }
+
+	/// @returns the list item @a _i, or RLP() if @a _i is out of range.
+	RLP operator[](size_t _i) const { return _i < m_items.size() ? RLP(m_items[_i], 0) : RLP(); }
+
+private:
+	/// Block headers have up to 20 items, transactions up to 14.
+	boost::container::small_vector<bytesConstRef, 24> m_items;
+};
+
 template <> struct Converter<std::string> { static std::string convert(RLP const& _r, int _flags) { return _r.toString(_flags); } };
 template <> struct Converter<bytes> { static bytes convert(RLP const& _r, int _flags) { return _r.toBytes(_flags); } };
 template <> struct Converter<RLPs> { static RLPs convert(RLP const& _r, int _flags) { return _r.toList(_flags); } };
@@ -396,7 +420,8 @@ public:
 	/// Initializes the RLPStream as a list of @a _listItems items.
 	explicit RLPStream(size_t _listItems) { appendList(_listItems); }
 
-	~RLPStream() {}
+	/// Initializes empty RLPStream writing into @a _buffer. Its content is dropped, its capacity is reused.
+	explicit RLPStream(bytes&& _buffer): m_out(std::move(_buffer)) { m_out.clear(); }
 
 	/// Append given datum to the byte stream.
 	RLPStream& append(unsigned _s) { return append(bigint(_s)); }
@@ -422,6 +447,9 @@ public:
 
 	/// Appends a list.
 	RLPStream& appendList(size_t _items);
+	/// Appends a list of @a _items items which take @a _payloadSize bytes when encoded.
+	/// The header is written right away, so completing the list does not move its payload.
+	RLPStream& appendList(size_t _items, size_t _payloadSize);
 	RLPStream& appendList(bytesConstRef _rlp);
 	RLPStream& appendList(bytes const& _rlp) { return appendList(&_rlp); }
 	RLPStream& appendList(RLPStream const& _s) { return appendList(&_s.out()); }
@@ -433,9 +461,15 @@ public:
 	/// Shift operators for appending data items.
 	template <class T> RLPStream& operator<<(T _data) { return append(_data); }
 
-	/// Clear the output stream so far.
+	/// Clear the output stream so far. The allocated buffer is kept for the next items.
 	void clear() { m_out.clear(); m_listStack.clear(); }
 
+	/// Reserve the buffer for @a _size bytes of output.
+	void reserve(size_t _size) { m_out.reserve(_size); }
+
+	/// @returns the size of the list header and the list payload of @a _payloadSize bytes.
+	static size_t listSize(size_t _payloadSize) { return _payloadSize + (_payloadSize < c_rlpListImmLenCount ? 1 : 1 + bytesRequired(_payloadSize)); }
+
 	/// Read the byte stream.
 	bytes const& out() const { if(!m_listStack.empty()) BOOST_THROW_EXCEPTION(RLPException() << errinfo_comment("listStack is not empty")); return m_out; }
 
@@ -461,10 +495,21 @@ private:
 			*(b--) = (byte)_i;
 	}
 
+	/// Push the header of the list with @a _payloadSize bytes of payload.
+	void pushListHeader(size_t _payloadSize);
+
+	struct ListFrame
+	{
+		size_t items;		 ///< Items left to complete the list.
+		size_t begin;		 ///< Position of the payload in m_out.
+		size_t payloadSize;	 ///< Precomputed payload size, c_unknownSize if the header is written on completion.
+	};
+	static size_t const c_unknownSize = (size_t)-1;
+
 	/// Our output byte stream.
 	bytes m_out;
 
-	std::vector<std::pair<size_t, size_t>> m_listStack;
+	std::vector<ListFrame> m_listStack;
 };
 
 template <class _T> void rlpListAux(RLPStream& _out, _T _t) { _out << _t; }
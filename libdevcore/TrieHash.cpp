@@ -0,0 +1,165 @@
+/*
+	This file is part of cpp-ethereum.
+
+	cpp-ethereum is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	cpp-ethereum is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with cpp-ethereum.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/** @file TrieHash.cpp
+ */
+
+#include "TrieHash.h"
+#include "RLP.h"
+#include "SHA3.h"
+#include <algorithm>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+struct TrieItem
+{
+	bytes key;  // nibbles
+	bytesConstRef value;
+};
+using TrieItems = vector<TrieItem>;
+using TrieIt = TrieItems::const_iterator;
+
+bytes keyNibbles(bytes const& _key)
+{
+	bytes ret;
+	ret.reserve(_key.size() * 2);
+	for (auto const b : _key)
+	{
+		ret.push_back(b >> 4);
+		ret.push_back(b & 0x0f);
+	}
+	return ret;
+}
+
+// Compact encoding of the nibbles [_begin, _end) of the key with the leaf/extension flag
+bytes hexPrefixEncode(bytes const& _key, bool _leaf, size_t _begin, size_t _end)
+{
+	size_t const size = _end - _begin;
+	bool const odd = size % 2;
+	bytes ret;
+	ret.reserve(size / 2 + 1);
+	ret.push_back((_leaf ? 0x20 : 0x00) | (odd ? (0x10 | _key[_begin]) : 0x00));
+	for (size_t i = _begin + (odd ? 1 : 0); i < _end; i += 2)
+		ret.push_back((_key[i] << 4) | _key[i + 1]);
+	return ret;
+}
+
+void trieNodeRlp(TrieIt _begin, TrieIt _end, size_t _preLen, RLPStream& _rlp);
+
+// Append the node of the items to the parent node: inline if its rlp is shorter than a hash
+void trieNodeRef(TrieIt _begin, TrieIt _end, size_t _preLen, RLPStream& _rlp)
+{
+	RLPStream node;
+	trieNodeRlp(_begin, _end, _preLen, node);
+	if (node.out().size() < 32)
+		_rlp.appendRaw(node.out());
+	else
+		_rlp << sha3(node.out());
+}
+
+// Items are sorted by key and share the first _preLen nibbles
+void trieNodeRlp(TrieIt _begin, TrieIt _end, size_t _preLen, RLPStream& _rlp)
+{
+	if (_begin == _end)
+	{
+		_rlp << bytesConstRef();
+		return;
+	}
+
+	if (next(_begin) == _end)
+	{
+		_rlp.appendList(2);
+		_rlp << hexPrefixEncode(_begin->key, true, _preLen, _begin->key.size());
+		_rlp << _begin->value;
+		return;
+	}
+
+	// Sorted keys share the prefix of the first and the last key
+	bytes const& first = _begin->key;
+	bytes const& last = prev(_end)->key;
+	size_t const maxShared = min(first.size(), last.size());
+	size_t shared = _preLen;
+	while (shared < maxShared && first[shared] == last[shared])
+		shared++;
+
+	if (shared > _preLen)
+	{
+		// Extension node
+		_rlp.appendList(2);
+		_rlp << hexPrefixEncode(first, false, _preLen, shared);
+		trieNodeRef(_begin, _end, shared, _rlp);
+		return;
+	}
+
+	// Branch node, a key that ends here is the value of the branch and goes first in the order
+	_rlp.appendList(17);
+	TrieIt it = _begin;
+	bool const hasValue = _begin->key.size() == _preLen;
+	if (hasValue)
+		++it;
+	for (uint8_t nibble = 0; nibble < 16; nibble++)
+	{
+		TrieIt childEnd = it;
+		while (childEnd != _end && childEnd->key[_preLen] == nibble)
+			++childEnd;
+		if (childEnd == it)
+			_rlp << bytesConstRef();
+		else
+			trieNodeRef(it, childEnd, _preLen + 1, _rlp);
+		it = childEnd;
+	}
+	if (hasValue)
+		_rlp << _begin->value;
+	else
+		_rlp << bytesConstRef();
+}
+
+h256 trieRootOf(TrieItems& _items)
+{
+	sort(_items.begin(), _items.end(), [](TrieItem const& _a, TrieItem const& _b) { return _a.key < _b.key; });
+	RLPStream root;
+	trieNodeRlp(_items.cbegin(), _items.cend(), 0, root);
+	return sha3(root.out());
+}
+}
+
+namespace dev
+{
+
+h256 trieRoot(vector<pair<bytes, bytes>> const& _items)
+{
+	TrieItems items;
+	items.reserve(_items.size());
+	for (auto const& item : _items)
+		items.push_back({keyNibbles(item.first), bytesConstRef(&item.second)});
+	return trieRootOf(items);
+}
+
+h256 orderedTrieRoot(vector<bytes> const& _data)
+{
+	TrieItems items;
+	items.reserve(_data.size());
+	for (size_t i = 0; i < _data.size(); i++)
+	{
+		items.push_back({keyNibbles(rlp(i)), bytesConstRef(&_data[i])});
+	}
+	return trieRootOf(items);
+}
+
+}
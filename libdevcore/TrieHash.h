@@ -0,0 +1,36 @@
+/*
+	This file is part of cpp-ethereum.
+
+	cpp-ethereum is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	cpp-ethereum is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with cpp-ethereum.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/** @file TrieHash.h
+ * Root hash of a Merkle Patricia trie, built in memory from all of its items at once.
+ */
+
+#pragma once
+
+#include "Common.h"
+#include "FixedHash.h"
+
+namespace dev
+{
+
+/// Root of the trie of the given (key, value) items. Keys have to be unique, values are not empty.
+/// The trie nodes are not stored, only hashed while walking the sorted keys once.
+h256 trieRoot(std::vector<std::pair<bytes, bytes>> const& _items);
+
+/// Root of the trie of rlp(index) => _data[index]. Transactions, receipts and withdrawals tries
+h256 orderedTrieRoot(std::vector<bytes> const& _data);
+
+}
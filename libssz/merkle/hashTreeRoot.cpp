@@ -0,0 +1,67 @@
+#include "hashTreeRoot.h"
+#include <stdexcept>
+using namespace std;
+using namespace ssz::merkle;
+
+namespace
+{
+size_t const c_bitsPerChunk = 256;
+size_t const c_bytesPerChunk = 32;
+}  // namespace
+
+namespace ssz
+{
+Bytes32 hashTreeRoot(bool _value)
+{
+    Bytes32 chunk{};
+    chunk[0] = _value ? 1 : 0;
+    return chunk;
+}
+
+Bytes32 hashTreeRoot(uint const& _value)
+{
+    return merkleize(pack(_value.data));
+}
+
+Bytes32 hashTreeRoot(BitVector const& _value)
+{
+    return merkleize(packBits(_value), (_value.size() + c_bitsPerChunk - 1) / c_bitsPerChunk);
+}
+
+Bytes32 hashTreeRoot(BitList const& _value, size_t _limit)
+{
+    if (_value.size() > _limit)
+        throw std::invalid_argument("Bitlist of " + to_string(_value.size()) + " bits is over the limit of " + to_string(_limit));
+    size_t const chunkLimit = (_limit + c_bitsPerChunk - 1) / c_bitsPerChunk;
+    return mixInLength(merkleize(packBits(_value), chunkLimit), _value.size());
+}
+
+Bytes32 hashTreeRootBasicVector(bytes const& _serialized)
+{
+    return merkleize(pack(_serialized));
+}
+
+Bytes32 hashTreeRootBasicList(bytes const& _serialized, size_t _elementSize, size_t _limit)
+{
+    if (_elementSize == 0 || _serialized.size() % _elementSize)
+        throw std::invalid_argument("List of basic type has " + to_string(_serialized.size()) +
+                                    " bytes, which is not a multiple of element size " + to_string(_elementSize));
+    size_t const length = _serialized.size() / _elementSize;
+    if (length > _limit)
+        throw std::invalid_argument("List of " + to_string(length) + " elements is over the limit of " + to_string(_limit));
+    size_t const chunkLimit = (_limit * _elementSize + c_bytesPerChunk - 1) / c_bytesPerChunk;
+    return mixInLength(merkleize(pack(_serialized), chunkLimit), length);
+}
+
+Bytes32 hashTreeRootContainer(Chunks _roots)
+{
+    return merkleize(std::move(_roots));
+}
+
+Bytes32 hashTreeRootList(Chunks _roots, size_t _limit)
+{
+    size_t const length = _roots.size();
+    return mixInLength(merkleize(std::move(_roots), _limit), length);
+}
+
+}  // namespace ssz
@@ -0,0 +1,22 @@
+#pragma once
+#include "merkle.h"
+#include "../types/uints.h"
+
+namespace ssz
+{
+// hash_tree_root of the SSZ types
+Bytes32 hashTreeRoot(bool _value);
+Bytes32 hashTreeRoot(uint const& _value);
+Bytes32 hashTreeRoot(BitVector const& _value);
+Bytes32 hashTreeRoot(BitList const& _value, size_t _limit);
+
+// Vector or List[_limit] of basic type elements of _elementSize bytes, given serialized
+Bytes32 hashTreeRootBasicVector(bytes const& _serialized);
+Bytes32 hashTreeRootBasicList(bytes const& _serialized, size_t _elementSize, size_t _limit);
+
+// Container or Vector of composite type, given the roots of its fields or elements
+Bytes32 hashTreeRootContainer(merkle::Chunks _roots);
+// List[_limit] of composite type, given the roots of its elements
+Bytes32 hashTreeRootList(merkle::Chunks _roots, size_t _limit);
+
+}  // namespace ssz
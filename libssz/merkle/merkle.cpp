@@ -0,0 +1,160 @@
+#include "merkle.h"
+#include "sha256.h"
+#include <cstring>
+#include <stdexcept>
+using namespace std;
+
+namespace
+{
+using namespace ssz;
+using namespace ssz::merkle;
+static_assert(sizeof(Bytes32) == 32, "chunks of a layer are hashed as one contiguous buffer");
+
+size_t const c_maxDepth = 64;
+
+size_t depthOf(size_t _limit)
+{
+    size_t depth = 0;
+    while (depth < c_maxDepth && (size_t(1) << depth) < _limit)
+        depth++;
+    return depth;
+}
+
+Bytes32 hashPair(Bytes32 const& _left, Bytes32 const& _right)
+{
+    ssz::byte block[64];
+    memcpy(block, _left.data(), 32);
+    memcpy(block + 32, _right.data(), 32);
+    Bytes32 out;
+    sha256Pairs(block, out.data(), 1);
+    return out;
+}
+
+// Parents of the nodes of _layer at _depth, the missing right node is a zero subtree
+Chunks parentLayer(Chunks const& _layer, size_t _depth)
+{
+    Chunks parents((_layer.size() + 1) / 2);
+    if (_layer.size() >= 2)
+        sha256Pairs(_layer[0].data(), parents[0].data(), _layer.size() / 2);
+    if (_layer.size() % 2)
+        parents.back() = hashPair(_layer.back(), zeroHash(_depth));
+    return parents;
+}
+
+void checkLimit(size_t _size, size_t _limit)
+{
+    if (_size > _limit)
+        throw std::invalid_argument("merkleize got " + to_string(_size) + " chunks over the limit of " + to_string(_limit));
+}
+
+Chunks packBytes(bytes const& _data)
+{
+    Chunks out((_data.size() + 31) / 32, Bytes32{});
+    if (!_data.empty())
+        memcpy(out.front().data(), _data.data(), _data.size());
+    return out;
+}
+
+template <class T>
+Chunks packBitfield(T const& _bits)
+{
+    bytes data((_bits.size() + 7) / BITS_PER_BYTE, 0);
+    size_t i = 0;
+    for (auto const& el : _bits)
+    {
+        if (el)
+            data[i / BITS_PER_BYTE] |= (1 << (i % BITS_PER_BYTE));
+        i++;
+    }
+    return packBytes(data);
+}
+}  // namespace
+
+namespace ssz::merkle
+{
+Bytes32 const& zeroHash(size_t _depth)
+{
+    static Chunks const c_zeroHashes = []() {
+        Chunks hashes(c_maxDepth + 1, Bytes32{});
+        for (size_t i = 1; i < hashes.size(); i++)
+            hashes[i] = hashPair(hashes[i - 1], hashes[i - 1]);
+        return hashes;
+    }();
+    return c_zeroHashes.at(_depth);
+}
+
+Chunks pack(bytes const& _serialized)
+{
+    return packBytes(_serialized);
+}
+
+Chunks packBits(BitVector const& _bits)
+{
+    return packBitfield(_bits);
+}
+
+Chunks packBits(BitList const& _bits)
+{
+    return packBitfield(_bits);
+}
+
+Bytes32 merkleize(Chunks _chunks, size_t _limit)
+{
+    checkLimit(_chunks.size(), _limit);
+    size_t const depth = depthOf(_limit);
+    if (_chunks.empty())
+        return zeroHash(depth);
+    for (size_t d = 0; d < depth; d++)
+        _chunks = parentLayer(_chunks, d);
+    return _chunks.at(0);
+}
+
+Bytes32 mixInLength(Bytes32 const& _root, size_t _length)
+{
+    Bytes32 length{};
+    for (size_t i = 0; i < sizeof(size_t); i++)
+        length[i] = byte(uint64_t(_length) >> (BITS_PER_BYTE * i));
+    return hashPair(_root, length);
+}
+
+MerkleTree::MerkleTree(Chunks _chunks, size_t _limit) : m_limit(_limit), m_depth(depthOf(_limit))
+{
+    checkLimit(_chunks.size(), _limit);
+    m_layers.reserve(m_depth + 1);
+    m_layers.emplace_back(std::move(_chunks));
+    for (size_t d = 0; d < m_depth; d++)
+        m_layers.emplace_back(parentLayer(m_layers.back(), d));
+    m_root = m_layers.back().empty() ? zeroHash(m_depth) : m_layers.back().at(0);
+}
+
+void MerkleTree::setChunk(size_t _index, Bytes32 const& _chunk)
+{
+    if (_index >= size())
+        throw std::out_of_range("MerkleTree::setChunk index " + to_string(_index) + " is out of " + to_string(size()));
+    m_layers[0][_index] = _chunk;
+    updatePath(_index);
+}
+
+void MerkleTree::pushChunk(Bytes32 const& _chunk)
+{
+    checkLimit(size() + 1, m_limit);
+    m_layers[0].push_back(_chunk);
+    for (size_t d = 0; d < m_depth; d++)
+        m_layers[d + 1].resize((m_layers[d].size() + 1) / 2);
+    updatePath(size() - 1);
+}
+
+void MerkleTree::updatePath(size_t _index)
+{
+    for (size_t d = 0; d < m_depth; d++)
+    {
+        size_t const parent = _index / 2;
+        Chunks const& layer = m_layers[d];
+        Bytes32 const& right = parent * 2 + 1 < layer.size() ? layer[parent * 2 + 1] : zeroHash(d);
+        m_layers[d + 1][parent] = hashPair(layer[parent * 2], right);
+        _index = parent;
+    }
+    m_root = m_layers[m_depth].at(0);
+}
+
+}  // namespace ssz::merkle
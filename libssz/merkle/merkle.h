@@ -0,0 +1,55 @@
+#pragma once
+#include "../types/basic.h"
+#include "../types/lists.h"
+#include "../types/vectors.h"
+
+namespace ssz::merkle
+{
+using Chunks = std::vector<Bytes32>;
+
+// Root of the tree of 2^_depth zero chunks
+Bytes32 const& zeroHash(size_t _depth);
+
+// Serialized basic values right-padded into 32 byte chunks
+Chunks pack(bytes const& _serialized);
+
+// Bits of a bitfield packed into chunks, without the length bit of a bitlist
+Chunks packBits(BitVector const& _bits);
+Chunks packBits(BitList const& _bits);
+
+// Root of the tree with _chunks and zero chunks up to the next power of two of _limit
+// Hashed on the calling thread, callers hashing many trees run them in parallel themselves
+Bytes32 merkleize(Chunks _chunks, size_t _limit);
+inline Bytes32 merkleize(Chunks _chunks)
+{
+    size_t const limit = _chunks.size();
+    return merkleize(std::move(_chunks), limit);
+}
+
+Bytes32 mixInLength(Bytes32 const& _root, size_t _length);
+
+// Merkle tree which keeps its inner nodes, so changing a chunk rehashes
+// only the path to the root. Zero subtrees are not stored.
+class MerkleTree
+{
+public:
+    MerkleTree(Chunks _chunks, size_t _limit);
+
+    Bytes32 const& root() const { return m_root; }
+    size_t size() const { return m_layers.at(0).size(); }
+
+    void setChunk(size_t _index, Bytes32 const& _chunk);
+    // Append the chunk after the last one, the tree has to stay within the limit
+    void pushChunk(Bytes32 const& _chunk);
+
+private:
+    void updatePath(size_t _index);
+
+    // Layer 0 holds the chunks, every next layer the parents of the previous one
+    std::vector<Chunks> m_layers;
+    size_t m_limit;
+    size_t m_depth;
+    Bytes32 m_root;
+};
+
+}  // namespace ssz::merkle
@@ -0,0 +1,148 @@
+#include "sha256.h"
+#include <cstring>
+
+namespace
+{
+using namespace ssz;
+
+constexpr uint32_t c_k[64] = {0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+    0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152,
+    0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138,
+    0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70,
+    0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa,
+    0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+constexpr uint32_t c_init[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+constexpr uint32_t rotr(uint32_t _x, int _n)
+{
+    return (_x >> _n) | (_x << (32 - _n));
+}
+
+constexpr void expandSchedule(uint32_t* _w)
+{
+    for (size_t i = 16; i < 64; i++)
+    {
+        uint32_t const s0 = rotr(_w[i - 15], 7) ^ rotr(_w[i - 15], 18) ^ (_w[i - 15] >> 3);
+        uint32_t const s1 = rotr(_w[i - 2], 17) ^ rotr(_w[i - 2], 19) ^ (_w[i - 2] >> 10);
+        _w[i] = _w[i - 16] + s0 + _w[i - 7] + s1;
+    }
+}
+
+struct Schedule
+{
+    uint32_t w[64];
+};
+
+// Padding block of a 64 byte message: 0x80, zeros and the length of 512 bits
+constexpr Schedule makePaddingSchedule()
+{
+    Schedule s{};
+    s.w[0] = 0x80000000;
+    s.w[15] = 512;
+    expandSchedule(s.w);
+    return s;
+}
+constexpr Schedule c_paddingSchedule = makePaddingSchedule();
+
+void loadBlock(byte const* _block, uint32_t* _w)
+{
+    for (size_t i = 0; i < 16; i++)
+        _w[i] = (uint32_t(_block[i * 4]) << 24) | (uint32_t(_block[i * 4 + 1]) << 16) |
+                (uint32_t(_block[i * 4 + 2]) << 8) | uint32_t(_block[i * 4 + 3]);
+    expandSchedule(_w);
+}
+
+void compress(uint32_t* _state, uint32_t const* _w)
+{
+    uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3];
+    uint32_t e = _state[4], f = _state[5], g = _state[6], h = _state[7];
+    for (size_t i = 0; i < 64; i++)
+    {
+        uint32_t const t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + c_k[i] + _w[i];
+        uint32_t const t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    _state[0] += a;
+    _state[1] += b;
+    _state[2] += c;
+    _state[3] += d;
+    _state[4] += e;
+    _state[5] += f;
+    _state[6] += g;
+    _state[7] += h;
+}
+
+void storeState(uint32_t const* _state, byte* _out)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        _out[i * 4] = byte(_state[i] >> 24);
+        _out[i * 4 + 1] = byte(_state[i] >> 16);
+        _out[i * 4 + 2] = byte(_state[i] >> 8);
+        _out[i * 4 + 3] = byte(_state[i]);
+    }
+}
+}  // namespace
+
+namespace ssz::merkle
+{
+Bytes32 sha256(byte const* _data, size_t _size)
+{
+    uint32_t state[8];
+    std::memcpy(state, c_init, sizeof(state));
+    uint32_t w[64];
+
+    size_t done = 0;
+    for (; done + 64 <= _size; done += 64)
+    {
+        loadBlock(_data + done, w);
+        compress(state, w);
+    }
+
+    // The tail, 0x80 and the bit length take one or two more blocks
+    byte tail[128] = {};
+    size_t const rest = _size - done;
+    if (rest)
+        std::memcpy(tail, _data + done, rest);
+    tail[rest] = 0x80;
+    size_t const tailSize = rest < 56 ? 64 : 128;
+    uint64_t const bits = uint64_t(_size) * 8;
+    for (size_t i = 0; i < 8; i++)
+        tail[tailSize - 1 - i] = byte(bits >> (i * 8));
+    for (size_t i = 0; i < tailSize; i += 64)
+    {
+        loadBlock(tail + i, w);
+        compress(state, w);
+    }
+
+    Bytes32 out;
+    storeState(state, out.data());
+    return out;
+}
+
+void sha256Pairs(byte const* _in, byte* _out, size_t _count)
+{
+    uint32_t w[64];
+    for (size_t i = 0; i < _count; i++)
+    {
+        uint32_t state[8];
+        std::memcpy(state, c_init, sizeof(state));
+        loadBlock(_in + i * 64, w);
+        compress(state, w);
+        compress(state, c_paddingSchedule.w);
+        storeState(state, _out + i * 32);
+    }
+}
+
+}  // namespace ssz::merkle
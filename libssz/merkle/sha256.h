@@ -0,0 +1,18 @@
+#pragma once
+#include "../types/basic.h"
+
+namespace ssz::merkle
+{
+// SHA-256 of _size bytes of _data
+Bytes32 sha256(byte const* _data, size_t _size);
+inline Bytes32 sha256(bytes const& _data)
+{
+    return sha256(_data.data(), _data.size());
+}
+
+// SHA-256 of _count independent 64 byte blocks of _in into _count chunks of _out.
+// _out may be the same memory as _in. The padding block of a 64 byte message is constant,
+// so its message schedule is computed once and every pair takes two compressions
+void sha256Pairs(byte const* _in, byte* _out, size_t _count);
+
+}  // namespace ssz::merkle
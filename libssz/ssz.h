@@ -1,5 +1,8 @@
 #pragma once
 #include "libdataobj/DataObject.h"
+#include "merkle/hashTreeRoot.h"
+#include "merkle/sha256.h"
+#include "types/containers.h"
 #include "types/lists.h"
 #include "types/uints.h"
 #include "types/vectors.h"
@@ -12,8 +15,7 @@ public:
     template <encoding::Integral T>
     SSZStream& operator<<(T const& _value)
     {
-        m_out = encoding::integralToBytes(_value);
-        return *this;
+        return *this << encoding::integralToBytes(_value);
     }
     SSZStream& operator<<(uint const& _value)
     {
@@ -23,6 +25,7 @@ public:
     SSZStream& operator<<(BitVector const& _value);
     SSZStream& operator<<(bytes const& _value);
     SSZStream& operator<<(BitList const& _value);
+    SSZStream& operator<<(Container const& _value);
 
     bytes const& data() const { return m_out; }
 
@@ -1,4 +1,5 @@
 #include "basic.h"
+#include <algorithm>
 #include <stdexcept>
 using namespace ssz;
 
@@ -0,0 +1,64 @@
+#include "containers.h"
+#include "../ssz.h"
+#include <stdexcept>
+using namespace std;
+using namespace ssz::encoding;
+
+namespace
+{
+size_t const c_offsetSize = 4;
+}
+
+namespace ssz
+{
+Container& Container::addFixed(bytes _field)
+{
+    m_fields.push_back({std::move(_field), false});
+    return *this;
+}
+
+Container& Container::addVariable(bytes _field)
+{
+    m_fields.push_back({std::move(_field), true});
+    return *this;
+}
+
+bytes Container::encode() const
+{
+    size_t fixedSize = 0;
+    size_t variableSize = 0;
+    for (auto const& field : m_fields)
+    {
+        fixedSize += field.variable ? c_offsetSize : field.data.size();
+        variableSize += field.variable ? field.data.size() : 0;
+    }
+    if (fixedSize + variableSize > UINT32_MAX)
+        throw std::invalid_argument("Container encoding of " + to_string(fixedSize + variableSize) +
+                                    " bytes does not fit into 4 byte offsets");
+
+    bytes out;
+    out.reserve(fixedSize + variableSize);
+    uint32_t offset = fixedSize;
+    for (auto const& field : m_fields)
+    {
+        if (field.variable)
+        {
+            bytes const encodedOffset = integralToBytes(offset);
+            out.insert(out.end(), encodedOffset.begin(), encodedOffset.end());
+            offset += field.data.size();
+        }
+        else
+            out.insert(out.end(), field.data.begin(), field.data.end());
+    }
+    for (auto const& field : m_fields)
+        if (field.variable)
+            out.insert(out.end(), field.data.begin(), field.data.end());
+    return out;
+}
+
+SSZStream& SSZStream::operator<<(Container const& _value)
+{
+    return *this << _value.encode();
+}
+
+}  // namespace ssz
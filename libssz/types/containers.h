@@ -0,0 +1,26 @@
+#pragma once
+#include "basic.h"
+
+namespace ssz
+{
+// Serialized fields of a container, or elements of a vector or list of variable size type.
+// Fixed size fields are encoded in place, variable size fields by 4 byte offsets
+// into the part which follows the fixed one.
+class Container
+{
+public:
+    Container& addFixed(bytes _field);
+    Container& addVariable(bytes _field);
+
+    bytes encode() const;
+
+private:
+    struct Field
+    {
+        bytes data;
+        bool variable;
+    };
+    std::vector<Field> m_fields;
+};
+
+}  // namespace ssz
@@ -1,5 +1,4 @@
 #include "uints.h"
-#include <cmath>
 #include <stdexcept>
 using namespace std;
 using namespace ssz;
@@ -23,7 +22,8 @@ ssz::uint::uint(uint64_t _data, size_t _size) : m_size(_size)
 {
     if (_size > 8)
         throw std::invalid_argument("uint(uint64_t _data, size_t _size) got _size > 8");
-    const uint64_t max = pow(2, 8 * _size) - 1;
+    // pow(2, 64) - 1 rounds up to 2^64 as a double
+    const uint64_t max = _size == 8 ? UINT64_MAX : (uint64_t(1) << (8 * _size)) - 1;
     if (_data > max)
         throw std::invalid_argument("Input string is too long for a " + to_string(_size * 8) +
                                     "-bit unsigned integer \n"
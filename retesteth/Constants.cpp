@@ -21,6 +21,17 @@ const FH256 C_FH256_ZERO(
     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
     "0000000000000000000000000000000000000000000000000000000000");
 
+const FORK C_FORK_LONDON("London");
+const FORK C_FORK_MERGE("Merge");
+const FORK C_FORK_SHANGHAI("Shanghai");
+const FORK C_FORK_CANCUN("Cancun");
+const FORK C_FORK_ARROWGLACIER("ArrowGlacier");
+const FORK C_FORK_HOMESTEADTODAOAT5("HomesteadToDaoAt5");
+const FORK C_FORK_BERLINTOLONDONAT5("BerlinToLondonAt5");
+const FORK C_FORK_ARROWGLACIERTOMERGEATDIFFC0000("ArrowGlacierToMergeAtDiffC0000");
+const FORK C_FORK_MERGETOSHANGHAIATTIME15K("MergeToShanghaiAtTime15k");
+const FORK C_FORK_SHANGHAITOCANCUNATTIME15K("ShanghaiToCancunAtTime15k");
+
 namespace constnames {
 
 const string c_author = "author";
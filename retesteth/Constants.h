@@ -16,6 +16,18 @@ extern const FH20 C_FH20_ZERO;
 extern const FH32 C_FH32_ZERO;
 extern const FH256 C_FH256_ZERO;
 
+// Fork names hardcoded in retesteth logic, interned once
+extern const FORK C_FORK_LONDON;
+extern const FORK C_FORK_MERGE;
+extern const FORK C_FORK_SHANGHAI;
+extern const FORK C_FORK_CANCUN;
+extern const FORK C_FORK_ARROWGLACIER;
+extern const FORK C_FORK_HOMESTEADTODAOAT5;
+extern const FORK C_FORK_BERLINTOLONDONAT5;
+extern const FORK C_FORK_ARROWGLACIERTOMERGEATDIFFC0000;
+extern const FORK C_FORK_MERGETOSHANGHAIATTIME15K;
+extern const FORK C_FORK_SHANGHAITOCANCUNATTIME15K;
+
 namespace constnames {
 
 extern const std::string c_author;
@@ -1,6 +1,7 @@
 #include <retesteth/ExitHandler.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/session/Session.h>
+#include <retesteth/testSuiteRunner/FillerHashIndex.h>
 using namespace test;
 using namespace test::session;
 
@@ -22,6 +23,8 @@ void ExitHandler::doExit()
     {
         RPCSession::clear();
         test::TestOutputHelper::printTestExecStats();
+        RPCSession::printRecycleStats();
+        testsuite::FillerHashIndex::get().save();
         runOnce = true;
     }
 }
@@ -108,6 +108,13 @@ Options::Options(int argc, const char** argv)
         cout << setw(40) << "--nodes" << setw(0) << "List of client tcp ports (\"addr:ip, addr:ip\")\n";
         cout << setw(40) << " " << setw(0) << "|-Overrides the config file \"socketAddress\" section \n";
     });
+    ADD_OPTIONV(concurrentClients, "--concurrentclients", [](){
+        cout << setw(40) << "--concurrentclients" << setw(0) << "Run the tests for all --clients at the same time\n";
+        cout << setw(40) << " " << setw(0) << "|-Each client runs with its own -j threads \n";
+        }, [this](){
+            if (filltests || nodesoverride.initialized())
+                BOOST_THROW_EXCEPTION(InvalidOption("Error: --concurrentclients can't be used with --filltests or --nodes"));
+    });
     ADD_OPTION(testpath, "--testpath", [](){
         cout << "\nSetting test suite and test\n";
         cout << setw(40) << "--testpath <PathToTheTestRepo>" << setw(25) << "Set path to the test repo\n";
@@ -319,7 +326,7 @@ Options::Options(int argc, const char** argv)
     for(auto const& el : argList)
         BOOST_THROW_EXCEPTION(InvalidOption("Error: Dublicate or unrecognized option: `" + string(el) + "`"));
 
-    if (threadCount == 1)
+    if (threadCount == 1 && !concurrentClients)
         dataobject::GCP_SPointer<int>::DISABLETHREADSAFE();
 }
 
@@ -392,5 +399,6 @@ void displayTestSuites()
     cout << setw(30) << "-t SOLCSuite" << setw(0) << "Unit tests for solidity support\n";
     cout << setw(30) << "-t OptionsSuite" << setw(0) << "Unit tests for this cmd menu\n";
     cout << setw(30) << "-t TestHelperSuite" << setw(0) << "Unit tests for retesteth logic\n";
+    cout << setw(30) << "-t SocketSuite" << setw(0) << "Unit tests for rpc socket transport\n";
     cout << "\n";
 }
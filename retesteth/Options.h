@@ -209,6 +209,7 @@ public:
     vecstr_opt clients;
     string_opt datadir;
     vecaddr_opt nodesoverride;
+    bool_opt concurrentClients = false;
 
     // Setting test suite and test
     fspath_opt testpath;
@@ -271,13 +272,41 @@ public:
         bool testSuiteRunning() const;
         size_t activeConfigs() const;
         bool currentConfigIsSet() const;
-        std::set<FORK> const& runOnlyNetworks() const { return m_runOnlyNetworks; }
+        std::set<FORK> const& runOnlyNetworks() const;
+
+        // Current config of the task running on this thread, overrides the global current config
+        // The config must be set with setCurrentConfig first
+        class TaskConfigScope
+        {
+        public:
+            explicit TaskConfigScope(ClientConfig const& _config);
+            ~TaskConfigScope();
+            TaskConfigScope(TaskConfigScope const&) = delete;
+            void operator=(TaskConfigScope const&) = delete;
+
+        private:
+            ClientConfig const* m_previous;
+        };
+
+        // Puts the global current config back on exit, when setCurrentConfig is called in between
+        class CurrentConfigScope
+        {
+        public:
+            CurrentConfigScope();
+            ~CurrentConfigScope();
+            CurrentConfigScope(CurrentConfigScope const&) = delete;
+            void operator=(CurrentConfigScope const&) = delete;
+
+        private:
+            test::ClientConfigID m_previous;
+        };
 
     private:
         bool m_testSuiteRunning = false;
-        std::set<FORK> m_runOnlyNetworks;
+        std::map<size_t, std::set<FORK>> m_runOnlyNetworks;  // config id => networks
         mutable std::vector<ClientConfig> m_clientConfigs;
         test::ClientConfigID m_currentConfigID = test::ClientConfigID::null();
+        static thread_local ClientConfig const* t_taskConfig;
     };
 
 public:
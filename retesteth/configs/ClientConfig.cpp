@@ -12,7 +12,6 @@ using namespace test::teststruct;
 namespace fs = boost::filesystem;
 
 std::mutex g_staticDeclaration_clientConfigID;
-std::mutex g_staticDeclaration_translateNetworks_static;
 namespace test
 {
 ClientConfigID::ClientConfigID()
@@ -105,8 +104,7 @@ ClientConfig::ClientConfig(fs::path const& _clientConfigPath) : m_id(ClientConfi
 
         CJOptions opt { .jsonParse = CJOptions::JsonParse::ALLOW_COMMENTS };
         spDataObject correctMiningReward = test::readJsonData(m_correctMiningRewardPath, opt);
-        correctMiningReward.getContent().performModifier(mod_removeComments);
-        correctMiningReward.getContent().performModifier(mod_valueToCompactEvenHexPrefixed);
+        DataObjectNormalizer({mod_removeComments, mod_valueToCompactEvenHexPrefixed}).perform(correctMiningReward.getContent());
         for (auto const& el : cfgFile().forks())
         {
             if (!correctMiningReward->count(el.asString()))
@@ -118,6 +116,8 @@ ClientConfig::ClientConfig(fs::path const& _clientConfigPath) : m_id(ClientConfi
         }
         for (auto const& el : correctMiningReward->getSubObjects())
             m_correctReward[el->getKey()] = sVALUE(correctMiningReward->atKey(el->getKey()));
+
+        initTranslatedNetworks();
     }
     catch (std::exception const& _ex)
     {
@@ -162,7 +162,7 @@ bool ClientConfig::checkForkAllowed(FORK const& _net) const
 
 bool ClientConfig::checkForkInProgression(FORK const& _net) const
 {
-    return cfgFile().forkProgressionAsSet().count(_net);
+    return cfgFile().forkProgressionIndex(_net) != ClientConfigFile::c_forkNotInProgression;
 }
 
 bool ClientConfig::checkForkSkipOnFiller(FORK const& _net) const
@@ -180,7 +180,6 @@ bool ClientConfig::checkForkSkipOnFiller(FORK const& _net) const
 /// <=Homestead to Frontier, Homestead
 void ClientConfig::translateNetworks(set<string> const& _networks, std::vector<FORK> const& _netOrder, std::vector<FORK>& _out)
 {
-    std::lock_guard<std::mutex> lock(g_staticDeclaration_translateNetworks_static);
     // Construct vector with test network names in a right order
     // (from Frontier to Homestead ... to Constantinople)
     // According to fork order in config file
@@ -252,12 +251,62 @@ void ClientConfig::translateNetworks(set<string> const& _networks, std::vector<F
     }
 }
 
+// Resolve every `Fork`, `>Fork`, `>=Fork`, `<Fork`, `<=Fork` of the config once
+// The map is not modified after construction, so threads read it without a lock
+void ClientConfig::initTranslatedNetworks()
+{
+    static std::vector<string> const prefixes = {"", ">", ">=", "<", "<="};
+    for (auto const& fork : cfgFile().forks())
+    {
+        for (auto const& prefix : prefixes)
+        {
+            string const net = prefix + fork.asString();
+            std::vector<FORK> nets;
+            ClientConfig::translateNetworks({net}, cfgFile().forks(), nets);
+            bool allowed = true;
+            for (auto const& el : nets)
+                allowed = allowed && checkForkAllowed(el);
+            if (allowed)
+                m_translatedNetworks.emplace(net, std::move(nets));
+        }
+    }
+    for (auto const& fork : cfgFile().additionalForks())
+    {
+        if (checkForkAllowed(fork))
+            m_translatedNetworks.emplace(fork.asString(), std::vector<FORK>{fork});
+    }
+}
+
 std::vector<FORK> ClientConfig::translateNetworks(set<string> const& _networks) const
 {
+    if (_networks.size() == 1)
+    {
+        auto const it = m_translatedNetworks.find(*_networks.begin());
+        if (it != m_translatedNetworks.end())
+            return it->second;
+    }
+
     std::vector<FORK> nets;
-    ClientConfig::translateNetworks(_networks, cfgFile().forks(), nets);
-    for (auto const& net : nets)
-        validateForkAllowed(net);
+    auto addNets = [&nets](std::vector<FORK> const& _nets) {
+        for (auto const& net : _nets)
+            if (std::find(nets.begin(), nets.end(), net) == nets.end())
+                nets.push_back(net);
+    };
+    for (auto const& net : _networks)
+    {
+        auto const it = m_translatedNetworks.find(net);
+        if (it != m_translatedNetworks.end())
+            addNets(it->second);
+        else
+        {
+            // Unknown or not allowed forks, translate and report them as before
+            std::vector<FORK> translated;
+            ClientConfig::translateNetworks({net}, cfgFile().forks(), translated);
+            for (auto const& el : translated)
+                validateForkAllowed(el);
+            addNets(translated);
+        }
+    }
     return nets;
 }
 
@@ -3,6 +3,7 @@
 #include <retesteth/testStructures/configs/ClientConfigFile.h>
 #include <retesteth/testStructures/configs/FORK.h>
 #include <string>
+#include <unordered_map>
 
 namespace test
 {
@@ -85,12 +86,16 @@ public:
     // Replace notations in requests if needed
     void performFieldReplace(DataObject& _data, FieldReplaceDir const& _dir) const;
 
+private:
+    void initTranslatedNetworks();
+
 private:
     ClientConfigID m_id;                                ///< Internal id
     GCP_SPointer<ClientConfigFile> m_clientConfigFile;  ///< <clientname>/config file
     std::map<FORK, spVALUE> m_correctReward;            ///< Correct mining reward info for StateTests->BlockchainTests
     std::map<FORK, spDataObject> m_genesisTemplate;     ///< Template For test_setChainParams
     std::map<FORK, spVALUE> m_genesisTemplateChainID;   ///< ChainID value from template read
+    std::unordered_map<std::string, std::vector<FORK>> m_translatedNetworks;  ///< `>=Fork` => forks, see translateNetworks
 
 
     boost::filesystem::path m_correctMiningRewardPath;  ///< Path to correct mining reward info file
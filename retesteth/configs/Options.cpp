@@ -60,9 +60,37 @@ size_t Options::DynamicOptions::activeConfigs() const
     return m_clientConfigs.size();
 }
 
+thread_local ClientConfig const* Options::DynamicOptions::t_taskConfig = nullptr;
+
 bool Options::DynamicOptions::currentConfigIsSet() const
 {
-    return m_currentConfigID.id() != ClientConfigID::null().id();
+    return t_taskConfig != nullptr || m_currentConfigID.id() != ClientConfigID::null().id();
+}
+
+Options::DynamicOptions::TaskConfigScope::TaskConfigScope(ClientConfig const& _config) : m_previous(t_taskConfig)
+{
+    t_taskConfig = &_config;
+}
+
+Options::DynamicOptions::TaskConfigScope::~TaskConfigScope()
+{
+    t_taskConfig = m_previous;
+}
+
+Options::DynamicOptions::CurrentConfigScope::CurrentConfigScope() : m_previous(Options::getDynamicOptions().m_currentConfigID)
+{
+}
+
+Options::DynamicOptions::CurrentConfigScope::~CurrentConfigScope()
+{
+    Options::getDynamicOptions().m_currentConfigID = m_previous;
+}
+
+std::set<FORK> const& Options::DynamicOptions::runOnlyNetworks() const
+{
+    static std::set<FORK> const c_empty;
+    auto const it = m_runOnlyNetworks.find(getCurrentConfig().getId().id());
+    return it == m_runOnlyNetworks.end() ? c_empty : it->second;
 }
 
 std::mutex g_testSuite_timeout;
@@ -79,6 +107,8 @@ bool Options::DynamicOptions::testSuiteRunning() const
 
 ClientConfig const& Options::DynamicOptions::getCurrentConfig() const
 {
+    if (t_taskConfig != nullptr)
+        return *t_taskConfig;
     for (auto const& cfg : m_clientConfigs)
     {
         if (cfg.getId() == m_currentConfigID)
@@ -112,13 +142,14 @@ void Options::DynamicOptions::setCurrentConfig(ClientConfig const& _config)
         _config.validateForkAllowed(FORK(net));
 
     // Set runOnlyNetworks
-    m_runOnlyNetworks.clear();
+    std::set<FORK>& runOnlyNetworks = m_runOnlyNetworks[_config.getId().id()];
+    runOnlyNetworks.clear();
     if (!opt.runOnlyNets.empty())
     {
         auto const setOfNets = test::explodeIntoSet(opt.runOnlyNets, ',');
         auto const vectrTranslated = _config.translateNetworks(setOfNets);
         for (auto const& net : vectrTranslated)
-            m_runOnlyNetworks.emplace(net);
+            runOnlyNetworks.emplace(net);
     }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <libdataobj/DataObject.h>
 #include <configs/ForEachMacro.h>
+#include <boost/filesystem/path.hpp>
 
 namespace retesteth::options
 {
@@ -8,6 +9,9 @@ extern dataobject::DataObject map_configs;
 extern std::string const yul_compiler_sh;
 extern std::string const t8ntool_start;
 
+// Write the default client configs into _dir
+void deployFirstRunConfigs(boost::filesystem::path const& _dir);
+
 #define REGISTER(X) \
     class gen##X { public: gen##X(); };
 #define INIT(X) \
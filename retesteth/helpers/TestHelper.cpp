@@ -1,10 +1,10 @@
 #include <BuildInfo.h>
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/uuid/uuid_generators.hpp>  // generators
 #include <boost/uuid/uuid_io.hpp>
 #include <libdataobj/ConvertFile.h>
-#include <libdataobj/ConvertYaml.h>
 #include <libdevcore/CommonIO.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/Options.h>
@@ -39,10 +39,10 @@ spDataObject readJsonData(fs::path const& _file, CJOptions const& _opt)
 {
     try
     {
-        const string s = dev::contentsString(_file);
+        dev::MappedFile const file(_file);
         ETH_ERROR_REQUIRE_MESSAGE(
-            s.length() > 0, "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
-        return dataobject::ConvertJsoncppStringToData(s, _opt);
+            file.size() > 0, "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
+        return dataobject::ConvertJsoncppStringToData(file.view(), _opt);
     }
     catch (std::exception const& _ex)
     {
@@ -56,10 +56,10 @@ spDataObject readYamlData(fs::path const& _file, bool _sort)
 {
     try
     {
-        const string s = dev::contentsString(_file);
+        dev::MappedFile const file(_file);
         ETH_ERROR_REQUIRE_MESSAGE(
-            s.length() > 0, "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
-        return dataobject::ConvertYamlToData(YAML::Load(s), _sort);
+            file.size() > 0, "Contents of " + _file.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
+        return dataobject::ConvertYamlStringToData(file.view(), _sort);
     }
     catch (std::exception const& _ex)
     {
@@ -72,13 +72,13 @@ spDataObject readAutoDataWithoutOptions(boost::filesystem::path const& _file, bo
 {
     try
     {
-        const string s = dev::contentsString(_file);
-        if (s.length() == 0)
+        dev::MappedFile const file(_file);
+        if (file.size() == 0)
             std::cerr << "Contents of " + _file.string() + " is empty. Trying to parse empty file." << std::endl;
         if (_file.extension() == ".json")
-            return dataobject::ConvertJsoncppStringToData(s);
+            return dataobject::ConvertJsoncppStringToData(file.view());
         else if (_file.extension() == ".yml")
-            return dataobject::ConvertYamlToData(YAML::Load(s), _sort);
+            return dataobject::ConvertYamlStringToData(file.view(), _sort);
         std::cerr << "Unknown test file: " << _file.string() << std::endl;
     }
     catch (std::exception const& _ex)
@@ -136,6 +136,19 @@ boost::filesystem::path getTestPath()
     return testPath;
 }
 
+string fileIdentity(fs::path const& _file)
+{
+    struct stat st;
+    if (::stat(_file.c_str(), &st) != 0)
+        return string();
+#if defined(__APPLE__)
+    long const mtimeNsec = st.st_mtimespec.tv_nsec;
+#else
+    long const mtimeNsec = st.st_mtim.tv_nsec;
+#endif
+    return to_string(st.st_size) + ":" + to_string(st.st_mtime) + "." + to_string(mtimeNsec) + ":" + to_string(st.st_ino);
+}
+
 void copyFile(fs::path const& _source, fs::path const& _destination)
 {
     fs::ifstream src(_source, ios::binary);
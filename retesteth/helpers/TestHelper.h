@@ -32,6 +32,9 @@ std::vector<boost::filesystem::path> getFiles(boost::filesystem::path const& _di
 /// Get test repo path from ETHEREUM_TEST_PATH environment variable
 boost::filesystem::path getTestPath();
 
+/// Identity of the file content as seen by the file system (size, mtime, inode), empty if the file does not exist
+std::string fileIdentity(boost::filesystem::path const& _file);
+
 /// Copy file from _source to _destination
 void copyFile(boost::filesystem::path const& _source, boost::filesystem::path const& _destination);
 
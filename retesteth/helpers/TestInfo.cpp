@@ -72,6 +72,11 @@ std::string TestInfo::errorDebug() const
     if (!m_sTransactionData.empty())
         message += ", TrData: `" + m_sTransactionData + "`";
 
+    // Same test is reported for each of --clients
+    auto const& dynOpt = Options::getDynamicOptions();
+    if (dynOpt.activeConfigs() > 1 && dynOpt.currentConfigIsSet())
+        message += ", client: " + dynOpt.getCurrentConfig().cfgFile().name();
+
     if (nologcolor)
         return message + ")";
     return message + ")" + cDefault;
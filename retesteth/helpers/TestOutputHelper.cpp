@@ -42,30 +42,44 @@ static std::map<fs::path, FolderNameSet> finishedTestFoldersMap;
 // static std::map<fs::path, FolderNameSet> exceptionTestFoldersMap;
 void checkUnfinishedTestFolders();  // Checkup that all test folders are active during the test run
 
-static int execTotalErrors = 0;
+static std::atomic<size_t> execTotalErrors(0);
 static std::map<thread::id, TestOutputHelper> helperThreadMap;  // threadID => outputHelper
-mutex g_totalTestsRun;
 mutex g_failedTestsMap;
 mutex g_warningTests;
-mutex g_execTotalErrors;
-static int totalTestsRun = 0;
+mutex g_boostError;
+static std::atomic<size_t> totalTestsRun(0);
 static std::map<std::string, std::string> s_failedTestsMap;
 static std::vector<std::string> s_warningTests;
 
+// Failed test record, per client config when running with several --clients
+string failedTestKey(string const& _testName)
+{
+    auto const& dynOpt = Options::getDynamicOptions();
+    if (dynOpt.activeConfigs() > 1 && dynOpt.currentConfigIsSet())
+        return _testName + " [" + dynOpt.getCurrentConfig().cfgFile().name() + "]";
+    return _testName;
+}
+
+// The map registers helpers for printBoostError, its nodes are never erased
+// So each thread looks up its helper once and then uses the thread_local pointer
 mutex g_helperThreadMapMutex;
+thread_local TestOutputHelper* t_threadHelper = nullptr;
 TestOutputHelper& TestOutputHelper::get()
 {
+    if (t_threadHelper)
+        return *t_threadHelper;
+
     std::lock_guard<std::mutex> lock(g_helperThreadMapMutex);
     thread::id const tID = getThreadID();
-    if (helperThreadMap.count(tID))
-        return helperThreadMap.at(tID);
-    else
+    auto it = helperThreadMap.find(tID);
+    if (it == helperThreadMap.end())
     {
         TestOutputHelper instance;
-        helperThreadMap.emplace(std::make_pair(tID, std::move(instance)));
-        helperThreadMap.at(tID).initTest(0);
+        it = helperThreadMap.emplace(std::make_pair(tID, std::move(instance))).first;
+        it->second.initTest(0);
     }
-    return helperThreadMap.at(tID);
+    t_threadHelper = &it->second;
+    return *t_threadHelper;
 }
 
 void TestOutputHelper::markWarning(std::string const& _message)
@@ -128,9 +142,10 @@ bool TestOutputHelper::markError(std::string const& _message)
     if (testDebugInfo.empty())
         ETH_WARNING(TestOutputHelper::get().testName() + ", Message: " + _message +
                     ", has empty debugInfo! Missing debug Testinfo for test step.");
+    string const failedKey = failedTestKey(TestOutputHelper::get().testName());
     std::lock_guard<std::mutex> lock(g_failedTestsMap);
-    if (!s_failedTestsMap.count(TestOutputHelper::get().testName()))
-        s_failedTestsMap[TestOutputHelper::get().testName()] = testDebugInfo;
+    if (!s_failedTestsMap.count(failedKey))
+        s_failedTestsMap[failedKey] = testDebugInfo;
     return true;
 }
 
@@ -140,8 +155,8 @@ void TestOutputHelper::unmarkLastError()
 {
     if (m_errors.size())
         m_errors.pop_back();
+    string const tname = failedTestKey(TestOutputHelper::get().testName());
     std::lock_guard<std::mutex> lock(g_failedTestsMap);
-    string const& tname = TestOutputHelper::get().testName();
     if (s_failedTestsMap.count(tname))
         s_failedTestsMap.erase(tname);
 }
@@ -151,7 +166,7 @@ void TestOutputHelper::setUnitTestExceptions(std::vector<std::string> const& _me
     m_expected_UnitTestExceptions = _messages;
 }
 
-size_t TestOutputHelper::m_currentTestRun = 0;
+std::atomic<size_t> TestOutputHelper::m_currentTestRun(0);
 void TestOutputHelper::initTest(size_t _maxTests)
 {
     Options::getDynamicOptions().setTestsuiteRunning(true);
@@ -189,7 +204,6 @@ void TestOutputHelper::initTest(size_t _maxTests)
 
 void TestOutputHelper::registerTestRunSuccess()
 {
-    std::lock_guard<std::mutex> lock(g_totalTestsRun);
     totalTestsRun++;
 }
 
@@ -236,38 +250,27 @@ void TestOutputHelper::printBoostError()
     {
         ETH_STDERROR_MESSAGE("\n--------");
         ETH_STDERROR_MESSAGE("TestOutputHelper detected " + fto_string(errorCount) + " errors during test execution!");
-        std::lock_guard<std::mutex> lock(g_execTotalErrors);
-        BOOST_ERROR("");  // NOT THREAD SAFE !!!
         execTotalErrors += errorCount;
+        std::lock_guard<std::mutex> lock(g_boostError);
+        BOOST_ERROR("");  // NOT THREAD SAFE !!!
     }
     // helperThreadMap.clear(); !!! could not delete TestHelper from TestHelper destructor !!!
 }
 
 void _printTotalErrors()
 {
-    bool wereExecErrors = false;
+    size_t const totalErrors = execTotalErrors.exchange(0);
+    if (totalErrors)
     {
-        std::lock_guard<std::mutex> lock(g_execTotalErrors);
-        if (execTotalErrors)
-        {
-            wereExecErrors = true;
-            ETH_STDERROR_MESSAGE("\n--------");
-            ETH_STDERROR_MESSAGE("*** TOTAL ERRORS DETECTED: " + toString(execTotalErrors) +
-                                 " errors during all test execution!");
-            ETH_STDERROR_MESSAGE("--------");
-        }
-    }
+        ETH_STDERROR_MESSAGE("\n--------");
+        ETH_STDERROR_MESSAGE("*** TOTAL ERRORS DETECTED: " + toString(totalErrors) +
+                             " errors during all test execution!");
+        ETH_STDERROR_MESSAGE("--------");
 
-    if (wereExecErrors)
-    {
         std::lock_guard<std::mutex> lock(g_failedTestsMap);
         for (auto const& error : s_failedTestsMap)
             std::cout << "info:" << error.second << std::endl;
     }
-    {
-        std::lock_guard<std::mutex> lock(g_execTotalErrors);
-        execTotalErrors = 0;
-    }
 }
 
 void _printTotalWarnings()
@@ -290,14 +293,12 @@ void TestOutputHelper::printTestExecStats()
     if (!opt.singleTestFile.initialized())
         checkUnfinishedTestFolders();
 
-    {
-        std::lock_guard<std::mutex> lock(g_totalTestsRun);
-        const string message = "*** Total Tests Run: " + fto_string(totalTestsRun) + "\n";
-        if (totalTestsRun > 0)
-            ETH_STDOUT_MESSAGE(message);
-        else
-            ETH_STDERROR_MESSAGE(message);
-    }
+    size_t const testsRun = totalTestsRun;
+    const string message = "*** Total Tests Run: " + fto_string(testsRun) + "\n";
+    if (testsRun > 0)
+        ETH_STDOUT_MESSAGE(message);
+    else
+        ETH_STDERROR_MESSAGE(message);
 
     if (Options::get().exectimelog)
         TestOutputTimer::printTotalTimes();
@@ -24,6 +24,7 @@
 #include <boost/test/unit_test.hpp>
 #include <retesteth/helpers/TestInfo.h>
 #include <retesteth/helpers/TestOutputTimer.h>
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -100,7 +101,7 @@ private:
     std::vector<std::string> m_expected_UnitTestExceptions;  // expect following errors
 
     // Debug print
-    static size_t m_currentTestRun;
+    static std::atomic<size_t> m_currentTestRun;
 };
 
 class TestOutputHelperFixture
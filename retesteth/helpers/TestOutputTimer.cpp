@@ -1,5 +1,6 @@
 #include "TestOutputTimer.h"
 #include <retesteth/helpers/TestHelper.h>
+#include <atomic>
 using namespace std;
 
 namespace  {
@@ -9,8 +10,7 @@ namespace  {
     std::mutex g_execTimeResults;
     static std::vector<execTimeName> execTimeResults;
 
-    std::mutex g_execT8nTimeResults;
-    static double currentT8NSubcallTime = 0;
+    static std::atomic<double> currentT8NSubcallTime(0);
 }
 
 namespace test {
@@ -22,7 +22,6 @@ TestOutputTimer::TestOutputTimer()
 
 void TestOutputTimer::resetT8NTime()
 {
-    std::lock_guard<std::mutex> lock(g_execT8nTimeResults);
     currentT8NSubcallTime = 0;
 }
 
@@ -39,17 +38,15 @@ void TestOutputTimer::startSubcallTimer()
 
 void TestOutputTimer::finishSubcallTimer()
 {
-    std::lock_guard<std::mutex> lock(g_execT8nTimeResults);
-    currentT8NSubcallTime += m_timerClient.elapsed();
+    double const elapsed = m_timerClient.elapsed();
+    double current = currentT8NSubcallTime;
+    while (!currentT8NSubcallTime.compare_exchange_weak(current, current + elapsed))
+        ;
 }
 
 void TestOutputTimer::printFinishTest(string const& _testName) const
 {
-    double t8nTimeRecorded;
-    {
-        std::lock_guard<std::mutex> lock(g_execT8nTimeResults);
-        t8nTimeRecorded = currentT8NSubcallTime;
-    }
+    double const t8nTimeRecorded = currentT8NSubcallTime;
     const execTimeName res = { _testName, getTotalTimer(), getTotalCPU(), t8nTimeRecorded };
     auto const& test = std::get<0>(res);
     auto const& time = std::get<1>(res);
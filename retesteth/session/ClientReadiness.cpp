@@ -0,0 +1,238 @@
+#include "ClientReadiness.h"
+#include <retesteth/ExitHandler.h>
+#include <boost/filesystem.hpp>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+using namespace std;
+using namespace std::chrono;
+namespace fs = boost::filesystem;
+
+namespace test::session
+{
+namespace
+{
+typedef steady_clock::time_point Deadline;
+
+milliseconds remaining(Deadline const& _deadline)
+{
+    auto const now = steady_clock::now();
+    return now < _deadline ? duration_cast<milliseconds>(_deadline - now) : milliseconds(0);
+}
+
+// Sleep before the next attempt, doubling the delay up to the cap
+void backoff(milliseconds& _delay, Deadline const& _deadline, milliseconds _cap)
+{
+    this_thread::sleep_for(min(_delay, remaining(_deadline)));
+    _delay = min(_delay * 2, _cap);
+}
+
+// Tcp client address as written in the configs: "127.0.0.1:8545", "http://localhost:8545/" => host:port
+string hostAndPort(string const& _address)
+{
+    string address = _address;
+    size_t const scheme = address.find("://");
+    if (scheme != string::npos)
+        address = address.substr(scheme + 3);
+    return address.substr(0, address.find('/'));
+}
+
+// Non blocking connect of _fd, true if connected before the deadline
+bool connectSocket(int _fd, struct sockaddr const* _addr, socklen_t _len, Deadline const& _deadline)
+{
+    fcntl(_fd, F_SETFL, O_NONBLOCK);
+    int ret = connect(_fd, _addr, _len);
+    if (ret < 0 && errno == EINPROGRESS)
+    {
+        pollfd pfd = {_fd, POLLOUT, 0};
+        int error = 0;
+        socklen_t len = sizeof(error);
+        if (poll(&pfd, 1, remaining(_deadline).count()) == 1 && getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &len) == 0 &&
+            error == 0)
+            ret = 0;
+    }
+    return ret == 0;
+}
+
+// Connect to the client socket, return -1 if the client does not accept connections
+int connectTo(Socket::SocketType _type, string const& _path, Deadline const& _deadline)
+{
+    if (_type == Socket::IPC)
+    {
+        struct sockaddr_un saun;
+        if (_path.length() >= sizeof(saun.sun_path))
+            return -1;
+        memset(&saun, 0, sizeof(saun));
+        saun.sun_family = AF_UNIX;
+        strcpy(saun.sun_path, _path.c_str());
+        int const fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+        if (connectSocket(fd, reinterpret_cast<struct sockaddr const*>(&saun), sizeof(saun), _deadline))
+            return fd;
+        close(fd);
+        return -1;
+    }
+
+    // Host names are resolved, every resolved address is tried
+    string const address = hostAndPort(_path);
+    size_t const pos = address.find_last_of(':');
+    if (pos == string::npos)
+        return -1;
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo* resolved = nullptr;
+    if (getaddrinfo(address.substr(0, pos).c_str(), address.substr(pos + 1).c_str(), &hints, &resolved) != 0)
+        return -1;
+    int fd = -1;
+    for (struct addrinfo* ai = resolved; ai != nullptr && fd < 0; ai = ai->ai_next)
+    {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd >= 0 && !connectSocket(fd, ai->ai_addr, ai->ai_addrlen, _deadline))
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(resolved);
+    return fd;
+}
+
+// Send web3_clientVersion and read the reply, true if the client returned a result
+bool probeClientVersion(Socket::SocketType _type, string const& _path, Deadline const& _deadline)
+{
+    int const fd = connectTo(_type, _path, _deadline);
+    if (fd < 0)
+        return false;
+
+    string const body = R"({"jsonrpc":"2.0","method":"web3_clientVersion","params":[],"id":1})";
+    string request = body;
+    if (_type == Socket::TCP)
+        request = "POST / HTTP/1.1\r\nHost: " + hostAndPort(_path) + "\r\nContent-Type: application/json\r\nContent-Length: " +
+                  to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+
+    bool answered = false;
+    if (send(fd, request.c_str(), request.size(), MSG_NOSIGNAL) == (ssize_t)request.size())
+    {
+        // Http headers are skipped, the json reply is framed as in Socket
+        string received;
+        size_t bodyBegin = _type == Socket::TCP ? string::npos : 0;
+        JsonObjectValidator validator;
+        pollfd pfd = {fd, POLLIN, 0};
+        while (!validator.completeResponse() && poll(&pfd, 1, remaining(_deadline).count()) == 1)
+        {
+            char buf[4096];
+            ssize_t const ret = recv(fd, buf, sizeof(buf), 0);
+            if (ret <= 0)
+                break;
+            received.append(buf, ret);
+            if (bodyBegin == string::npos)
+            {
+                size_t const headerEnd = received.find("\r\n\r\n");
+                if (headerEnd == string::npos)
+                    continue;
+                bodyBegin = headerEnd + 4;
+                validator.acceptResponse(received.substr(bodyBegin));
+            }
+            else
+                validator.acceptResponse(string(buf, ret));
+        }
+        answered = validator.completeResponse() && validator.getResponse().find("\"result\"") != string::npos;
+    }
+    close(fd);
+    return answered;
+}
+}  // namespace
+
+bool waitForFile(string const& _path, milliseconds _timeout)
+{
+    Deadline const deadline = steady_clock::now() + _timeout;
+#if defined(__linux__)
+    int const fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    string const dir = fs::path(_path).parent_path().string();
+    if (fd >= 0 && inotify_add_watch(fd, dir.c_str(), IN_CREATE | IN_MOVED_TO) >= 0)
+    {
+        // Check after the watch is set, so the file created in between is not missed
+        while (!fs::exists(_path))
+        {
+            if (remaining(deadline).count() == 0 || ExitHandler::receivedExitSignal())
+                break;
+            pollfd pfd = {fd, POLLIN, 0};
+            if (poll(&pfd, 1, min<long>(remaining(deadline).count(), 1000)) == 1)
+            {
+                char events[4096];
+                while (read(fd, events, sizeof(events)) > 0)
+                    ;
+            }
+        }
+        close(fd);
+        return fs::exists(_path);
+    }
+    if (fd >= 0)
+        close(fd);
+#endif
+    milliseconds delay(10);
+    while (!fs::exists(_path) && remaining(deadline).count() > 0 && !ExitHandler::receivedExitSignal())
+        backoff(delay, deadline, milliseconds(200));
+    return fs::exists(_path);
+}
+
+bool waitForClientVersion(Socket::SocketType _type, string const& _path, milliseconds _timeout)
+{
+    Deadline const deadline = steady_clock::now() + _timeout;
+    milliseconds delay(20);
+    while (!ExitHandler::receivedExitSignal())
+    {
+        if (probeClientVersion(_type, _path, deadline))
+            return true;
+        if (remaining(deadline).count() == 0)
+            break;
+        backoff(delay, deadline, milliseconds(1000));
+    }
+    return false;
+}
+
+bool waitForClientShutdown(Socket::SocketType _type, string const& _path, milliseconds _timeout)
+{
+    Deadline const deadline = steady_clock::now() + _timeout;
+    milliseconds delay(20);
+    while (true)
+    {
+        int const fd = connectTo(_type, _path, deadline);
+        if (fd < 0)
+            return true;
+        close(fd);
+        if (remaining(deadline).count() == 0 || ExitHandler::receivedExitSignal())
+            return false;
+        backoff(delay, deadline, milliseconds(500));
+    }
+}
+
+bool waitForProcessExit(int _pid, milliseconds _timeout)
+{
+    Deadline const deadline = steady_clock::now() + _timeout;
+    milliseconds delay(5);
+    while (true)
+    {
+        int status = 0;
+        pid_t const ret = waitpid(_pid, &status, WNOHANG);
+        if (ret == _pid || (ret < 0 && errno == ECHILD))
+            return true;
+        if (remaining(deadline).count() == 0)
+            return false;
+        backoff(delay, deadline, milliseconds(200));
+    }
+}
+
+}  // namespace test::session
@@ -0,0 +1,23 @@
+#pragma once
+#include <retesteth/session/Socket.h>
+#include <chrono>
+#include <string>
+
+namespace test::session
+{
+// Wait for a client started by the scripts to become usable (or to go away)
+// instead of sleeping a fixed time. Each function returns false on timeout.
+
+// Wait for the file to be created (inotify on the parent directory on linux)
+bool waitForFile(std::string const& _path, std::chrono::milliseconds _timeout);
+
+// Probe web3_clientVersion with exponential backoff until the client answers
+bool waitForClientVersion(Socket::SocketType _type, std::string const& _path, std::chrono::milliseconds _timeout);
+
+// Wait until the client socket stops accepting connections
+bool waitForClientShutdown(Socket::SocketType _type, std::string const& _path, std::chrono::milliseconds _timeout);
+
+// Wait for the child process to exit and reap it
+bool waitForProcessExit(int _pid, std::chrono::milliseconds _timeout);
+
+}  // namespace test::session
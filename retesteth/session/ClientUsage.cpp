@@ -0,0 +1,101 @@
+#include "ClientUsage.h"
+#include <retesteth/EthChecks.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <boost/filesystem.hpp>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace test::debug;
+namespace fs = boost::filesystem;
+
+namespace test::session
+{
+optional<ProcStat> parseProcStat(string const& _line, size_t _pageKB)
+{
+    // pid (comm) state ppid ... rss is the 24th field, comm may contain spaces and brackets
+    size_t const commEnd = _line.rfind(')');
+    if (commEnd == string::npos || commEnd + 2 > _line.size())
+        return nullopt;
+    std::istringstream fields(_line.substr(commEnd + 2));
+    string field;
+    ProcStat stat;
+    size_t i = 3;
+    for (; i <= 24 && fields >> field; i++)
+    {
+        if (i == 4)
+            stat.ppid = atoi(field.c_str());
+        else if (i == 24)
+            stat.rssKB = strtoull(field.c_str(), nullptr, 10) * _pageKB;
+    }
+    if (i <= 24)
+        return nullopt;
+    return stat;
+}
+
+map<int, ProcStat> readProcStats()
+{
+    map<int, ProcStat> procs;
+    size_t const pageKB = sysconf(_SC_PAGESIZE) / 1024;
+    boost::system::error_code ec;
+    for (fs::directory_iterator it("/proc", ec), end; !ec && it != end; it.increment(ec))
+    {
+        string const name = it->path().filename().string();
+        if (name.empty() || !std::all_of(name.begin(), name.end(), ::isdigit))
+            continue;
+        std::ifstream statFile((it->path() / "stat").string());
+        string line;
+        if (!std::getline(statFile, line))
+            continue;
+        auto const stat = parseProcStat(line, pageKB);
+        if (stat.has_value())
+            procs[atoi(name.c_str())] = stat.value();
+    }
+    return procs;
+}
+
+size_t processTreeRSS(map<int, ProcStat> const& _procs, int _pid)
+{
+    size_t total = 0;
+    std::vector<int> tree = {_pid};
+    for (size_t i = 0; i < tree.size(); i++)
+    {
+        auto const self = _procs.find(tree.at(i));
+        if (self != _procs.end())
+            total += self->second.rssKB;
+        for (auto const& proc : _procs)
+            if (proc.second.ppid == tree.at(i))
+                tree.emplace_back(proc.first);
+    }
+    return total;
+}
+
+string clientUsageDegraded(ClientUsage const& _baseline, ClientUsage const& _current, size_t _memoryGrowthMB, uint64_t _latencyGrowth)
+{
+    size_t const memoryGrowth = _memoryGrowthMB * 1024;
+    if (memoryGrowth && _baseline.rssKB && _current.rssKB > _baseline.rssKB + memoryGrowth)
+    {
+        ETH_DC_MESSAGE(DC::STATS2, "Client memory grew from " + fto_string(_baseline.rssKB / 1024) + "MB to " +
+                                       fto_string(_current.rssKB / 1024) + "MB, restarting the client");
+        return "memory growth";
+    }
+
+    for (auto const& [method, latency] : _current.latency)
+    {
+        auto const baseline = _baseline.latency.find(method);
+        if (!_latencyGrowth || baseline == _baseline.latency.end() || !baseline->second)
+            continue;
+        if (latency > baseline->second * _latencyGrowth)
+        {
+            ETH_DC_MESSAGE(DC::STATS2, "Client " + method + " latency grew from " + fto_string(baseline->second) + "us to " +
+                                           fto_string(latency) + "us, restarting the client");
+            return "latency growth";
+        }
+    }
+    return string();
+}
+
+}  // namespace test::session
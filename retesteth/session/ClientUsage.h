@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace test::session
+{
+// Resource usage of the started clients, sampled during the run to restart the clients that degraded
+
+struct ProcStat
+{
+    int ppid = 0;
+    size_t rssKB = 0;
+};
+
+// Parent pid and RSS out of a /proc/<pid>/stat line, nullopt if the line is malformed
+std::optional<ProcStat> parseProcStat(std::string const& _line, size_t _pageKB);
+
+// pid => stat of every process, reads all of /proc so it is not called under the session lock
+std::map<int, ProcStat> readProcStats();
+
+// RSS in KB of _pid and all of its children (a start script runs the client as a child)
+size_t processTreeRSS(std::map<int, ProcStat> const& _procs, int _pid);
+
+struct ClientUsage
+{
+    size_t rssKB = 0;
+    std::map<std::string, uint64_t> latency;  // rpc method => average round trip in microseconds
+};
+
+// Restart reason if the usage grew over the config limits since the baseline, empty otherwise
+// Latency is compared per rpc method, so a test mix with heavier calls does not look like a slower client
+std::string clientUsageDegraded(
+    ClientUsage const& _baseline, ClientUsage const& _current, size_t _memoryGrowthMB, uint64_t _latencyGrowth);
+
+}  // namespace test::session
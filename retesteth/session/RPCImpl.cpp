@@ -6,6 +6,7 @@
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/session/RPCImpl.h>
 #include <retesteth/session/Session.h>
+#include <chrono>
 
 using namespace std;
 using namespace test;
@@ -13,6 +14,38 @@ using namespace test::debug;
 
 namespace test::session
 {
+namespace
+{
+spVALUE readTransactionCount(spDataObject& _response)
+{
+    try
+    {
+        (*_response).performModifier(mod_valueToCompactEvenHexPrefixed);
+        if (_response->type() == DataType::String)
+            return spVALUE(new VALUE(_response));
+        return spVALUE(new VALUE(_response->asInt()));
+    }
+    catch(std::exception const& _ex)
+    {
+        ETH_FAIL_MESSAGE(string("RPC eth_getTransactionCount Exception: ") + _ex.what());
+    }
+    return spVALUE(0);
+}
+
+spBYTES readCode(spDataObject const& _response)
+{
+    if (_response->asString().empty())
+    {
+        ETH_DC_MESSAGE(DC::LOWLOG, "eth_getCode return `` empty string, correct to `0x` empty bytes ");
+        return spBYTES(new BYTES(DataObject("0x")));
+    }
+    return spBYTES(new BYTES(_response));
+}
+
+// Accounts per json-rpc batch when reading the state
+size_t const c_accountsPerBatch = 16;
+}  // namespace
+
 spDataObject RPCImpl::web3_clientVersion()
 {
     return rpcCall("web3_clientVersion", {});
@@ -33,19 +66,8 @@ FH32 RPCImpl::eth_sendRawTransaction(BYTES const& _rlp, VALUE const& _secret)
 
 spVALUE RPCImpl::eth_getTransactionCount(FH20 const& _address, VALUE const& _blockNumber)
 {
-    try
-    {
-        spDataObject response = rpcCall("eth_getTransactionCount", {quote(_address.asString()), quote(_blockNumber.asString())});
-        (*response).performModifier(mod_valueToCompactEvenHexPrefixed);
-        if (response->type() == DataType::String)
-            return spVALUE(new VALUE(response));
-        return spVALUE(new VALUE(response->asInt()));
-    }
-    catch(std::exception const& _ex)
-    {
-        ETH_FAIL_MESSAGE(string("RPC eth_getTransactionCount Exception: ") + _ex.what());
-    }
-    return spVALUE(0);
+    spDataObject response = rpcCall("eth_getTransactionCount", {quote(_address.asString()), quote(_blockNumber.asString())});
+    return readTransactionCount(response);
 }
 
 VALUE RPCImpl::eth_blockNumber()
@@ -72,12 +94,7 @@ spEthGetBlockBy RPCImpl::eth_getBlockByNumber(VALUE const& _blockNumber, Request
 spBYTES RPCImpl::eth_getCode(FH20 const& _address, VALUE const& _blockNumber)
 {
     spDataObject res = rpcCall("eth_getCode", {quote(_address.asString()), quote(_blockNumber.asString())});
-    if (res->asString().empty())
-    {
-        ETH_DC_MESSAGE(DC::LOWLOG, "eth_getCode return `` empty string, correct to `0x` empty bytes ");
-        return spBYTES(new BYTES(DataObject("0x")));
-    }
-    return spBYTES(new BYTES(res));
+    return readCode(res);
 }
 
 spVALUE RPCImpl::eth_getBalance(FH20 const& _address, VALUE const& _blockNumber)
@@ -104,11 +121,18 @@ DebugAccountRange RPCImpl::debug_accountRange(
     return DebugAccountRange(res.getCContent());
 }
 
+RPCRequest RPCImpl::storageRangeRequest(
+    VALUE const& _blockNumber, VALUE const& _txIndex, FH20 const& _address, FH32 const& _begin, int _maxResults)
+{
+    return {"debug_storageRangeAt", {quote(_blockNumber.asDecString()), _txIndex.asDecString(), quote(_address.asString()),
+                                        quote(_begin.asString()), fto_string(_maxResults)}};
+}
+
 DebugStorageRangeAt RPCImpl::debug_storageRangeAt(
     VALUE const& _blockNumber, VALUE const& _txIndex, FH20 const& _address, FH32 const& _begin, int _maxResults)
 {
-    auto res = rpcCall("debug_storageRangeAt", {quote(_blockNumber.asDecString()), _txIndex.asDecString(),
-                                               quote(_address.asString()), quote(_begin.asString()), fto_string(_maxResults)});
+    RPCRequest const request = storageRangeRequest(_blockNumber, _txIndex, _address, _begin, _maxResults);
+    auto res = rpcCall(request.method, request.args);
     return DebugStorageRangeAt(res.getCContent());
 }
 
@@ -247,17 +271,25 @@ spDataObject RPCImpl::rpcCall(
     request += "],\"id\":" + to_string(m_rpcSequence++) + "}";
 
     ETH_DC_MESSAGE(DC::RPC, "Request: " + request);
-    JsonObjectValidator validator;  // read response while counting `{}`
+    JsonObjectValidator validator;  // read response while counting `{}`, `[]`
+    auto const start = std::chrono::steady_clock::now();
     string reply = m_socket.sendRequest(request, validator);
+    registerRPCLatency(_methodName, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
     ETH_DC_MESSAGE(DC::RPC, "Reply: `" + reply + "`");
 
     spDataObject result = ConvertJsoncppStringToData(reply);
+    return processResponse(result, request, _canFail);
+}
+
+spDataObject RPCImpl::processResponse(spDataObject& _response, std::string const& _request, bool _canFail)
+{
+    spDataObject& result = _response;
     if (result->count("error"))
         (*result)["result"] = "";
 
     if (!ExitHandler::receivedExitSignal())
     {
-        REQUIRE_JSONFIELDS(result, "rpcCall_response (req: '" + request.substr(0, 70) + "')",
+        REQUIRE_JSONFIELDS(result, "rpcCall_response (req: '" + _request.substr(0, 70) + "')",
             {{"jsonrpc", {{DataType::String}, jsonField::Required}},
              {"id", {{DataType::Integer}, jsonField::Required}},
              {"result", {{DataType::String, DataType::Integer,
@@ -274,7 +306,7 @@ spDataObject RPCImpl::rpcCall(
     if (result->count("error"))
     {
         test::TestOutputHelper const& helper = test::TestOutputHelper::get();
-        string const message = "Error on JSON-RPC call (" + helper.testInfo().errorDebug() + "):\nRequest: '" + request + "'" +
+        string const message = "Error on JSON-RPC call (" + helper.testInfo().errorDebug() + "):\nRequest: '" + _request + "'" +
                                "\nResult: '" + (*result)["error"]["message"].asString() + "'\n";
         m_lastInterfaceError = RPCError((*result)["error"]["message"].asString(), message);
 
@@ -288,6 +320,133 @@ spDataObject RPCImpl::rpcCall(
     return result.getContent().atKeyPointer("result");
 }
 
+std::vector<spDataObject> RPCImpl::rpcBatch(std::vector<RPCRequest> const& _calls)
+{
+    if (_calls.empty())
+        return {};
+
+    size_t const firstId = m_rpcSequence;
+    std::vector<string> requests;
+    requests.reserve(_calls.size());
+    string batch = "[";
+    for (auto const& call : _calls)
+    {
+        string request = "{\"jsonrpc\":\"2.0\",\"method\":\"" + call.method + "\",\"params\":[";
+        for (size_t i = 0; i < call.args.size(); ++i)
+        {
+            request += call.args[i];
+            if (i + 1 != call.args.size())
+                request += ", ";
+        }
+        request += "],\"id\":" + to_string(m_rpcSequence++) + "}";
+        if (batch.size() > 1)
+            batch += ",";
+        batch += request;
+        requests.emplace_back(std::move(request));
+    }
+    batch += "]";
+
+    ETH_DC_MESSAGE(DC::RPC, "Request: " + batch);
+    JsonObjectValidator validator;  // read response while counting `{}`, `[]`
+    auto const start = std::chrono::steady_clock::now();
+    string const reply = m_socket.sendRequest(batch, validator);
+    // Batches differ in size, the latency is counted per call of the batch
+    registerRPCLatency("batch:" + _calls.front().method,
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / _calls.size());
+    ETH_DC_MESSAGE(DC::RPC, "Reply: `" + reply + "`");
+
+    spDataObject response = ConvertJsoncppStringToData(reply);
+    if (ExitHandler::receivedExitSignal())
+        return std::vector<spDataObject>(_calls.size(), spDataObject(new DataObject(DataType::Null)));
+    if (response->type() != DataType::Array || response->getSubObjects().size() != _calls.size())
+        ETH_FAIL_MESSAGE("Client does not support json-rpc batch (`batchRequests` is set in client config), response: " +
+                         reply.substr(0, 200));
+
+    // Responses might come in any order, match them by id
+    std::vector<spDataObject> results(_calls.size(), spDataObject(0));
+    for (auto& el : (*response).getSubObjectsUnsafe())
+    {
+        size_t const index = el->count("id") && el->atKey("id").type() == DataType::Integer ?
+                                 el->atKey("id").asInt() - firstId : _calls.size();
+        if (index >= _calls.size() || !results.at(index).isEmpty())
+            ETH_FAIL_MESSAGE("Json-rpc batch response has unexpected id: " + el->asJson(0, false));
+        results.at(index) = processResponse(el, requests.at(index), false);
+    }
+    return results;
+}
+
+std::vector<State::Account> RPCImpl::getRemoteAccounts(
+    std::vector<FH20> const& _accounts, VALUE const& _blockNumber, VALUE const& _txIndex)
+{
+    if (!Options::getCurrentConfig().cfgFile().batchRequests())
+        return SessionInterface::getRemoteAccounts(_accounts, _blockNumber, _txIndex);
+
+    std::vector<State::Account> accounts;
+    accounts.reserve(_accounts.size());
+    string const blockNumber = quote(_blockNumber.asString());
+    for (size_t begin = 0; begin < _accounts.size(); begin += c_accountsPerBatch)
+    {
+        size_t const end = std::min(begin + c_accountsPerBatch, _accounts.size());
+
+        // Fields and the first storage page of every account in one request
+        std::vector<RPCRequest> calls;
+        for (size_t i = begin; i < end; i++)
+        {
+            string const address = quote(_accounts.at(i).asString());
+            calls.push_back({"eth_getBalance", {address, blockNumber}});
+            calls.push_back({"eth_getTransactionCount", {address, blockNumber}});
+            calls.push_back({"eth_getCode", {address, blockNumber}});
+            calls.push_back(storageRangeRequest(_blockNumber, _txIndex, _accounts.at(i), FH32::zero(), c_storageRangePage));
+        }
+        std::vector<spDataObject> results = rpcBatch(calls);
+
+        std::vector<spStorage> storages;
+        std::vector<std::pair<size_t, FH32>> pending;
+        for (size_t i = begin; i < end; i++)
+        {
+            size_t const pos = (i - begin) * 4;
+            DebugStorageRangeAt const range(results.at(pos + 3).getCContent());
+            storages.emplace_back(spStorage(new Storage()));
+            (*storages.back()).merge(range.storage());
+            if (!range.nextKey().isZero())
+                pending.emplace_back(i - begin, range.nextKey());
+        }
+
+        // Next storage pages of the accounts that have more records
+        size_t safety = 500;
+        while (!pending.empty() && --safety)
+        {
+            std::vector<RPCRequest> pageCalls;
+            for (auto const& [index, nextKey] : pending)
+                pageCalls.push_back(
+                    storageRangeRequest(_blockNumber, _txIndex, _accounts.at(begin + index), nextKey, c_storageRangePage));
+            std::vector<spDataObject> const pages = rpcBatch(pageCalls);
+
+            std::vector<std::pair<size_t, FH32>> nextPending;
+            for (size_t i = 0; i < pending.size(); i++)
+            {
+                DebugStorageRangeAt const range(pages.at(i).getCContent());
+                (*storages.at(pending.at(i).first)).merge(range.storage());
+                if (!range.nextKey().isZero())
+                    nextPending.emplace_back(pending.at(i).first, range.nextKey());
+            }
+            pending.swap(nextPending);
+        }
+        if (safety == 0)
+            ETH_ERROR_MESSAGE("remoteGetAccount::DebugStorageRangeAt seems like an endless loop!");
+
+        for (size_t i = begin; i < end; i++)
+        {
+            size_t const pos = (i - begin) * 4;
+            spVALUE balance(new VALUE(results.at(pos)));
+            spVALUE nonce = readTransactionCount(results.at(pos + 1));
+            spBYTES code = readCode(results.at(pos + 2));
+            accounts.emplace_back(_accounts.at(i), balance, nonce, code, storages.at(i - begin));
+        }
+    }
+    return accounts;
+}
+
 Socket::SocketType RPCImpl::getSocketType() const
 {
     return m_socket.type();
@@ -57,10 +57,16 @@ public:
     spDataObject rpcCall(std::string const& _methodName,
         std::vector<std::string> const& _args = std::vector<std::string>(),
         bool _canFail = false) override;
+    std::vector<spDataObject> rpcBatch(std::vector<RPCRequest> const& _calls) override;
+    std::vector<State::Account> getRemoteAccounts(
+        std::vector<FH20> const& _accounts, VALUE const& _blockNumber, VALUE const& _txIndex) override;
     Socket::SocketType getSocketType() const override;
     std::string const& getSocketPath() const override;
 
 private:
+    spDataObject processResponse(spDataObject& _response, std::string const& _request, bool _canFail);
+    RPCRequest storageRangeRequest(
+        VALUE const& _blockNumber, VALUE const& _txIndex, FH20 const& _address, FH32 const& _begin, int _maxResults);
     Socket m_socket;
     size_t m_rpcSequence = 1;
 };
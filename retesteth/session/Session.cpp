@@ -25,8 +25,11 @@
 #include <retesteth/ExitHandler.h>
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
+#include <retesteth/session/ClientReadiness.h>
+#include <retesteth/session/ClientUsage.h>
 #include <retesteth/session/RPCImpl.h>
 #include <retesteth/session/ToolImpl.h>
+#include <algorithm>
 #include <csignal>
 
 using namespace std;
@@ -56,12 +59,34 @@ struct sessionInfo
     std::string tmpDir;
     test::ClientConfigID configId;
     size_t totalRuns;
+
+    // Resource usage of the client, the first sample is the baseline
+    ClientUsage baseline;
+    std::string recycleReason;  // set when the client has to be restarted
 };
 
 void closeSession(thread::id const& _threadID);
 
 std::mutex g_socketMapMutex;
 static std::map<thread::id, sessionInfo> socketMap;
+static std::map<std::string, size_t> s_recycledClients;  // "client: reason" => restarts
+
+namespace
+{
+// Sample the client resource usage once per this many test runs
+size_t const c_recycleSampleRuns = 100;
+
+// Restart the clients that the usage samples can't measure (no process and no rpc latency) after this many runs
+size_t const c_maxTestBeforeFlush = 1500;
+
+// Longest wait for the started client to answer, the session is used as soon as the client is ready
+chrono::seconds clientStartTimeout(ClientConfig const& _config)
+{
+    size_t const initTime = _config.cfgFile().initializeTime();
+    size_t const seconds = Options::get().lowcpu ? initTime * 5 : initTime;
+    return chrono::seconds(std::max<size_t>(seconds, 25));
+}
+}  // namespace
 
 void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConfig const& _config)
 {
@@ -89,14 +114,10 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
         }
         else
         {
-            int maxSeconds = 25;
-            while (!boost::filesystem::exists(ipcPath) && maxSeconds-- > 0)
-                std::this_thread::sleep_for(std::chrono::seconds(1));
-            ETH_FAIL_REQUIRE_MESSAGE(maxSeconds > 0, "Client took too long to start ipc!");
+            ETH_FAIL_REQUIRE_MESSAGE(waitForFile(ipcPath, std::chrono::seconds(25)), "Client took too long to start ipc!");
             // Client has opened ipc socket. wait for it to initialize
-            ClientConfig const& curCFG = Options::getDynamicOptions().getCurrentConfig();
-            size_t const initTime = curCFG.cfgFile().initializeTime();
-            std::this_thread::sleep_for(std::chrono::seconds(initTime));
+            ETH_FAIL_REQUIRE_MESSAGE(waitForClientVersion(Socket::SocketType::IPC, ipcPath, clientStartTimeout(_config)),
+                "Client does not answer web3_clientVersion on ipc: " + ipcPath);
         }
         sessionInfo info(
             fp, new RPCSession(new RPCImpl(Socket::SocketType::IPC, ipcPath)), tmpDir.string(), pid, _config.getId());
@@ -147,6 +168,7 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
     }
 
     case ClientConfgSocketType::TransitionTool:
+    case ClientConfgSocketType::MockTransitionTool:
     {
         fs::path tmpDir = test::createUniqueTmpDirectory();
         sessionInfo info(NULL, new RPCSession(new ToolImpl(Socket::SocketType::TCP, _config.cfgFile().shell(), tmpDir)),
@@ -161,30 +183,86 @@ void RPCSession::runNewInstanceOfAClient(thread::id const& _threadID, ClientConf
 
 void RPCSession::currentCfgCountTestRun()
 {
-    std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    struct Sample
+    {
+        thread::id threadID;
+        RPCSession const* session;
+        int pid;
+        std::map<string, uint64_t> latency;
+    };
+    std::vector<Sample> samples;
     ClientConfig const& curCFG = Options::getDynamicOptions().getCurrentConfig();
-    for (auto& el : socketMap)
     {
-        sessionInfo& info = el.second;
-        if (info.configId.id() == curCFG.getId().id())
-            info.totalRuns++;
+        std::lock_guard<std::mutex> lock(g_socketMapMutex);
+        for (auto& el : socketMap)
+        {
+            sessionInfo& info = el.second;
+            if (info.configId.id() == curCFG.getId().id())
+            {
+                info.totalRuns++;
+                bool const measured = info.pipePid != 0 || !info.baseline.latency.empty();
+                if (!measured && info.totalRuns > c_maxTestBeforeFlush && info.recycleReason.empty())
+                    info.recycleReason = "run count";
+                if (info.totalRuns % c_recycleSampleRuns == 0 && info.recycleReason.empty())
+                    samples.push_back({el.first, info.session.get(), info.pipePid, info.session->getImplementation().takeRPCLatency()});
+            }
+        }
+    }
+    if (samples.empty())
+        return;
+
+    // The /proc scan reads every process of the system, other threads keep using their sessions meanwhile
+    bool const hasProcesses = std::any_of(samples.begin(), samples.end(), [](Sample const& _s) { return _s.pid != 0; });
+    std::map<int, ProcStat> const procs = hasProcesses ? readProcStats() : std::map<int, ProcStat>();
+
+    std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    for (auto const& sample : samples)
+    {
+        // The client could be closed or restarted while sampling
+        auto const el = socketMap.find(sample.threadID);
+        if (el == socketMap.end() || el->second.session.get() != sample.session || !el->second.recycleReason.empty())
+            continue;
+
+        sessionInfo& info = el->second;
+        ClientUsage const usage{sample.pid ? processTreeRSS(procs, sample.pid) : 0, sample.latency};
+        if (info.totalRuns <= c_recycleSampleRuns)
+        {
+            info.baseline = usage;
+            continue;
+        }
+        info.recycleReason = clientUsageDegraded(
+            info.baseline, usage, curCFG.cfgFile().recycleMemoryGrowth(), curCFG.cfgFile().recycleLatencyGrowth());
+
+        // Methods first called after the baseline are compared from now on
+        for (auto const& method : usage.latency)
+            info.baseline.latency.emplace(method);
     }
 }
 
 bool RPCSession::isRunningTooLong()
 {
-    static const size_t c_maxTestBeforeFlush = 1500;
     std::lock_guard<std::mutex> lock(g_socketMapMutex);
     ClientConfig const& curCFG = Options::getDynamicOptions().getCurrentConfig();
     for (auto const& el : socketMap)
     {
         sessionInfo const& info = el.second;
-         if (info.configId.id() == curCFG.getId().id() && info.totalRuns > c_maxTestBeforeFlush)
-             return true;
+        if (info.configId.id() == curCFG.getId().id() && !info.recycleReason.empty())
+            return true;
     }
     return false;
 }
 
+void RPCSession::printRecycleStats()
+{
+    std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    if (s_recycledClients.empty())
+        return;
+    ETH_STDOUT_MESSAGE("*** Clients restarted during the run:");
+    for (auto const& el : s_recycledClients)
+        ETH_STDOUT_MESSAGE(el.first + ": " + fto_string(el.second));
+    s_recycledClients.clear();
+}
+
 void RPCSession::restartScripts(bool _stop)
 {
     ClientConfig const& curCFG = Options::getDynamicOptions().getCurrentConfig();
@@ -203,7 +281,7 @@ void RPCSession::restartScripts(bool _stop)
             {
                 // Close all active connection listeners
                 ETH_DC_MESSAGE(DC::RPC, "Restart Client Scripts...");
-                RPCSession::clear();
+                RPCSession::clear(true);
             }
         };
         switch (curCFG.cfgFile().socketType())
@@ -216,8 +294,9 @@ void RPCSession::restartScripts(bool _stop)
     }
 
     // If there are no clients started with this configuration, run the start script
-    // Assume here that socketMap is open for single configuration at a time only
-    if (socketMap.empty())
+    bool const configHasSessions = std::any_of(socketMap.begin(), socketMap.end(),
+        [&curCFG](auto const& _el) { return _el.second.configId == curCFG.getId(); });
+    if (!configHasSessions)
     {
         if (!fs::exists(curCFG.getStartScript()))
             return;
@@ -235,9 +314,17 @@ void RPCSession::restartScripts(bool _stop)
             thread task(cmd, start, test::fto_string(threads) + " 2>/dev/null");
             ETH_DC_MESSAGE(DC::RPC, start);
             task.detach();
-            size_t const initTime = curCFG.cfgFile().initializeTime();
-            size_t const seconds = Options::get().lowcpu ? initTime * 5 : initTime;
-            this_thread::sleep_for(chrono::seconds(seconds));
+
+            // Start script runs a client per thread, wait until they answer
+            auto const deadline = chrono::steady_clock::now() + clientStartTimeout(curCFG);
+            auto const& addresses = curCFG.cfgFile().socketAdresses();
+            for (size_t i = 0; i < std::min(threads, addresses.size()); i++)
+            {
+                auto const timeout = chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now());
+                string const address = addresses.at(i).asString();
+                ETH_FAIL_REQUIRE_MESSAGE(waitForClientVersion(Socket::SocketType::TCP, address, std::max(timeout, chrono::milliseconds(0))),
+                    "Client does not answer web3_clientVersion on: " + address);
+            }
         }
         break;
         default:
@@ -290,7 +377,10 @@ SessionInterface& RPCSession::instance(thread::id const& _threadID)
         }
     }
 
-    ETH_FAIL_REQUIRE_MESSAGE(socketMap.size() <= Options::get().threadCount,
+    // Every client config opens up to threadCount sessions, several configs might run at the same time
+    size_t const configSessions = std::count_if(socketMap.begin(), socketMap.end(),
+        [&currentConfigId](auto const& _el) { return _el.second.configId == currentConfigId; });
+    ETH_FAIL_REQUIRE_MESSAGE(configSessions <= Options::get().threadCount,
         "Something went wrong. Retesteth connect to more instances than needed!");
     ETH_FAIL_REQUIRE_MESSAGE(socketMap.size() != 0, "Something went wrong. Retesteth failed to create socket connection!");
     size_t const threadID = std::hash<std::thread::id>()(_threadID);
@@ -329,29 +419,49 @@ void closeSession(thread::id const& _threadID)
     if (element.session.get()->getImplementation().getSocketType() == Socket::SocketType::IPC)
     {
         test::pclose2(element.filePipe.get(), element.pipePid);
-        std::this_thread::sleep_for(std::chrono::seconds(4));
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+        waitForProcessExit(element.pipePid, std::chrono::seconds(4));
+        waitForClientShutdown(Socket::SocketType::IPC, element.session.get()->getImplementation().getSocketPath(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()));
         boost::filesystem::remove_all(boost::filesystem::path(element.tmpDir));
         element.filePipe.release();
         element.session.release();
     }
 }
 
-void RPCSession::clear()
+void RPCSession::clear(bool _currentConfigOnly)
 {
     // Close all active connection listeners
     std::lock_guard<std::mutex> lock(g_socketMapMutex);
+    auto const& dynOpt = Options::getDynamicOptions();
+    auto const isClosing = [&dynOpt, _currentConfigOnly](sessionInfo const& _info) {
+        return !_currentConfigOnly || _info.configId == dynOpt.getCurrentConfig().getId();
+    };
     std::vector<thread> closingThreads;
     for (auto& element : socketMap)
-        closingThreads.emplace_back(thread(closeSession, element.first));
+        if (isClosing(element.second))
+            closingThreads.emplace_back(thread(closeSession, element.first));
 
     for (auto& th : closingThreads)
         th.join();
 
-    socketMap.clear();
+    for (auto const& element : socketMap)
+    {
+        if (isClosing(element.second) && !element.second.recycleReason.empty())
+        {
+            string client;
+            for (auto const& config : dynOpt.getClientConfigs())
+                if (config.getId() == element.second.configId)
+                    client = config.cfgFile().name() + ", ";
+            s_recycledClients[client + element.second.recycleReason]++;
+        }
+    }
+
+    for (auto it = socketMap.begin(); it != socketMap.end();)
+        it = isClosing(it->second) ? socketMap.erase(it) : std::next(it);
     closingThreads.clear();
 
     // If not running UnitTests or smth
-    auto const& dynOpt = Options::getDynamicOptions();
     if (dynOpt.activeConfigs() > 0 && dynOpt.currentConfigIsSet())
     {
         ClientConfig const& curCFG = dynOpt.getCurrentConfig();
@@ -360,11 +470,17 @@ void RPCSession::clear()
             int exitCode;
             executeCmd(curCFG.getStopperScript().c_str(), exitCode, ExecCMDWarning::NoWarningNoError);
             ETH_DC_MESSAGE(DC::RPC, curCFG.getStopperScript().c_str());
-            if (!ExitHandler::receivedExitSignal() && curCFG.cfgFile().socketType() != ClientConfgSocketType::TransitionTool)
+            if (!ExitHandler::receivedExitSignal() && curCFG.cfgFile().socketType() == ClientConfgSocketType::TCP)
             {
+                // Wait for the stopped clients to release their ports
                 size_t const initTime = curCFG.cfgFile().initializeTime();
                 size_t const seconds = Options::get().lowcpu ? initTime + 10 : initTime;
-                this_thread::sleep_for(chrono::seconds(seconds));
+                auto const deadline = chrono::steady_clock::now() + chrono::seconds(seconds);
+                for (auto const& addr : curCFG.cfgFile().socketAdresses())
+                {
+                    auto const timeout = chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now());
+                    waitForClientShutdown(Socket::SocketType::TCP, addr.asString(), std::max(timeout, chrono::milliseconds(0)));
+                }
             }
         }
     }
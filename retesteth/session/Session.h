@@ -22,12 +22,13 @@ public:
     static void sessionStart(std::thread::id const& _threadID);
     static void sessionEnd(std::thread::id const& _threadID, SessionStatus _status);
     static SessionStatus sessionStatus(std::thread::id const& _threadID);
-    static void clear();
+    static void clear(bool _currentConfigOnly = false);
 
     // Flush the memory by restarting the clients with configuration scripts
     static void currentCfgCountTestRun();            // Increase test run counter
-    static bool isRunningTooLong();                  // True if running connection for tool long
+    static bool isRunningTooLong();                  // True if a client memory or rpc latency grew too much
     static void restartScripts(bool _stop = false);  // Stop all connections (flush)
+    static void printRecycleStats();                 // Restarts of the clients by reason
 
     SessionInterface& getImplementation() { return *m_implementation; }
     ~RPCSession() { delete m_implementation; }
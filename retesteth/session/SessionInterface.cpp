@@ -0,0 +1,67 @@
+#include "SessionInterface.h"
+#include <retesteth/EthChecks.h>
+
+using namespace std;
+
+namespace test::session
+{
+std::map<string, uint64_t> SessionInterface::takeRPCLatency()
+{
+    std::map<string, uint64_t> averages;
+    std::lock_guard<std::mutex> lock(m_rpcLatencyMutex);
+    for (auto const& [method, latency] : m_rpcLatency)
+        averages.emplace(method, latency.first / latency.second);
+    m_rpcLatency.clear();
+    return averages;
+}
+
+void SessionInterface::registerRPCLatency(string const& _method, uint64_t _microseconds)
+{
+    std::lock_guard<std::mutex> lock(m_rpcLatencyMutex);
+    auto& latency = m_rpcLatency[_method];
+    latency.first += _microseconds;
+    latency.second++;
+}
+
+std::vector<spDataObject> SessionInterface::rpcBatch(std::vector<RPCRequest> const& _calls)
+{
+    std::vector<spDataObject> results;
+    results.reserve(_calls.size());
+    for (auto const& call : _calls)
+        results.emplace_back(rpcCall(call.method, call.args));
+    return results;
+}
+
+std::vector<State::Account> SessionInterface::getRemoteAccounts(
+    std::vector<FH20> const& _accounts, VALUE const& _blockNumber, VALUE const& _txIndex)
+{
+    std::vector<State::Account> accounts;
+    accounts.reserve(_accounts.size());
+    for (auto const& address : _accounts)
+    {
+        spVALUE balance = eth_getBalance(address, _blockNumber);
+        spVALUE nonce = eth_getTransactionCount(address, _blockNumber);
+        spBYTES code = eth_getCode(address, _blockNumber);
+
+        bool hasStorage = true;
+        FH32 beginHash = FH32::zero();
+        spStorage storage = spStorage(new Storage());
+        size_t safety = 500;
+        while (hasStorage && --safety)
+        {
+            // Read storage from remote account by pages of records
+            DebugStorageRangeAt res(debug_storageRangeAt(_blockNumber, _txIndex, address, beginHash, c_storageRangePage));
+            if (res.nextKey().isZero())
+                hasStorage = false;
+            else
+                beginHash = res.nextKey();
+            (*storage).merge(res.storage());
+        }
+        if (safety == 0)
+            ETH_ERROR_MESSAGE("remoteGetAccount::DebugStorageRangeAt seems like an endless loop!");
+        accounts.emplace_back(address, balance, nonce, code, storage);
+    }
+    return accounts;
+}
+
+}  // namespace test::session
@@ -2,7 +2,10 @@
 #include "Socket.h"
 #include <libdataobj/DataObject.h>
 #include <retesteth/testStructures/basetypes.h>
+#include <retesteth/testStructures/types/Ethereum/State.h>
 #include <retesteth/testStructures/types/rpc.h>
+#include <map>
+#include <mutex>
 #include <string>
 
 namespace test::session
@@ -36,6 +39,13 @@ private:
 using namespace dataobject;
 using namespace test::teststruct;
 
+// One call of the json-rpc batch
+struct RPCRequest
+{
+    std::string method;
+    std::vector<std::string> args;
+};
+
 class SessionInterface
 {
 public:
@@ -83,15 +93,34 @@ public:
     virtual spDataObject rpcCall(std::string const& _methodName,
         std::vector<std::string> const& _args = std::vector<std::string>(),
         bool _canFail = false) = 0;
+    // Independent calls in one request. A client may execute the batch in any order
+    // Return results in the order of _calls. Default sends the calls one by one
+    virtual std::vector<spDataObject> rpcBatch(std::vector<RPCRequest> const& _calls);
+
+    // Balance, nonce, code and full storage of the accounts at the block
+    virtual std::vector<State::Account> getRemoteAccounts(
+        std::vector<FH20> const& _accounts, VALUE const& _blockNumber, VALUE const& _txIndex);
+
     virtual Socket::SocketType getSocketType() const = 0;
     virtual std::string const& getSocketPath() const = 0;
 
     RPCError const& getLastRPCError() const { return m_lastInterfaceError; }
     virtual ~SessionInterface() {}
 
+    // Average rpc round trip per method in microseconds since the previous call
+    std::map<std::string, uint64_t> takeRPCLatency();
+
 protected:
     inline std::string quote(std::string const& _arg) { return "\"" + _arg + "\""; }
+    void registerRPCLatency(std::string const& _method, uint64_t _microseconds);
     RPCError m_lastInterfaceError;
+
+    // Storage is read from the client by pages of this size
+    static int constexpr c_storageRangePage = 20;
+
+private:
+    std::mutex m_rpcLatencyMutex;
+    std::map<std::string, std::pair<uint64_t, uint64_t>> m_rpcLatency;  // method => (total, calls)
 };
 
 }  // namespace test::session
@@ -3,7 +3,9 @@
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
 #include <chrono>
-#include <memory>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 
@@ -119,77 +121,55 @@ string sendRequestWin(string const& _req)
 }
 #endif
 
-struct WriteThis
-{
-    const char* readptr;
-    size_t sizeleft;
-};
+}  // namespace
 
-static size_t readcallback(void* dest, size_t size, size_t nmemb, void* userp)
+Socket::~Socket()
 {
-    struct WriteThis* wt = (struct WriteThis*)userp;
-    size_t buffer_size = size * nmemb;
-
-    if (wt->sizeleft)
-    {
-        /* copy as much as possible from the source to the destination */
-        size_t copy_this_much = wt->sizeleft;
-        if (copy_this_much > buffer_size)
-            copy_this_much = buffer_size;
-        memcpy(dest, wt->readptr, copy_this_much);
-
-        wt->readptr += copy_this_much;
-        wt->sizeleft -= copy_this_much;
+    if (m_curl)
+        curl_easy_cleanup(m_curl);
+    if (m_curlHeaders)
+        curl_slist_free_all(m_curlHeaders);
+    close(m_socket);
+}
 
-        return copy_this_much; /* we copied this many bytes */
-    }
+void Socket::initCurl()
+{
+    m_curl = curl_easy_init();
+    if (!m_curl)
+        ETH_FAIL_MESSAGE("Error initializing Curl");
 
-    return 0; /* no more data left to deliver */
+    m_curlUrl = m_path;
+    if (m_path.find("http") == string::npos)
+        m_curlUrl = "http://" + m_path;
+
+    m_curlHeaders = curl_slist_append(m_curlHeaders, "Accept: application/json, text/plain");
+    m_curlHeaders = curl_slist_append(m_curlHeaders, "Content-Type: application/json");
+    m_curlHeaders = curl_slist_append(m_curlHeaders, "Expect:");  // don't wait for 100-continue on big requests
+
+    curl_easy_setopt(m_curl, CURLOPT_URL, m_curlUrl.c_str());
+    curl_easy_setopt(m_curl, CURLOPT_BUFFERSIZE, 3000000);
+    curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, writecallback);
+    curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, &m_curlResponse);
+    curl_easy_setopt(m_curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(m_curl, CURLOPT_HTTPHEADER, m_curlHeaders);
+    curl_easy_setopt(m_curl, CURLOPT_TIMEOUT, 500L);
+    curl_easy_setopt(m_curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(m_curl, CURLOPT_TCP_NODELAY, 1L);
 }
 
-string sendRequestTCP(string const& _req, string const& _address)
+string Socket::sendRequestTCP(string const& _req)
 {
-    CURL* curl;
-    CURLcode res;
-    curl = curl_easy_init();
-
-    string url = _address;
-    if (_address.find("http") == string::npos)
-        url = "http://" + _address;
-    if (curl)
-    {
-        std::unique_ptr<std::string> httpData(new std::string());
-        struct WriteThis wt;
-        wt.readptr = _req.c_str();
-        wt.sizeleft = _req.size();
-
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, 3000000);
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writecallback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, httpData.get());
-        curl_easy_setopt(curl, CURLOPT_READFUNCTION, readcallback);
-        curl_easy_setopt(curl, CURLOPT_READDATA, &wt);
-        curl_easy_setopt(curl, CURLOPT_POST, 1L);
-
-        struct curl_slist* header = NULL;
-        header = curl_slist_append(header, "Accept: application/json, text/plain");
-        header = curl_slist_append(header, "Content-Type: application/json");
-        header = curl_slist_append(header, "Transfer-Encoding: chunked");
-
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header);
-        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 500L);
-        res = curl_easy_perform(curl);
-        if (res != CURLE_OK && !ExitHandler::receivedExitSignal())
-            ETH_FAIL_MESSAGE("curl_easy_perform() failed " + string(curl_easy_strerror(res)));
-        curl_slist_free_all(header);
-        curl_easy_cleanup(curl);
-        return *httpData.get();
-    }
-    else
-        ETH_FAIL_MESSAGE("Error initializing Curl");
-    return string();
+    if (!m_curl)
+        initCurl();
+
+    m_curlResponse.clear();
+    curl_easy_setopt(m_curl, CURLOPT_POSTFIELDS, _req.c_str());
+    curl_easy_setopt(m_curl, CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)_req.size());
+    CURLcode const res = curl_easy_perform(m_curl);
+    if (res != CURLE_OK && !ExitHandler::receivedExitSignal())
+        ETH_FAIL_MESSAGE("curl_easy_perform() failed " + string(curl_easy_strerror(res)));
+    return m_curlResponse;
 }
-}  // namespace
 
 string Socket::sendRequestIPC(string const& _req, SocketResponseValidator& _validator)
 {
@@ -202,30 +182,33 @@ string Socket::sendRequestIPC(string const& _req, SocketResponseValidator& _vali
         ETH_FAIL_MESSAGE("Writing on socket failed.");
 
     auto start = chrono::steady_clock::now();
-    ssize_t ret = 0;
-    string reply;
-
+    ssize_t ret = 1;
+    size_t readSize = m_readChunk;
     while (
         _validator.completeResponse() == false &&
         chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count() <
             m_readTimeOutMS)
     {
-        ret = recv(m_socket, m_readBuf, sizeof(m_readBuf), 0);
+        ret = recv(m_socket, _validator.receiveBuffer(readSize), readSize, 0);
 
         // Also consider closed socket an error.
         if (ret < 0)
             ETH_FAIL_MESSAGE("Reading on socket failed!");
+        if (ret == 0)
+            break;
 
-        _validator.acceptResponse(m_readBuf);
-        memset(&m_readBuf[0], 0, sizeof(m_readBuf));
+        _validator.acceptReceived(ret);
+        // Big responses are read with fewer syscalls
+        if ((size_t)ret == readSize && readSize < 64 * m_readChunk)
+            readSize *= 2;
     }
 
-    reply = _validator.getResponse();
-
     if (ret == 0)
+        ETH_FAIL_MESSAGE("Socket closed by the peer before the response was complete.");
+    if (!_validator.completeResponse())
         ETH_FAIL_MESSAGE("Timeout reading on socket.");
 
-    return reply;
+    return _validator.takeResponse();
 }
 
 string Socket::sendRequest(string const& _req, SocketResponseValidator& _val)
@@ -235,7 +218,7 @@ string Socket::sendRequest(string const& _req, SocketResponseValidator& _val)
 #endif
 
     if (m_socketType == Socket::TCP)
-        return sendRequestTCP(_req, m_path);
+        return sendRequestTCP(_req);
 
     if (m_socketType == Socket::IPC)
         return sendRequestIPC(_req, _val);
@@ -243,39 +226,121 @@ string Socket::sendRequest(string const& _req, SocketResponseValidator& _val)
     return string();
 }
 
-JsonObjectValidator::JsonObjectValidator()
+void SocketResponseValidator::acceptResponse(std::string const& _response)
 {
-    m_status = false;
-    m_bracersCount = 0;
-    m_response = string();
+    if (_response.empty())
+        return;
+    memcpy(receiveBuffer(_response.size()), _response.data(), _response.size());
+    acceptReceived(_response.size());
 }
-void JsonObjectValidator::acceptResponse(std::string const& _response)
+
+char* SocketResponseValidator::receiveBuffer(size_t _size)
 {
-    for (size_t i = 0; i < _response.size(); i++)
+    if (m_size + _size > m_capacity)
     {
-        m_response += _response[i];
-        if (_response[i] == '{')
-            m_bracersCount++;
-        else if (_response[i] == '}')
-        {
-            m_bracersCount--;
-            if (m_bracersCount == 0)
-            {
-                m_status = true;
-                break;
-            }
-        }
+        // Grow without filling the new space, recv writes over it
+        m_capacity = std::max(m_size + _size, m_capacity * 2);
+        auto buffer = std::make_unique_for_overwrite<char[]>(m_capacity);
+        if (m_size > 0)
+            memcpy(buffer.get(), m_buffer.get(), m_size);
+        m_buffer = std::move(buffer);
     }
+    return m_buffer.get() + m_size;
 }
 
-bool JsonObjectValidator::completeResponse() const
+void SocketResponseValidator::acceptReceived(size_t _size)
 {
-    return m_status;
+    size_t const begin = m_size;
+    m_size += _size;
+    if (!m_status)
+        scan(begin);
 }
 
-std::string const& JsonObjectValidator::getResponse() const
+void SocketResponseValidator::complete(size_t _size)
 {
-    return m_response;
+    m_status = true;
+    m_response.assign(m_buffer.get(), _size);
+}
+
+namespace
+{
+// First quote, brace or bracket in [_p, _end), 16 bytes at a time where SSE2 is available
+char const* findStructural(char const* _p, char const* _end)
+{
+#if defined(__SSE2__)
+    while (_end - _p >= 16)
+    {
+        __m128i const chars = _mm_loadu_si128(reinterpret_cast<__m128i const*>(_p));
+        __m128i const quote = _mm_cmpeq_epi8(chars, _mm_set1_epi8('"'));
+        __m128i const braces =
+            _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('{')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('}')));
+        __m128i const brackets =
+            _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('[')), _mm_cmpeq_epi8(chars, _mm_set1_epi8(']')));
+        int const mask = _mm_movemask_epi8(_mm_or_si128(quote, _mm_or_si128(braces, brackets)));
+        if (mask != 0)
+            return _p + __builtin_ctz(mask);
+        _p += 16;
+    }
+#endif
+    while (_p < _end && *_p != '"' && *_p != '{' && *_p != '}' && *_p != '[' && *_p != ']')
+        _p++;
+    return _p;
+}
+}  // namespace
+
+void JsonObjectValidator::scan(size_t _begin)
+{
+    char const* const data = receivedData();
+    char const* const end = data + receivedSize();
+    char const* p = data + _begin;
+    while (p < end)
+    {
+        if (m_inString)
+        {
+            // Skip the string body to the closing quote, escaped quote has odd number of backslashes before it
+            char const* quote = static_cast<char const*>(memchr(p, '"', end - p));
+            char const* const stop = quote ? quote : end;
+            char const* back = stop;
+            while (back > p && *(back - 1) == '\\')
+                back--;
+            size_t const backslashes = (stop - back) + (back == p ? m_backslashes : 0);
+            if (!quote)
+            {
+                m_backslashes = backslashes;
+                return;
+            }
+            m_backslashes = 0;
+            m_inString = backslashes % 2 == 1;
+            p = quote + 1;
+            continue;
+        }
+
+        // Outside of strings only the quotes, braces and brackets matter
+        p = findStructural(p, end);
+        if (p == end)
+            return;
+        switch (*p++)
+        {
+        case '"':
+            if (m_depth > 0)
+                m_inString = true;
+            break;
+        case '{':
+        case '[':
+            m_depth++;
+            break;
+        case '}':
+        case ']':
+            if (m_depth > 0 && --m_depth == 0)
+            {
+                complete(p - data);
+                return;
+            }
+            break;
+        default:
+            break;
+        }
+    }
 }
 
 }  // namespace test::session
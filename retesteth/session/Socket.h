@@ -11,30 +11,53 @@
 #endif
 
 #include <boost/noncopyable.hpp>
+#include <curl/curl.h>
+#include <memory>
 #include <string>
 
 namespace test::session
 {
+// Collects the received bytes until the response is complete
+// Socket receives straight into the tail of the receive buffer, the buffer grows as needed
 class SocketResponseValidator
 {
 public:
-    virtual void acceptResponse(std::string const& _response) = 0;
-    virtual bool completeResponse() const = 0;
-    virtual std::string const& getResponse() const = 0;
+    virtual ~SocketResponseValidator() {}
+    void acceptResponse(std::string const& _response);
+    bool completeResponse() const { return m_status; }
+    std::string const& getResponse() const { return m_response; }
+    std::string takeResponse() { return std::move(m_response); }
+
+    char* receiveBuffer(size_t _size);
+    void acceptReceived(size_t _size);
+
+protected:
+    // Scan the received bytes from _begin, when the response is complete call complete()
+    virtual void scan(size_t _begin) = 0;
+    // Set m_status and take the first _size received bytes as the response, the trailing bytes are dropped
+    void complete(size_t _size);
+    char const* receivedData() const { return m_buffer.get(); }
+    size_t receivedSize() const { return m_size; }
+    std::string m_response;
+    bool m_status = false;
+
+private:
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_size = 0;
+    size_t m_capacity = 0;
 };
 
+// Reads one json value, an object or an array (json-rpc batch response)
+// Braces and brackets inside json strings are skipped
 class JsonObjectValidator : public SocketResponseValidator
 {
-public:
-    JsonObjectValidator();
-    void acceptResponse(std::string const& _response) override;
-    bool completeResponse() const override;
-    std::string const& getResponse() const override;
+protected:
+    void scan(size_t _begin) override;
 
 private:
-    std::string m_response;
-    bool m_status;
-    int m_bracersCount;
+    int m_depth = 0;
+    bool m_inString = false;
+    size_t m_backslashes = 0;  // backslashes in a row before the scan position, inside a string
 };
 
 #if defined(_WIN32)
@@ -63,7 +86,7 @@ public:
     };
     explicit Socket(SocketType _type, std::string const& _path);
     std::string sendRequest(std::string const& _req, SocketResponseValidator& _responseValidator);
-    ~Socket() { close(m_socket); }
+    ~Socket();
 
     std::string const& path() const { return m_path; }
     SocketType type() const { return m_socketType; }
@@ -75,8 +98,16 @@ private:
     /// Socket read timeout in milliseconds. Needs to be large because the key generation routine
     /// might take long.
     unsigned static constexpr m_readTimeOutMS = 130000;
-    char m_readBuf[512000];
+    size_t static constexpr m_readChunk = 65536;
     std::string sendRequestIPC(std::string const& _req, SocketResponseValidator& _val);
+
+    /// TCP requests reuse one curl handle, so the http connection is kept alive between requests
+    CURL* m_curl = nullptr;
+    struct curl_slist* m_curlHeaders = nullptr;
+    std::string m_curlUrl;
+    std::string m_curlResponse;
+    void initCurl();
+    std::string sendRequestTCP(std::string const& _req);
 };
 #endif
 
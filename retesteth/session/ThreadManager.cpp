@@ -6,16 +6,21 @@
 #include <retesteth/helpers/TestHelper.h>
 #include <condition_variable>
 
-size_t g_activejobs = 0;
-std::mutex g_jobsmutex;
-std::condition_variable g_cv;
-std::mutex g_callbackmutex;
 using namespace std;
 
 namespace test::session
 {
-unsigned int ThreadManager::currConfigId = 0;
-map<thread::id, thread> ThreadManager::threadMap;
+// Jobs started by one thread (one client config when running --concurrentclients)
+struct ThreadManager::JobCounter
+{
+    size_t activeJobs = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+thread_local unsigned int ThreadManager::currConfigId = 0;
+thread_local map<thread::id, thread> ThreadManager::threadMap;
+thread_local std::shared_ptr<ThreadManager::JobCounter> ThreadManager::jobCounter;
 using namespace test;
 
 size_t ThreadManager::getMaxAllowedThreads()
@@ -42,23 +47,29 @@ size_t ThreadManager::getMaxAllowedThreads()
 
 void ThreadManager::addTask(std::function<void()> _job)
 {
+    if (!jobCounter)
+        jobCounter = std::make_shared<JobCounter>();
     {
-         std::lock_guard<std::mutex> lk(g_jobsmutex);
-         g_activejobs++;
+         std::lock_guard<std::mutex> lk(jobCounter->mutex);
+         jobCounter->activeJobs++;
     }
 
-    auto wrappedJob = [_job](){
-        _job();
-        g_cv.notify_one();
-        std::lock_guard<std::mutex> lk(g_jobsmutex);
-        g_activejobs--;
+    // The job runs with the client config of the thread that started it
+    ClientConfig const& currConfig = Options::get().getDynamicOptions().getCurrentConfig();
+    auto wrappedJob = [_job, counter = jobCounter, &currConfig](){
+        {
+            Options::DynamicOptions::TaskConfigScope scope(currConfig);
+            _job();
+        }
+        std::lock_guard<std::mutex> lk(counter->mutex);
+        counter->activeJobs--;
+        counter->cv.notify_one();
     };
     thread workThread(wrappedJob);
     threadMap.emplace(workThread.get_id(), std::move(workThread));
 
     // See how many connections we can afford on current running configuration
-    static size_t maxAllowedThreads = getMaxAllowedThreads();
-    ClientConfig const& currConfig = Options::get().getDynamicOptions().getCurrentConfig();
+    static thread_local size_t maxAllowedThreads = getMaxAllowedThreads();
     if (currConfigId != currConfig.getId().id())
     {
         currConfigId = currConfig.getId().id();
@@ -119,14 +130,7 @@ void ThreadManager::joinThreads(bool _all)
 
 void ThreadManager::waitForAtLeastOneJobToFinish()
 {
-    std::unique_lock<std::mutex> lkj(g_jobsmutex);
-    if (g_activejobs != 0)
-    {
-        lkj.unlock();
-        std::unique_lock<std::mutex> lk(g_callbackmutex);
-        g_cv.wait(lk);
-    }
-    else
-        lkj.unlock();
+    std::unique_lock<std::mutex> lk(jobCounter->mutex);
+    jobCounter->cv.wait(lk, [](){ return jobCounter->activeJobs < threadMap.size(); });
 }
 }  // namespace test::session
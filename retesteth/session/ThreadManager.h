@@ -1,5 +1,6 @@
 #pragma once
 #include <map>
+#include <memory>
 #include <thread>
 #include <functional>
 
@@ -7,6 +8,7 @@ namespace test::session
 {
 // Manages jobs ensuring that only as many as -j flag allows are currently running
 // Construct over the Session class which manages new connections to the clients
+// Jobs are tracked per starting thread, so each client config of --concurrentclients has its own -j jobs
 class ThreadManager
 {
 public:
@@ -16,8 +18,10 @@ private:
     ThreadManager() {}
     static void waitForAtLeastOneJobToFinish();
     static size_t getMaxAllowedThreads();
-    static std::map<std::thread::id, std::thread> threadMap;
-    static unsigned int currConfigId;
+    struct JobCounter;
+    static thread_local std::map<std::thread::id, std::thread> threadMap;
+    static thread_local unsigned int currConfigId;
+    static thread_local std::shared_ptr<JobCounter> jobCounter;
 };
 
 }  // namespace test::session
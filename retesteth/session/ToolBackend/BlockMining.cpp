@@ -1,5 +1,6 @@
 #include "BlockMining.h"
 #include "Options.h"
+#include "MockTransition.h"
 #include "ToolChainHelper.h"
 #include "libdataobj/ConvertFile.h"
 #include <libdevcore/CommonIO.h>
@@ -75,7 +76,7 @@ void makeEnvExcessBlobGas(spDataObject& _envData, spBlockHeader const& _parentBl
         {
             (*_envData).removeKey(c_currentExcessBlobGas);
             (*_envData).removeKey(c_currentBlobGasUsed);
-            if (_fork == "ShanghaiToCancunAtTime15k" && _parentBlockH->type() != BlockType::BlockHeader4844)
+            if (_fork == C_FORK_SHANGHAITOCANCUNATTIME15K && _parentBlockH->type() != BlockType::BlockHeader4844)
             {
                 BlockHeader4844 const& h4844 = BlockHeader4844::castFrom(_currentBlockH);
                 (*_envData)[c_currentExcessBlobGas] = h4844.excessBlobGas().asString();
@@ -139,6 +140,7 @@ void BlockMining::prepareEnvFile()
     // Options Hook
     Options::getCurrentConfig().performFieldReplace(envData.getContent(), FieldReplaceDir::RetestethToClient);
 
+    m_envData = envData;
     m_envPathContent = envData->asJson();
     writeFile(m_envPath.string(), m_envPathContent);
 }
@@ -152,7 +154,8 @@ void BlockMining::prepareAllocFile()
 
 void BlockMining::prepareTxnFile()
 {
-    bool const exportRLP = !Options::getCurrentConfig().cfgFile().transactionsAsJson();
+    auto const& cfgFile = Options::getCurrentConfig().cfgFile();
+    bool const exportRLP = !cfgFile.transactionsAsJson() && cfgFile.socketType() != ClientConfgSocketType::MockTransitionTool;
     string const txsfile = exportRLP ? "txs.rlp" : "txs.json";
     m_txsPath = m_chainRef.tmpDir() / txsfile;
 
@@ -169,7 +172,8 @@ void BlockMining::prepareTxnFile()
     }
     else
     {
-        DataObject txs(DataType::Array);
+        m_txsData = spDataObject(new DataObject(DataType::Array));
+        DataObject& txs = m_txsData.getContent();
         static u256 c_maxGasLimit = u256("0xffffffffffffffff");
         for (auto const& tr : m_currentBlockRef.transactions())
         {
@@ -202,15 +206,12 @@ void BlockMining::executeTransition()
     auto tupleRewardFork = prepareReward(m_engine, m_chainRef.fork(), m_currentBlockRef);
     m_cmd += " --state.fork " + std::get<1>(tupleRewardFork).asString();
 
-    if (m_engine == SealEngine::NoReward)
-        m_cmd += " --state.reward 0";
-    else
-    {
-        if (m_engine == SealEngine::Genesis)
-            m_cmd += " --state.reward -1";
-        else
-            m_cmd += " --state.reward " + std::get<0>(tupleRewardFork).asDecString();
-    }
+    string reward = "0";
+    if (m_engine == SealEngine::Genesis)
+        reward = "-1";
+    else if (m_engine != SealEngine::NoReward)
+        reward = std::get<0>(tupleRewardFork).asDecString();
+    m_cmd += " --state.reward " + reward;
 
     auto const& params = m_chainRef.params().getCContent().params();
     if (params.count("chainID"))
@@ -245,6 +246,17 @@ void BlockMining::executeTransition()
     }
     ETH_DC_MESSAGE(DC::RPC, "Env:\n" + m_envPathContent);
 
+    if (Options::getCurrentConfig().cfgFile().socketType() == ClientConfgSocketType::MockTransitionTool)
+    {
+        // The alloc of the block state is shared, the mock works on a copy like a tool on alloc.json
+        spDataObject alloc = m_currentBlockRef.state()->asDataObject()->copy();
+        TestOutputHelper::get().timer().startSubcallTimer();
+        m_mockResult = mockTransition(alloc, m_txsData.getCContent(), m_envData.getCContent(), reward);
+        TestOutputHelper::get().timer().finishSubcallTimer();
+        m_mockExecuted = true;
+        return;
+    }
+
     int exitcode;
     TestOutputHelper::get().timer().startSubcallTimer();
     string out = test::executeCmd(m_cmd, exitcode, ExecCMDWarning::NoWarningNoError);
@@ -261,26 +273,34 @@ void BlockMining::executeTransition()
 
 ToolResponse BlockMining::readResult()
 {
-    const string outPathContent = dev::contentsString(m_outPath.string());
-    const string outAllocPathContent = dev::contentsString(m_outAllocPath.string());
-    ETH_DC_MESSAGE(DC::RPC, "Res:\n" + outPathContent);
-    ETH_DC_MESSAGE(DC::RPC, "RAlloc:\n" + outAllocPathContent);
+    if (m_mockExecuted)
+    {
+        ETH_DC_MESSAGE(DC::RPC, "Res:\n" + m_mockResult.result->asJson());
+        ToolResponse toolResponse(m_mockResult.result.getCContent());
+        toolResponse.attachState(restoreFullState(m_mockResult.alloc.getContent()));
+        return toolResponse;
+    }
+
+    dev::MappedFile const outPathContent(m_outPath);
+    dev::MappedFile const outAllocPathContent(m_outAllocPath);
+    ETH_DC_MESSAGE(DC::RPC, "Res:\n" + string(outPathContent.view()));
+    ETH_DC_MESSAGE(DC::RPC, "RAlloc:\n" + string(outAllocPathContent.view()));
     ETH_DC_MESSAGEC(DC::RPC, "Tool log: \n" + dev::contentsString(m_outErrorPath.string()), LogColor::YELLOW);
 
-    if (outPathContent.empty())
+    if (outPathContent.size() == 0)
     {
         const string outErrorContent = dev::contentsString(m_outErrorPath.string());
         ETH_ERROR_MESSAGE("Tool returned empty file: " + m_outPath.string() + "\n" + outErrorContent);
     }
-    if (outAllocPathContent.empty())
+    if (outAllocPathContent.size() == 0)
     {
         const string outErrorContent = dev::contentsString(m_outErrorPath.string());
         ETH_ERROR_MESSAGE("Tool returned empty file: " + m_outAllocPath.string() + "\n" + outErrorContent);
     }
 
     // Construct block rpc response
-    ToolResponse toolResponse(ConvertJsoncppStringToData(outPathContent));
-    spDataObject returnState = ConvertJsoncppStringToData(outAllocPathContent);
+    ToolResponse toolResponse(ConvertJsoncppStringToData(outPathContent.view()));
+    spDataObject returnState = ConvertJsoncppStringToData(outAllocPathContent.view());
     toolResponse.attachState(restoreFullState(returnState.getContent()));
 
     const bool traceCondition = Options::get().vmtrace && m_currentBlockRef.header()->number() != 0;
@@ -1,4 +1,5 @@
 #pragma once
+#include "MockTransition.h"
 #include "ToolChain.h"
 #include <testStructures/types/RPC/ToolResponse.h>
 #include <boost/filesystem/path.hpp>
@@ -40,6 +41,12 @@ private:
     boost::filesystem::path m_outAllocPath;
     boost::filesystem::path m_outErrorPath;
     std::string m_cmd;
+
+    // Inputs and outputs of the in-process mock tool
+    spDataObject m_envData;
+    spDataObject m_txsData;
+    MockTransitionResult m_mockResult;
+    bool m_mockExecuted = false;
     void traceTransactions(ToolResponse& _toolResponse);
 };
 }  // namespace toolimpl
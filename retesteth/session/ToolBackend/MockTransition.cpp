@@ -0,0 +1,215 @@
+#include "MockTransition.h"
+#include <libdevcore/CommonData.h>
+#include <libdevcore/FixedHash.h>
+#include <libdevcore/SHA3.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/testStructures/types/Ethereum/TrieRoots.h>
+#include <retesteth/testStructures/types/Ethereum/Transactions/TransactionReader.h>
+
+using namespace std;
+using namespace dev;
+using namespace dataobject;
+using namespace test::teststruct;
+
+namespace
+{
+string const c_emptyListHash = "0x1dcc4de8dec75d7aab85b567b6ccd41ad312451b948a7413f0a142fd40d49347";
+u256 const c_txGas = 21000;
+u256 const c_blobGasTarget = 393216;
+
+u256 readU256(DataObject const& _obj, string const& _key)
+{
+    return _obj.count(_key) ? u256(_obj.atKey(_key).asString()) : u256(0);
+}
+
+// Rebuild the transaction out of its txs.json form to get the bytes of the transactions trie
+spTransaction readToolTransaction(DataObject const& _tx)
+{
+    spDataObject tx = _tx.copy();
+    (*tx).renameKey("gas", "gasLimit");
+    (*tx).renameKey("input", "data");
+    (*tx).removeKey("secretKey");
+    return readTransaction(dataobject::move(tx));
+}
+
+DataObject& getAccount(DataObject& _alloc, string const& _address)
+{
+    DataObject& account = _alloc[_address];
+    if (!account.count("balance"))
+        account["balance"] = "0x00";
+    if (!account.count("code"))
+        account["code"] = "0x";
+    if (!account.count("nonce"))
+        account["nonce"] = "0x00";
+    if (!account.count("storage"))
+        account.addSubObject("storage", spDataObject(new DataObject(DataType::Object)));
+    return account;
+}
+
+void addBalance(DataObject& _alloc, string const& _address, u256 const& _amount)
+{
+    DataObject& account = getAccount(_alloc, _address);
+    account["balance"] = toCompactHexPrefixed(readU256(account, "balance") + _amount, 1);
+}
+
+spDataObject makeReceipt(DataObject const& _tx, size_t _index, u256 const& _cumulativeGas)
+{
+    spDataObject receipt;
+    (*receipt)["type"] = _tx.count("type") ? _tx.atKey("type").asString() : "0x0";
+    (*receipt)["root"] = "0x";
+    (*receipt)["status"] = "0x1";
+    (*receipt)["cumulativeGasUsed"] = toCompactHexPrefixed(_cumulativeGas, 1);
+    (*receipt)["logsBloom"] = toHexPrefixed(h2048());
+    (*receipt)["transactionHash"] = _tx.atKey("hash").asString();
+    (*receipt)["gasUsed"] = toCompactHexPrefixed(c_txGas, 1);
+    (*receipt)["transactionIndex"] = toCompactHexPrefixed(_index, 1);
+    return receipt;
+}
+
+spDataObject makeRejected(size_t _index, string const& _error)
+{
+    spDataObject rejected;
+    (*rejected)["index"] = (int)_index;
+    (*rejected)["error"] = _error;
+    return rejected;
+}
+
+void setEnvValues(DataObject& _result, DataObject const& _env)
+{
+    if (_env.count("currentDifficulty"))
+        _result["currentDifficulty"] = _env.atKey("currentDifficulty").asString();
+    else if (_env.count("parentDifficulty"))
+        _result["currentDifficulty"] = _env.atKey("parentDifficulty").asString();
+    else
+        _result.addSubObject("currentDifficulty", spDataObject(new DataObject(DataType::Null)));
+
+    if (_env.count("currentBaseFee"))
+        _result["currentBaseFee"] = _env.atKey("currentBaseFee").asString();
+    else if (_env.count("parentBaseFee"))
+        _result["currentBaseFee"] = _env.atKey("parentBaseFee").asString();
+
+    if (_env.count("withdrawals"))
+    {
+        vector<spWithdrawal> withdrawals;
+        for (auto const& wt : _env.atKey("withdrawals").getSubObjects())
+            withdrawals.emplace_back(spWithdrawal(new Withdrawal(wt.getCContent())));
+        _result["withdrawalsRoot"] = withdrawalsRoot(withdrawals).asString();
+    }
+
+    // No blob transactions are executed, the excess only follows the parent
+    if (_env.count("parentExcessBlobGas"))
+    {
+        u256 const parentBlobGas = readU256(_env, "parentExcessBlobGas") + readU256(_env, "parentBlobGasUsed");
+        u256 const excess = parentBlobGas > c_blobGasTarget ? parentBlobGas - c_blobGasTarget : u256(0);
+        _result["currentExcessBlobGas"] = toCompactHexPrefixed(excess, 1);
+        _result["blobGasUsed"] = "0x00";
+    }
+    else if (_env.count("currentExcessBlobGas"))
+    {
+        _result["currentExcessBlobGas"] = _env.atKey("currentExcessBlobGas").asString();
+        _result["blobGasUsed"] = "0x00";
+    }
+}
+}  // namespace
+
+namespace toolimpl
+{
+MockTransitionResult mockTransition(spDataObject& _alloc, DataObject const& _txs, DataObject const& _env, string const& _reward)
+{
+    try
+    {
+        // Transactions only pay the intrinsic gas and bump the sender nonce
+        DataObject& alloc = _alloc.getContent();
+        u256 const blockGasLimit = readU256(_env, "currentGasLimit");
+        u256 gasUsed = 0;
+        spDataObject receipts(new DataObject(DataType::Array));
+        spDataObject rejected(new DataObject(DataType::Array));
+        vector<spTransaction> included;
+        vector<ToolResponseReceipt> includedReceipts;
+        size_t index = 0;
+        for (auto const& tx : _txs.getSubObjects())
+        {
+            DataObject& sender = getAccount(alloc, tx->atKey("sender").asString());
+            u256 const nonce = readU256(sender, "nonce");
+            u256 const txNonce = readU256(tx.getCContent(), "nonce");
+            if (txNonce != nonce)
+                (*rejected).addArrayObject(makeRejected(index, txNonce < nonce ? "nonce too low" : "nonce too high"));
+            else if (readU256(tx.getCContent(), "gas") < c_txGas)
+                (*rejected).addArrayObject(makeRejected(index, "intrinsic gas too low"));
+            else if (gasUsed + c_txGas > blockGasLimit)
+                (*rejected).addArrayObject(makeRejected(index, "gas limit reached"));
+            else
+            {
+                sender["nonce"] = toCompactHexPrefixed(nonce + 1, 1);
+                gasUsed += c_txGas;
+                spDataObject receipt = makeReceipt(tx.getCContent(), index, gasUsed);
+                includedReceipts.emplace_back(ToolResponseReceipt(receipt.getCContent()));
+                (*receipts).addArrayObject(receipt);
+                included.emplace_back(readToolTransaction(tx.getCContent()));
+            }
+            index++;
+        }
+
+        if (_env.count("withdrawals"))
+        {
+            for (auto const& wt : _env.atKey("withdrawals").getSubObjects())
+                addBalance(alloc, wt->atKey("address").asString(), readU256(wt.getCContent(), "amount") * u256(1000000000));
+        }
+
+        if (_reward != "-1" && _env.count("currentCoinbase"))
+        {
+            u256 const reward(_reward);
+            if (reward > 0)
+                addBalance(alloc, _env.atKey("currentCoinbase").asString(), reward);
+        }
+
+        MockTransitionResult res;
+        DataObject& result = res.result.getContent();
+        spDataObject allocCopy = alloc.copy();
+        result["stateRoot"] = stateRoot(State(dataobject::move(allocCopy))).asString();
+        result["txRoot"] = transactionsRoot(included).asString();
+        result["receiptsRoot"] = receiptsRoot(includedReceipts).asString();
+        result["logsHash"] = c_emptyListHash;
+        result["logsBloom"] = toHexPrefixed(h2048());
+        result.addSubObject("receipts", receipts);
+        if (!rejected->getSubObjects().empty())
+            result.addSubObject("rejected", rejected);
+        result["gasUsed"] = toCompactHexPrefixed(gasUsed, 1);
+        setEnvValues(result, _env);
+        res.alloc = _alloc;
+        return res;
+    }
+    catch (test::UpwardsException const&)
+    {
+        throw;
+    }
+    catch (std::exception const& _ex)
+    {
+        throw test::UpwardsException(string("Mock t8n failed: ") + _ex.what());
+    }
+}
+
+spDataObject mockRawTransaction(BYTES const& _rlp)
+{
+    spDataObject out;
+    (*out)["result"] = true;
+    spDataObject tr;
+    (*tr)["intrinsicGas"] = toCompactHexPrefixed(c_txGas, 1);
+    try
+    {
+        spTransaction spTr = readTransaction(_rlp);
+        (*tr)["sender"] = spTr->sender().asString();
+        (*tr)["hash"] = spTr->hash().asString();
+        (*out)["acceptedTransactions"].addArrayObject(tr);
+    }
+    catch (std::exception const& _ex)
+    {
+        (*tr)["error"] = string(_ex.what());
+        (*tr)["sender"] = FH20::zero().asString();
+        (*tr)["hash"] = toHexPrefixed(sha3(fromHex(_rlp.asString())));
+        (*out)["rejectedTransactions"].addArrayObject(tr);
+    }
+    return out;
+}
+
+}  // namespace toolimpl
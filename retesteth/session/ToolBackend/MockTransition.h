@@ -0,0 +1,26 @@
+#pragma once
+#include <libdataobj/DataObject.h>
+#include <retesteth/testStructures/basetypes/BYTES.h>
+
+namespace toolimpl
+{
+// In-process t8n of the `mock-tool` socket type. Implements the t8n input/output contract without an EVM,
+// so the runs measure retesteth itself: a valid transaction costs 21000 gas and bumps the sender nonce,
+// withdrawals and the block reward are credited, the state, transactions, receipts and withdrawals roots
+// are the trie roots of the outputs.
+// The same inputs always produce the same result and alloc
+struct MockTransitionResult
+{
+    dataobject::spDataObject result;  // out.json
+    dataobject::spDataObject alloc;   // outAlloc.json
+};
+
+// _alloc, _txs (json, tool style) and _env as written to alloc.json, txs.json and env.json
+// _reward as --state.reward: block reward in wei, -1 to skip the reward
+MockTransitionResult mockTransition(
+    dataobject::spDataObject& _alloc, dataobject::DataObject const& _txs, dataobject::DataObject const& _env, std::string const& _reward);
+
+// test_rawTransaction response of the mock: the transaction is accepted if retesteth can decode it
+dataobject::spDataObject mockRawTransaction(test::teststruct::BYTES const& _rlp);
+
+}  // namespace toolimpl
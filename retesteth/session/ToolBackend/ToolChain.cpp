@@ -1,8 +1,10 @@
 #include "BlockMining.h"
 #include "Verification.h"
 #include <Options.h>
+#include <retesteth/Constants.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <testStructures/Common.h>
+#include <testStructures/types/Ethereum/TrieRoots.h>
 
 using namespace dev;
 using namespace std;
@@ -46,10 +48,10 @@ ToolChain::ToolChain(
     if (opt.cfgFile().support1559() && inArray(forks, m_fork.getCContent()))
     {
         auto const genesisHeaderType = _genesis.header()->type();
-        if (compareFork(m_fork, CMP::lt, FORK("London"))
+        if (compareFork(m_fork, CMP::lt, C_FORK_LONDON)
             && genesisHeaderType == BlockType::BlockHeader1559)
             throw test::UpwardsException("Constructing 1559 genesis on network which is lower London!");
-        if (compareFork(m_fork, CMP::ge, FORK("London"))
+        if (compareFork(m_fork, CMP::ge, C_FORK_LONDON)
             && genesisHeaderType != BlockType::BlockHeader1559
             && genesisHeaderType != BlockType::BlockHeaderMerge
             && genesisHeaderType != BlockType::BlockHeaderShanghai
@@ -62,8 +64,13 @@ ToolChain::ToolChain(
     if (_genesisPolicy == ToolChainGenesis::CALCULATE)
     {
         // We yet don't know the state root of genesis. Ask the tool to calculate it
-        ToolResponse const res = mineBlockOnTool(_genesis, _genesis, SealEngine::NoReward);
-        genesisFixed.headerUnsafe().getContent().setStateRoot(res.stateRoot());
+        if (opt.cfgFile().calculateStateRoot())
+            genesisFixed.headerUnsafe().getContent().setStateRoot(stateRoot(_genesis.state()));
+        else
+        {
+            ToolResponse const res = mineBlockOnTool(_genesis, _genesis, SealEngine::NoReward);
+            genesisFixed.headerUnsafe().getContent().setStateRoot(res.stateRoot());
+        }
         genesisFixed.headerUnsafe().getContent().recalculateHash();
         genesisFixed.setTotalDifficulty(genesisFixed.header()->difficulty());
     }
@@ -137,6 +144,7 @@ spDataObject const ToolChain::mineBlock(EthereumBlockState const& _pendingBlock,
     miningResult = coorectTransactionsByToolResponse(res, pendingFixed, _pendingBlock, _req);
     for (auto const& wt : _pendingBlock.withdrawals())
         pendingFixed.addWithdrawal(wt);
+    checkRootsAgainstRetesteth(res, pendingFixed);
     correctUncleHeaders(pendingFixed, _pendingBlock);
 
     // Calculate header hash from header fields (does not recalc tx, un hashes)
@@ -202,6 +210,35 @@ void ToolChain::checkBasefeeAgainstRetesteth(VALUE const& _toolBasefee, spBlockH
     }
 }
 
+void ToolChain::checkRootsAgainstRetesteth(ToolResponse const& _res, EthereumBlockState const& _pendingFixed)
+{
+    if (!test::Options::getCurrentConfig().cfgFile().checkStateRoot())
+        return;
+    FH32 const retestethStateRoot = stateRoot(_res.state());
+    if (_res.stateRoot() != retestethStateRoot)
+        ETH_WARNING("tool vs retesteth stateRoot disagree: " + _res.stateRoot().asString() + " vs " +
+                    retestethStateRoot.asString());
+    FH32 const retestethTxRoot = transactionsRoot(_pendingFixed.transactions());
+    if (_res.txRoot() != retestethTxRoot)
+        ETH_WARNING("tool vs retesteth txRoot disagree: " + _res.txRoot().asString() + " vs " +
+                    retestethTxRoot.asString());
+    auto const& receipts = _res.receipts();
+    if (std::all_of(receipts.begin(), receipts.end(), [](ToolResponseReceipt const& _receipt) { return !_receipt.consensusBytes().empty(); }))
+    {
+        FH32 const retestethReceiptsRoot = receiptsRoot(receipts);
+        if (_res.receiptRoot() != retestethReceiptsRoot)
+            ETH_WARNING("tool vs retesteth receiptsRoot disagree: " + _res.receiptRoot().asString() + " vs " +
+                        retestethReceiptsRoot.asString());
+    }
+    if (!_res.withdrawalsRoot().isZero())
+    {
+        FH32 const retestethWithdrawalsRoot = withdrawalsRoot(_pendingFixed.withdrawals());
+        if (_res.withdrawalsRoot() != retestethWithdrawalsRoot)
+            ETH_WARNING("tool vs retesteth withdrawalsRoot disagree: " + _res.withdrawalsRoot().asString() + " vs " +
+                        retestethWithdrawalsRoot.asString());
+    }
+}
+
 void ToolChain::setAndCheckDifficulty(VALUE const& _difficulty, spBlockHeader& _pendingHeader)
 {
     if (isBlockExportDifficulty(_pendingHeader))
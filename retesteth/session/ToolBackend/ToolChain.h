@@ -87,6 +87,7 @@ private:
 private:
     void checkDifficultyAgainstRetesteth(VALUE const& _toolDifficulty, spBlockHeader const& _pendingHeader);
     void checkBasefeeAgainstRetesteth(VALUE const& _toolBasefee, spBlockHeader const& _pendingHeader, spBlockHeader const& _parentHeader);
+    void checkRootsAgainstRetesteth(ToolResponse const& _res, EthereumBlockState const& _pendingFixed);
     void calculateAndCheckSetBaseFee(VALUE const& _toolBaseFee, spBlockHeader& _pendingHeader, spBlockHeader const& _parentHeader);
     void setWithdrawalsRoot(FH32 const&, spBlockHeader&);
     void setExcessBlobGasAndGasUsed(ToolResponse const&, spBlockHeader&);
@@ -178,6 +178,8 @@ VALUE calculateGasLimit(VALUE const& _parentGasLimit, VALUE const& _parentGasUse
 // Also remove leading zeros in storage
 spState restoreFullState(DataObject& _toolState)
 {
+    static DataObjectNormalizer const storageNormalizer = {
+        mod_removeLeadingZerosFromHexValueEVEN, mod_removeLeadingZerosFromHexKeyEVEN};
     spDataObject fullState;
     for (auto& accTool2 : _toolState.getSubObjectsUnsafe())
     {
@@ -191,10 +193,7 @@ spState restoreFullState(DataObject& _toolState)
         else
             acc.atKeyPointer(c_storage) = sDataObject(DataType::Object);
         for (auto& storageRecord : acc.atKeyUnsafe(c_storage).getSubObjectsUnsafe())
-        {
-            storageRecord.getContent().performModifier(mod_removeLeadingZerosFromHexValueEVEN);
-            storageRecord.getContent().performModifier(mod_removeLeadingZerosFromHexKeyEVEN);
-        }
+            storageNormalizer.perform(storageRecord.getContent());
     }
     return spState(new State(dataobject::move(fullState)));
 }
@@ -66,7 +66,7 @@ void ToolChainManager::reorganizePendingBlock()
 
     // Because aleth and geth+retesteth does this, but better be empty extraData
     header.setExtraData(bl.header()->extraData());
-    if (currentChain().fork() == "HomesteadToDaoAt5" && header.number() == 5)
+    if (currentChain().fork() == C_FORK_HOMESTEADTODAOAT5 && header.number() == 5)
         header.setExtraData(BYTES(DataObject("0x64616f2d686172642d666f726b")));
     header.setParentHash(currentChain().lastBlock().header()->hash());
 
@@ -108,9 +108,9 @@ EthereumBlockState const& ToolChainManager::blockByHash(FH32 const& _hash) const
 void ToolChainManager::modifyTimestamp(VALUE const& _time)
 {
     m_pendingBlock.getContent().headerUnsafe().getContent().setTimestamp(_time);
-    if (currentChain().fork() == "MergeToShanghaiAtTime15k" && m_pendingBlock->header()->timestamp() >= 15000)
+    if (currentChain().fork() == C_FORK_MERGETOSHANGHAIATTIME15K && m_pendingBlock->header()->timestamp() >= 15000)
         initShanghaiPendingBlock(m_pendingBlock);
-    if (currentChain().fork() == "ShanghaiToCancunAtTime15k" && m_pendingBlock->header()->timestamp() >= 15000)
+    if (currentChain().fork() == C_FORK_SHANGHAITOCANCUNATTIME15K && m_pendingBlock->header()->timestamp() >= 15000)
         initCancunPendingBlock(m_pendingBlock);
 }
 
@@ -255,18 +255,18 @@ void ToolChainManager::transitionPendingBlock(EthereumBlockState const& _bl)
     // Transform pending block to new network
     if (_bl.header()->number() == 4)
     {
-        if (currentChain().fork() == "BerlinToLondonAt5")
+        if (currentChain().fork() == C_FORK_BERLINTOLONDONAT5)
         {
             init1559PendingBlock(_bl);
             return;
         }
     }
 
-    if (currentChain().fork() == "MergeToShanghaiAtTime15k" && m_pendingBlock->header()->timestamp() >= 15000)
+    if (currentChain().fork() == C_FORK_MERGETOSHANGHAIATTIME15K && m_pendingBlock->header()->timestamp() >= 15000)
         initShanghaiPendingBlock(_bl);
-    else if (currentChain().fork() == "ShanghaiToCancunAtTime15k" && m_pendingBlock->header()->timestamp() >= 15000)
+    else if (currentChain().fork() == C_FORK_SHANGHAITOCANCUNATTIME15K && m_pendingBlock->header()->timestamp() >= 15000)
         initCancunPendingBlock(_bl);
-    else if (currentChain().fork() == "ArrowGlacierToMergeAtDiffC0000" && isTerminalPoWBlock())
+    else if (currentChain().fork() == C_FORK_ARROWGLACIERTOMERGEATDIFFC0000 && isTerminalPoWBlock())
         initMergePendingBlock(_bl);
     else
         updatePending();
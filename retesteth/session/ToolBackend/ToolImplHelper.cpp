@@ -98,13 +98,13 @@ spDataObject constructStorageRangeAt(
         {
             size_t iStore = 0;
             size_t iBegin = hexOrDecStringToInt(_begin.asString());
-            for (auto const& el : _block.state()->getAccount(_address).storage().getKeys())
+            for (auto const& el : _block.state()->getAccount(_address).storage().records())
             {
                 if (iStore++ + 1 < iBegin)
                     continue;
                 DataObject& record = (*obj)[fto_string(iStore)];
-                record["key"] = std::get<0>(el.second)->asString();
-                record["value"] = std::get<1>(el.second)->asString();
+                record["key"] = el.keyString();
+                record["value"] = el.value->asString();
                 record.performModifier(mod_removeLeadingZerosFromHexValueEVEN);
 
                 if (constructResponse->atKey("storage").getSubObjects().size() == _maxResult)
@@ -76,7 +76,7 @@ void verify1559Block(spBlockHeader const& _header, ToolChain const& _chain)
     check_gasUsed(_header, "Invalid block1559:");
 
     BlockHeader1559 const& header = BlockHeader1559::castFrom(_header);
-    if (header.number() == 5 && _chain.fork() == "BerlinToLondonAt5")
+    if (header.number() == 5 && _chain.fork() == C_FORK_BERLINTOLONDONAT5)
     {
         // Check first ever EIP1559 gasLimit
         /* https://eips.ethereum.org/EIPS/eip-1559
@@ -89,7 +89,7 @@ void verify1559Block(spBlockHeader const& _header, ToolChain const& _chain)
                 "Invalid block1559: Initial baseFee must be 1000000000, got: " + header.baseFee().asDecString());
     }
 
-    if (_chain.fork() == "ArrowGlacierToMergeAtDiffC0000")
+    if (_chain.fork() == C_FORK_ARROWGLACIERTOMERGEATDIFFC0000)
     {
         bool isTTDDefined = _chain.params()->params().count("terminalTotalDifficulty");
         if (!isTTDDefined)
@@ -176,7 +176,7 @@ void verify1559Parent(spBlockHeader const& _header, spBlockHeader const& _parent
     check_difficultyDelta(_chain, _header, _parent);
 
     BlockHeader1559 const& header = BlockHeader1559::castFrom(_header);
-    if (header.number() == 5 && _chain.fork() == "BerlinToLondonAt5")
+    if (header.number() == 5 && _chain.fork() == C_FORK_BERLINTOLONDONAT5)
     {
         if (_parent->type() != BlockType::BlockHeaderLegacy)
             ETH_FAIL_MESSAGE("verify1559Parent first 1559 block must be on top of legacy block!");
@@ -210,7 +210,7 @@ void verifyShanghaiParent(spBlockHeader const& _header, spBlockHeader const& _pa
         verifyShanghaiBlock(_parent, _chain);
     else
     {
-        if (_header->timestamp() >= 15000 && _chain.fork() == "MergeToShanghaiAtTime15k")
+        if (_header->timestamp() >= 15000 && _chain.fork() == C_FORK_MERGETOSHANGHAIATTIME15K)
         {
             if (_parent->type() != BlockType::BlockHeaderMerge)
                 throw test::UpwardsException("Trying to import Shanghai block on top of Merge block before transition!!");
@@ -227,7 +227,7 @@ void verify4844Parent(spBlockHeader const& _header, spBlockHeader const& _parent
         verify4844Block(_parent, _chain);
     else
     {
-        if (_header->timestamp() >= 15000 && _chain.fork() == "ShanghaiToCancunAtTime15k")
+        if (_header->timestamp() >= 15000 && _chain.fork() == C_FORK_SHANGHAITOCANCUNATTIME15K)
         {
             if (_parent->type() != BlockType::BlockHeaderShanghai)
                 throw test::UpwardsException("Trying to import Cancun block on top of Shanghai block before transition!!");
@@ -296,7 +296,7 @@ void verifyCommonParent(spBlockHeader const& _header, spBlockHeader const& _pare
 
     check_timestamp(_header, _parent);
     bigint parentGasLimit = parent.gasLimit().asBigInt();
-    if (header.number() == 5 && _chain.fork() == "BerlinToLondonAt5")
+    if (header.number() == 5 && _chain.fork() == C_FORK_BERLINTOLONDONAT5)
         parentGasLimit = parentGasLimit * ELASTICITY_MULTIPLIER;
 
     // Verify delta gas (legacy formula)
@@ -1,3 +1,4 @@
+#include "ToolBackend/MockTransition.h"
 #include "ToolBackend/ToolImplHelper.h"
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
@@ -47,10 +48,17 @@ enum class CallType
     }                                                                                                      \
 
 
+bool ToolImpl::isMockTool() const
+{
+    return Options::getCurrentConfig().cfgFile().socketType() == ClientConfgSocketType::MockTransitionTool;
+}
+
 spDataObject ToolImpl::web3_clientVersion()
 {
     rpcCall("", {});
     ETH_DC_MESSAGE(DC::RPC2, "\nRequest: web3_clientVersion");
+    if (isMockTool())
+        return spDataObject(new DataObject("mock t8n"));
     string const cmd = m_toolPath.string() + " -v";
     TRYCATCHCALL(
                 int exitCode;
@@ -330,6 +338,8 @@ TestRawTransaction ToolImpl::test_rawTransaction(BYTES const& _rlp, FORK const&
     rpcCall("", {});
     TRYCATCHCALL(
         ETH_DC_MESSAGE(DC::RPC, "\nRequest: test_rawTransaction '" + _rlp.asString() + "', Fork: `" + t8nForkName.asString());
+        if (isMockTool())
+            return TestRawTransaction(mockRawTransaction(_rlp).getCContent());
         TestRawTransaction res = ToolChainManager::test_rawTransaction(_rlp, t8nForkName, m_toolPath, m_tmpDir);
         return res;
         , "test_rawTransaction", CallType::FAILEVERYTHING, DC::RPC)
@@ -344,6 +354,8 @@ std::string ToolImpl::test_rawEOFCode(BYTES const& _code, FORK const& _fork)
     rpcCall("", {});
     TRYCATCHCALL(
         ETH_DC_MESSAGE(DC::RPC, "\nRequest: test_rawEOFCode '" + _code.asString().substr(0, 50) + "', Fork: `" + t8nForkName.asString());
+        if (isMockTool())
+            throw UpwardsException("test_rawEOFCode is not supported by the mock t8n");
         string res = ToolChainManager::test_rawEOFCode(_code, t8nForkName, m_toolPath, m_tmpDir);
         return res;
         , "test_rawTransaction", CallType::DONTFAILONUPWARDS, DC::RPC)
@@ -368,6 +380,8 @@ VALUE ToolImpl::test_calculateDifficulty(FORK const& _fork, VALUE const& _blockN
         ETH_DC_MESSAGE(DC::RPC, "\nRequest: test_calculateDifficulty '");
         ETH_DC_MESSAGE(DC::RPC, "Fork: " + _fork.asString() + ", bn: " + _blockNumber.asString() + ", pt: " + _parentTimestamp.asString() +
             ", pd: " + _parentDifficulty.asString() + ", ct: " + _currentTimestamp.asString() + ", un: " + _uncleNumber.asString());
+        if (isMockTool())
+            return _parentDifficulty;  // the mock tool keeps the parent difficulty
         return ToolChainManager::test_calculateDifficulty(_fork, _blockNumber, _parentTimestamp, _parentDifficulty, _currentTimestamp, _uncleNumber,
             m_toolPath, m_tmpDir);
         , "test_calculateDifficulty", CallType::FAILEVERYTHING, DC::RPC)
@@ -69,6 +69,7 @@ private:
     size_t m_totalCalls = 0;
     toolimpl::ToolChainManager& blockchain() { return m_toolChainManager.getContent(); }
     void makeRPCError(std::string const& _error);
+    bool isMockTool() const;
 
     // Manage blockchains as ethereum client backend
     GCP_SPointer<toolimpl::ToolChainManager> m_toolChainManager;
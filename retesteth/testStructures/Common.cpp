@@ -272,12 +272,58 @@ void requireJsonFields(DataObject const& _o, std::string const& _config, std::ma
     }
 }
 
+thread_local size_t SkipJsonFieldsCheck::s_depth = 0;
+
+JsonSchema::JsonSchema(std::map<std::string, jsonType> const& _validationMap) : m_validationMap(_validationMap)
+{
+    // Required fields are tracked in a 64 bit mask, bigger schemes use requireJsonFields directly
+    if (_validationMap.size() > 64)
+    {
+        m_compiled = false;
+        return;
+    }
+
+    m_fields.reserve(_validationMap.size());
+    for (auto const& [key, type] : _validationMap)
+    {
+        uint8_t types = 0;
+        for (auto const& t : type.first)
+            types |= uint8_t(1) << t;
+        bool const required = type.second == jsonField::Required;
+        if (required)
+            m_requiredMask |= uint64_t(1) << m_fields.size();
+        m_fields.push_back({key, types, required});
+    }
+}
+
+bool JsonSchema::matches(DataObject const& _o) const
+{
+    if (!m_compiled)
+        return false;
+
+    uint64_t requiredFound = 0;
+    for (auto const& field : _o.getSubObjects())
+    {
+        auto const it = std::lower_bound(m_fields.begin(), m_fields.end(), field->getKey(),
+            [](Field const& _field, string const& _key) { return _field.key < _key; });
+        if (it == m_fields.end() || it->key != field->getKey())
+            return false;
+        if (!(it->types & (uint8_t(1) << field->type())))
+            return false;
+        if (it->required)
+            requiredFound |= uint64_t(1) << (it - m_fields.begin());
+    }
+    return requiredFound == m_requiredMask;
+}
+
 // Compile LLL in code
 // Convert dec fields to hex, add 0x prefix to accounts and storage keys
 void convertDecStateToHex(spDataObject& _data, solContracts const& _preSolidity, StateToHex _compileCode)
 {
     // -- Compile LLL in pre state into byte code if not already
     // -- Convert State::Storage keys/values into hex
+    static DataObjectNormalizer const storageNormalizer = {
+        mod_keyToCompactEvenHexPrefixed, mod_valueToCompactEvenHexPrefixed, mod_keyToLowerCase};
     for (auto& acc2 : (*_data).getSubObjectsUnsafe())
     {
         DataObject& acc = acc2.getContent();
@@ -301,11 +347,7 @@ void convertDecStateToHex(spDataObject& _data, solContracts const& _preSolidity,
         if (acc.count(c_storage))
         {
             for (auto& rec : acc[c_storage].getSubObjectsUnsafe())
-            {
-                rec.getContent().performModifier(mod_keyToCompactEvenHexPrefixed);
-                rec.getContent().performModifier(mod_valueToCompactEvenHexPrefixed);
-                acc.performModifier(mod_keyToLowerCase);
-            }
+                storageNormalizer.perform(rec.getContent());
         }
         acc.performModifier(mod_valueToLowerCase);
     }
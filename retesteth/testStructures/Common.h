@@ -1,6 +1,7 @@
 #pragma once
 #include <retesteth/compiler/Compiler.h>
 #include <libdataobj/DataObject.h>
+#include <libdataobj/DataObjectNormalizer.h>
 #include <retesteth/testStructures/types/Ethereum/Blocks/BlockHeaderReader.h>
 #include <retesteth/testStructures/types/Ethereum/Transactions/TransactionReader.h>
 #include <map>
@@ -43,9 +44,54 @@ static VALUE c_maxNonce(DataObject("0xffffffffffffffff"));
 void requireJsonFields(
     DataObject const& _o, std::string const& _configName, std::map<std::string, jsonType> const& _validationMap);
 
+// Validation map compiled once into a key sorted table with allowed types as a bit mask
+// The object is checked in a single pass over its fields. On mismatch requireJsonFields reports the error
+// Config name is only built when the check fails
+class JsonSchema
+{
+public:
+    JsonSchema(std::map<std::string, jsonType> const& _validationMap);
+    template <class NameGetter>
+    void validate(DataObject const& _o, NameGetter const& _configName) const
+    {
+        if (!matches(_o))
+            requireJsonFields(_o, _configName(), m_validationMap);
+    }
+
+private:
+    bool matches(DataObject const& _o) const;
+    struct Field
+    {
+        std::string key;
+        uint8_t types;
+        bool required;
+    };
+    std::vector<Field> m_fields;
+    uint64_t m_requiredMask = 0;
+    bool m_compiled = true;
+    std::map<std::string, jsonType> m_validationMap;
+};
+
+// Disable REQUIRE_JSONFIELDS checks in this thread while in scope
+// Use for data that retesteth exported from already validated structures
+class SkipJsonFieldsCheck
+{
+public:
+    SkipJsonFieldsCheck() { s_depth++; }
+    ~SkipJsonFieldsCheck() { s_depth--; }
+    static bool active() { return s_depth > 0; }
+
+private:
+    static thread_local size_t s_depth;
+};
+
 #define REQUIRE_JSONFIELDS(_data, _name, ...)  \
- static std::map<std::string, jsonType> requireJsonFieldsMap = __VA_ARGS__; \
- requireJsonFields(_data, _name, requireJsonFieldsMap)
+ do \
+ { \
+     static test::teststruct::JsonSchema const requireJsonFieldsSchema(std::map<std::string, jsonType> __VA_ARGS__); \
+     if (!test::teststruct::SkipJsonFieldsCheck::active()) \
+         requireJsonFieldsSchema.validate(_data, [&]() -> std::string { return _name; }); \
+ } while (0)
 
 // Compile LLL in code, solidity in code
 // Convert dec fields to hex, add 0x prefix to accounts and storage keys
@@ -93,34 +93,31 @@ spDataObject prepareGenesisSubsection(StateTestEnvBase const& _env, ParamsContex
 
     if (!netIsAdditional)
     {
-        bool knowLondon = cfg.checkForkInProgression("London");
-        if (knowLondon && compareFork(net, CMP::ge, FORK("London")))
+        auto const& cfgFile = cfg.cfgFile();
+        if (cfgFile.forkHasFeature(net, ForkFeature::EIP1559))
             londify(genesis.getContent());
 
-        bool knowMerge = cfg.checkForkInProgression("Merge");
-        if (knowMerge && compareFork(net, CMP::ge, FORK("Merge")))
+        if (cfgFile.forkHasFeature(net, ForkFeature::Merge))
             mergify(genesis.getContent());
 
-        bool knowShaghai = cfg.checkForkInProgression("Shanghai");
-        if (knowShaghai && compareFork(net, CMP::ge, FORK("Shanghai")))
+        if (cfgFile.forkHasFeature(net, ForkFeature::Shanghai))
             shangfy(genesis.getContent());
 
-        bool knowCancun = cfg.checkForkInProgression("Cancun");
-        if (knowCancun && compareFork(net, CMP::ge, FORK("Cancun")))
+        if (cfgFile.forkHasFeature(net, ForkFeature::Cancun))
             cancunfy(genesis.getContent());
     }
     else
     {
         // Net Is Additional, probably special transition net.
         // Can't get rid of this hardcode configs :(((
-        if (_net == FORK("ArrowGlacierToMergeAtDiffC0000") || _net == FORK("ArrowGlacier"))
+        if (_net == C_FORK_ARROWGLACIERTOMERGEATDIFFC0000 || _net == C_FORK_ARROWGLACIER)
             londify(genesis.getContent());
-        else if (_net == FORK("MergeToShanghaiAtTime15k"))
+        else if (_net == C_FORK_MERGETOSHANGHAIATTIME15K)
         {
             londify(genesis.getContent());
             mergify(genesis.getContent());
         }
-        else if (_net == FORK("ShanghaiToCancunAtTime15k"))
+        else if (_net == C_FORK_SHANGHAITOCANCUNATTIME15K)
         {
             londify(genesis.getContent());
             mergify(genesis.getContent());
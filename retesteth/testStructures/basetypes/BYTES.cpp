@@ -1,4 +1,5 @@
 #include <libdevcore/CommonIO.h>
+#include <libdevcore/HexCodec.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/helpers/TestHelper.h>
 using namespace test::teststruct;
@@ -7,13 +8,17 @@ using namespace std;
 
 namespace
 {
-void toLowerHexStr(string& _input)
-{
-    std::transform(_input.begin(), _input.end(), _input.begin(), [](unsigned char c) {
-        if (!isxdigit(c))
-            ETH_ERROR_MESSAGE("BYTES string has char which is not hex: `" + string(1, c) + "`\n");
-        return std::tolower(c);
-    });
+// Validate and lowercase the hex digits starting at _begin
+void toLowerHexStr(string& _input, size_t _begin)
+{
+    _begin = std::min(_begin, _input.size());
+    if (normalizeHex(_input.data() + _begin, _input.size() - _begin))
+        return;
+    auto const bad =
+        std::find_if(_input.begin() + _begin, _input.end(), [](unsigned char c) { return !isxdigit(c); });
+    ETH_ERROR_MESSAGE("BYTES string has char which is not hex: `" + string(1, *bad) + "`\n");
+    std::transform(_input.begin() + _begin, _input.end(), _input.begin() + _begin,
+        [](unsigned char c) { return std::tolower(c); });
 }
 }  // namespace
 
@@ -23,9 +28,7 @@ namespace teststruct
 {
 BYTES::BYTES(dev::RLP const& _rlp)
 {
-    std::ostringstream stream;
-    stream << _rlp.toBytes();
-    m_data = stream.str();
+    m_data = dev::toHexPrefixed(_rlp.toBytesConstRef());
 }
 
 BYTES::BYTES(DataObject const& _data)
@@ -34,9 +37,8 @@ BYTES::BYTES(DataObject const& _data)
     string const& v = _data.asString();
     if (v.size() < 2 || v[0] != '0' || v[1] != 'x')
         ETH_ERROR_MESSAGE("Key `" + k + "` is not BYTES `" + v + "`");
-    m_data = v.substr(2);
-    toLowerHexStr(m_data);
-    m_data = "0x" + m_data;
+    m_data = v;
+    toLowerHexStr(m_data, 2);
 }
 
 BYTES::BYTES(string const& _data)
@@ -44,9 +46,8 @@ BYTES::BYTES(string const& _data)
     string const& v = _data;
     if (v.size() < 2 || v[0] != '0' || v[1] != 'x')
         ETH_ERROR_MESSAGE("Bytes are not BYTES `" + v + "`");
-    m_data = v.substr(2);
-    toLowerHexStr(m_data);
-    m_data = "0x" + m_data;
+    m_data = v;
+    toLowerHexStr(m_data, 2);
 }
 
 size_t BYTES::firstByte() const
@@ -19,9 +19,7 @@ namespace test::teststruct
 
 VALUE::VALUE(dev::RLP const& _rlp)
 {
-    std::ostringstream stream;
-    stream << _rlp.toBytes();
-    auto const& str = stream.str();
+    string const str = dev::toHexPrefixed(_rlp.toBytesConstRef());
     m_prefixedZeroBytes = _countPrefixedBytes(str);
     m_bigint = (str.size() > 64 + 2) || m_prefixedZeroBytes >= 1;
     m_data = dev::bigint(str);
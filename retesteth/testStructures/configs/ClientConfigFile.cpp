@@ -1,6 +1,7 @@
 #include "ClientConfigFile.h"
 #include <testStructures/Common.h>
 #include <retesteth/EthChecks.h>
+#include <retesteth/Constants.h>
 #include <retesteth/helpers/TestHelper.h>
 using namespace std;
 using namespace test::teststruct;
@@ -26,8 +27,13 @@ void requireJsonFileStructure(DataObject const& _data)
             {"supportBigint", {{DataType::Bool}, jsonField::Optional}},
             {"checkBasefee", {{DataType::Bool}, jsonField::Optional}},
             {"calculateBasefee", {{DataType::Bool}, jsonField::Optional}},
+            {"checkStateRoot", {{DataType::Bool}, jsonField::Optional}},
+            {"calculateStateRoot", {{DataType::Bool}, jsonField::Optional}},
             {"defaultChainID", {{DataType::Integer}, jsonField::Optional}},
             {"continueOnErrors", {{DataType::Bool}, jsonField::Optional}},
+            {"batchRequests", {{DataType::Bool}, jsonField::Optional}},
+            {"recycleMemoryGrowth", {{DataType::Integer}, jsonField::Optional}},
+            {"recycleLatencyGrowth", {{DataType::Integer}, jsonField::Optional}},
             {"forks", {{DataType::Array}, jsonField::Required}},
             {"additionalForks", {{DataType::Array}, jsonField::Required}},
             {"fillerSkipForks", {{DataType::Array}, jsonField::Optional}},
@@ -61,9 +67,11 @@ void ClientConfigFile::parseSocketType(DataObject const& _data, string const& _s
         m_socketType = ClientConfgSocketType::IPCDebug;
     else if (socketTypeStr == "tranition-tool")
         m_socketType = ClientConfgSocketType::TransitionTool;
+    else if (socketTypeStr == "mock-tool")
+        m_socketType = ClientConfgSocketType::MockTransitionTool;
     else
         ETH_FAIL_MESSAGE(_sErrorPath + "Unknown `socketType` : " + socketTypeStr +
-                         ", Allowed: ['ipc', 'tcp', 'ipc-debug', 'transition-tool']");
+                         ", Allowed: ['ipc', 'tcp', 'ipc-debug', 'transition-tool', 'mock-tool']");
 
     // SocketAddress is an array of ipaddresses or path to a socket file
     if (m_socketType == ClientConfgSocketType::TCP)
@@ -116,6 +124,13 @@ void ClientConfigFile::parseSocketType(DataObject const& _data, string const& _s
         if (fs::exists(cfgPath / m_pathToExecFile))
             m_pathToExecFile = cfgPath / m_pathToExecFile;
     }
+    // Mock tool runs the t8n contract in-process, socketAddress is only a name
+    else if (m_socketType == ClientConfgSocketType::MockTransitionTool)
+    {
+        if (_data.atKey("socketAddress").type() != DataType::String)
+            ETH_FAIL_MESSAGE(_sErrorPath + "`socketAddress` must be string for this socketType!");
+        m_pathToExecFile = fs::path(_data.atKey("socketAddress").asString());
+    }
 }
 
 void ClientConfigFile::initWithData(DataObject const& _data)
@@ -155,6 +170,14 @@ void ClientConfigFile::initWithData(DataObject const& _data)
     if (_data.count("checkBasefee"))
         m_checkBasefee = _data.atKey("checkBasefee").asBool();
 
+    m_checkStateRoot = false;
+    if (_data.count("checkStateRoot"))
+        m_checkStateRoot = _data.atKey("checkStateRoot").asBool();
+
+    m_calculateStateRoot = false;
+    if (_data.count("calculateStateRoot"))
+        m_calculateStateRoot = _data.atKey("calculateStateRoot").asBool();
+
     m_support1559 = true;
     if (_data.count("support1559"))
         m_support1559 = _data.atKey("support1559").asBool();
@@ -171,6 +194,18 @@ void ClientConfigFile::initWithData(DataObject const& _data)
     if (_data.count("continueOnErrors"))
         m_continueOnErrors = _data.atKey("continueOnErrors").asBool();
 
+    m_batchRequests = false;
+    if (_data.count("batchRequests"))
+        m_batchRequests = _data.atKey("batchRequests").asBool();
+
+    m_recycleMemoryGrowth = 2048;
+    if (_data.count("recycleMemoryGrowth"))
+        m_recycleMemoryGrowth = std::max(0, _data.atKey("recycleMemoryGrowth").asInt());
+
+    m_recycleLatencyGrowth = 8;
+    if (_data.count("recycleLatencyGrowth"))
+        m_recycleLatencyGrowth = std::max(0, _data.atKey("recycleLatencyGrowth").asInt());
+
     if (_data.count("tmpDir"))
     {
         string const& tpath = _data.atKey("tmpDir").asString();
@@ -195,6 +230,8 @@ void ClientConfigFile::initWithData(DataObject const& _data)
         m_forkProgressionAsSet.insert(fork);
     }
 
+    initForkTables();
+
     // Read additionalForks are allowed fork names to run on this client, but not used in translation
     for (auto const& el : _data.atKey("additionalForks").getSubObjects())
     {
@@ -269,6 +306,33 @@ void ClientConfigFile::initWithData(DataObject const& _data)
     }
 }
 
+void ClientConfigFile::initForkTables()
+{
+    size_t maxId = 0;
+    for (auto const& fork : m_forks)
+        maxId = std::max(maxId, fork.id());
+    m_forkProgressionIndex.assign(maxId + 1, c_forkNotInProgression);
+    m_forkFeatures.assign(maxId + 1, 0);
+
+    // Forks of the progression starting from the feature fork have the feature
+    std::vector<std::pair<FORK, ForkFeature>> const featureForks = {
+        {C_FORK_LONDON, ForkFeature::EIP1559},
+        {C_FORK_MERGE, ForkFeature::Merge},
+        {C_FORK_SHANGHAI, ForkFeature::Shanghai},
+        {C_FORK_CANCUN, ForkFeature::Cancun}};
+
+    uint8_t features = 0;
+    for (size_t i = 0; i < m_forks.size(); i++)
+    {
+        FORK const& fork = m_forks.at(i);
+        for (auto const& [featureFork, feature] : featureForks)
+            if (fork == featureFork)
+                features |= uint8_t(feature);
+        m_forkProgressionIndex[fork.id()] = i;
+        m_forkFeatures[fork.id()] = features;
+    }
+}
+
 std::vector<IPADDRESS> const& ClientConfigFile::socketAdresses() const
 {
     if (m_socketType != ClientConfgSocketType::TCP)
@@ -12,7 +12,17 @@ enum class ClientConfgSocketType
     TCP,
     IPC,
     IPCDebug,
-    TransitionTool
+    TransitionTool,
+    MockTransitionTool
+};
+
+// Features enabled on the fork by the fork progression of the config
+enum class ForkFeature : uint8_t
+{
+    EIP1559 = 1 << 0,
+    Merge = 1 << 1,
+    Shanghai = 1 << 2,
+    Cancun = 1 << 3
 };
 
 struct ClientConfigFile : GCP_SPointerBase
@@ -22,6 +32,10 @@ struct ClientConfigFile : GCP_SPointerBase
 
     std::string const& name() const { return m_name; }
     ClientConfgSocketType socketType() const { return m_socketType; }
+    bool isTransitionTool() const
+    {
+        return m_socketType == ClientConfgSocketType::TransitionTool || m_socketType == ClientConfgSocketType::MockTransitionTool;
+    }
     std::vector<IPADDRESS> const& socketAdresses() const;
     std::map<std::string, boost::filesystem::path> const& customCompilers() const { return m_customCompilers; }
     size_t initializeTime() const { return  m_initializeTime; }
@@ -32,6 +46,17 @@ struct ClientConfigFile : GCP_SPointerBase
     std::vector<FORK> const& fillerSkipForks() const { return m_skipForks; }
     std::set<FORK> const& allowedForks() const;
     std::set<FORK> const& forkProgressionAsSet() const;
+
+    // Index of the fork in `forks` progression by interned fork id, c_forkNotInProgression if not there
+    static constexpr size_t c_forkNotInProgression = size_t(-1);
+    size_t forkProgressionIndex(FORK const& _fork) const
+    {
+        return _fork.id() < m_forkProgressionIndex.size() ? m_forkProgressionIndex[_fork.id()] : c_forkNotInProgression;
+    }
+    bool forkHasFeature(FORK const& _fork, ForkFeature _feature) const
+    {
+        return _fork.id() < m_forkFeatures.size() && (m_forkFeatures[_fork.id()] & uint8_t(_feature));
+    }
     bool checkLogsHash() const { return m_checkLogsHash; }
 
     bool checkDifficulty() const { return m_checkDifficulty; }
@@ -40,11 +65,20 @@ struct ClientConfigFile : GCP_SPointerBase
     bool checkBasefee() const { return m_checkBasefee; }
     bool calculateBasefee() const { return m_calculateBasefee; }
 
+    bool checkStateRoot() const { return m_checkStateRoot; }
+    bool calculateStateRoot() const { return m_calculateStateRoot; }
+
     // ETC classic block format autoconvertion
     bool support1559() const { return m_support1559; }
     bool supportBigint() const { return m_supportBigint; }
     bool transactionsAsJson() const { return m_transactionsAsJson; }
     bool continueOnErrors() const { return m_continueOnErrors; }
+    bool batchRequests() const { return m_batchRequests; }
+
+    // Restart a client when its memory grew by this many MB, 0 disables
+    size_t recycleMemoryGrowth() const { return m_recycleMemoryGrowth; }
+    // Restart a client when its rpc latency grew this many times, 0 disables
+    size_t recycleLatencyGrowth() const { return m_recycleLatencyGrowth; }
 
     std::map<std::string, std::string> const& exceptions() const { return m_exceptions; }
     std::map<std::string, std::string> const& fieldreplace() const { return m_fieldRaplce; }
@@ -56,6 +90,7 @@ private:
     ClientConfigFile() {}
     void initWithData(DataObject const&);
     void parseSocketType(DataObject const& _data, std::string const& _sErrorPath);
+    void initForkTables();
 
 private:
     // Inside the file
@@ -71,10 +106,15 @@ private:
     bool m_calculateDifficulty;              ///< Retesteth calculate difficulty for the client
     bool m_checkBasefee;                     ///< Enable basefee verifivation
     bool m_calculateBasefee;                 ///< Retesteth calculate basefee value
+    bool m_checkStateRoot;                   ///< Verify tool state and transactions roots with the native trie
+    bool m_calculateStateRoot;               ///< Retesteth calculate genesis state root for the client
     bool m_support1559;                      ///< Support EIP1559 headers
     bool m_supportBigint;                    ///< Support malicious oversize data encodings for tests
     bool m_transactionsAsJson;               ///< Make T8N txs file as json not rlp
     bool m_continueOnErrors;                 ///< Continue test run on error
+    bool m_batchRequests;                    ///< Client accepts json-rpc batch requests
+    size_t m_recycleMemoryGrowth;            ///< Client RSS growth (MB) over the first sample to restart it
+    size_t m_recycleLatencyGrowth;           ///< Client rpc latency growth (times) over the first sample to restart it
     size_t m_initializeTime;                 ///< Time to start the instance
     std::vector<FORK> m_forks;               ///< Allowed forks as network name
     std::vector<FORK> m_additionalForks;     ///< Allowed forks as network name
@@ -89,6 +129,8 @@ private:
     // Optimisations
     mutable std::set<FORK> m_forkProgressionAsSet;
     mutable std::set<FORK> m_allowedForks;
+    std::vector<size_t> m_forkProgressionIndex;  ///< Fork id -> index in m_forks
+    std::vector<uint8_t> m_forkFeatures;         ///< Fork id -> ForkFeature flags
 };
 
 
@@ -1,5 +1,7 @@
 #include <retesteth/EthChecks.h>
 #include <retesteth/Options.h>
+#include <mutex>
+#include <unordered_map>
 using namespace std;
 using namespace test;
 using namespace test::teststruct;
@@ -7,17 +9,24 @@ using namespace test::debug;
 
 namespace
 {
-size_t getForkIndex(test::teststruct::FORK const& _f)
+// Fork names are few, once interned an id is never released
+// so every thread keeps its own copy of the ids it has seen and locks the shared table only on a miss
+size_t internForkName(string const& _name)
 {
-    auto const& forks = Options::getCurrentConfig().cfgFile().forks();
-    for (size_t i = 0; i < forks.size(); i++)
+    thread_local std::unordered_map<string, size_t> t_seenIds;
+    auto const seen = t_seenIds.find(_name);
+    if (seen != t_seenIds.end())
+        return seen->second;
+
+    static std::mutex s_internMutex;
+    static std::unordered_map<string, size_t> s_internTable = {{string(), 0}};
+    size_t id;
     {
-        if (forks.at(i) == _f)
-            return i;
+        std::lock_guard<std::mutex> lock(s_internMutex);
+        id = s_internTable.emplace(_name, s_internTable.size()).first->second;
     }
-    string const sConfigPath = Options::getCurrentConfig().cfgFile().path().c_str();
-    ETH_FAIL_MESSAGE("Fork name `" + _f.asString() + "` not found in current config 'Forks'! (" + sConfigPath + ")");
-    return 0;
+    t_seenIds.emplace(_name, id);
+    return id;
 }
 }  // namespace
 
@@ -25,22 +34,22 @@ namespace test
 {
 namespace teststruct
 {
-// If to not use FORK in currentConfig init code.
-// Would be possible to calculate the indexes at constructor time
-// Given the FORK array is small and usage of compares are single lines it shall be fine
-FORK::FORK(DataObject const& _data) : m_data(_data.asString()) {}
+FORK::FORK(char const* _s) : m_data(_s), m_id(internForkName(m_data)) {}
+FORK::FORK(std::string const& _s) : m_data(_s), m_id(internForkName(m_data)) {}
+FORK::FORK(DataObject const& _data) : m_data(_data.asString()), m_id(internForkName(m_data)) {}
 
+// Fork order is precomputed per config by fork id, comparison is integer compare of the progression indexes
 bool compareFork(FORK const& _left, CMP _t, FORK const& _right)
 {
-    auto const& opt = Options::getCurrentConfig();
-    bool knowLeft = opt.checkForkInProgression(_left);
-    bool knowRight = opt.checkForkInProgression(_right);
-    if (!knowLeft)
+    auto const& cfg = Options::getCurrentConfig().cfgFile();
+    size_t const leftIndex = cfg.forkProgressionIndex(_left);
+    size_t const rightIndex = cfg.forkProgressionIndex(_right);
+    if (leftIndex == ClientConfigFile::c_forkNotInProgression)
     {
         ETH_DC_MESSAGEC(DC::LOWLOG, "compareFork fork `" + _left.asString() + "` is unknown in current config!", LogColor::YELLOW);
         return false;
     }
-    if (!knowRight)
+    if (rightIndex == ClientConfigFile::c_forkNotInProgression)
     {
         ETH_DC_MESSAGEC(DC::LOWLOG, "compareFork fork `" + _right.asString() + "` is unknown in current config!", LogColor::YELLOW);
         return false;
@@ -48,16 +57,16 @@ bool compareFork(FORK const& _left, CMP _t, FORK const& _right)
     switch (_t)
     {
     case CMP::ge:
-        return getForkIndex(_left) >= getForkIndex(_right);
+        return leftIndex >= rightIndex;
         break;
     case CMP::le:
-        return getForkIndex(_left) <= getForkIndex(_right);
+        return leftIndex <= rightIndex;
         break;
     case CMP::gt:
-        return getForkIndex(_left) > getForkIndex(_right);
+        return leftIndex > rightIndex;
         break;
     case CMP::lt:
-        return getForkIndex(_left) < getForkIndex(_right);
+        return leftIndex < rightIndex;
         break;
     }
     return 0;
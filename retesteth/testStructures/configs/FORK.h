@@ -7,15 +7,17 @@ using namespace dataobject;
 
 // FORK network configuration (string wrapper)
 // Keep Fork names in this structure to distinguish string variable from strings that represent forks
+// Fork names are interned into a process wide id at construction so equality is an integer compare
 struct FORK : GCP_SPointerBase
 {
-    FORK(char const* _s) : m_data(std::string(_s)) {}
-    FORK(std::string const& _s) : m_data(_s) {}
+    FORK(char const* _s);
+    FORK(std::string const& _s);
     FORK(DataObject const&);
     std::string const& asString() const { return m_data; }
+    size_t id() const { return m_id; }
 
     // std container operations
-    inline bool operator==(FORK const& rhs) const { return asString() == rhs.asString(); }
+    inline bool operator==(FORK const& rhs) const { return m_id == rhs.id(); }
     inline bool operator!=(FORK const& rhs) const { return !(*this == rhs); }
     inline bool operator!=(std::string const& rhs) const { return !(this->asString() == rhs); }
     inline bool operator!=(const char* rhs) const { return !(this->asString() == std::string(rhs)); }
@@ -24,6 +26,7 @@ struct FORK : GCP_SPointerBase
 private:
     FORK() {}
     std::string m_data;
+    size_t m_id = 0;
 };
 
 enum class CMP
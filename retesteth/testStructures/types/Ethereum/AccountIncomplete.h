@@ -12,7 +12,11 @@ namespace teststruct
 struct AccountIncomplete : AccountBase
 {
     AccountIncomplete(spDataObject&);
-    void setBalance(VALUE const& _balance) { m_balance = spVALUE(new VALUE(_balance)); }
+    void setBalance(VALUE const& _balance)
+    {
+        m_balance = spVALUE(new VALUE(_balance));
+        m_fieldsDigest.reset();
+    }
     spDataObject const& asDataObject() const override;
     AccountType type() const override { return AccountType::Incomplete; }
 };
@@ -0,0 +1,49 @@
+#include "AccountBase.h"
+#include <libdevcore/SHA3.h>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+uint8_t const c_hasBalance = 1;
+uint8_t const c_hasNonce = 2;
+uint8_t const c_hasCode = 4;
+uint8_t const c_hasStorage = 8;
+}  // namespace
+
+namespace test::teststruct
+{
+h256 AccountBase::digest() const
+{
+    h256 const& fieldsDigest = m_fieldsDigest.get([this]() {
+        bytes fields;
+        fields.push_back((hasBalance() ? c_hasBalance : 0) | (hasNonce() ? c_hasNonce : 0) | (hasCode() ? c_hasCode : 0) |
+                         (hasStorage() ? c_hasStorage : 0));
+        if (hasBalance())
+        {
+            bytes const& balance = m_balance->serializeRLP();
+            fields.insert(fields.end(), balance.begin(), balance.end());
+        }
+        if (hasNonce())
+        {
+            bytes const& nonce = m_nonce->serializeRLP();
+            fields.insert(fields.end(), nonce.begin(), nonce.end());
+        }
+        if (hasCode())
+        {
+            h256 const code = sha3(m_code->asString());
+            fields.insert(fields.end(), code.data(), code.data() + h256::size);
+        }
+        return sha3(fields);
+    });
+    if (!hasStorage())
+        return fieldsDigest;
+
+    h256 const& storage = m_storage->digest();
+    bytes account(fieldsDigest.begin(), fieldsDigest.end());
+    account.insert(account.end(), storage.data(), storage.data() + h256::size);
+    return sha3(account);
+}
+
+}  // namespace teststruct
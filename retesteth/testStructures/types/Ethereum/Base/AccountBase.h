@@ -1,6 +1,7 @@
 #pragma once
 #include "../../../basetypes.h"
 #include "../Storage.h"
+#include "DigestCache.h"
 #include <libdataobj/DataObject.h>
 
 namespace test
@@ -29,6 +30,11 @@ struct AccountBase : GCP_SPointerBase
     BYTES const& code() const { return m_code; }
     FH20 const& address() const { return m_address; }
 
+    // Hash of the fields that are set. Accounts with the same fields have the same digest
+    // Balance, nonce and code are hashed once, the storage digest is taken at each request
+    // so that a merged storage is never compared by its old hash
+    dev::h256 digest() const;
+
     virtual spDataObject const& asDataObject() const = 0;
     virtual AccountType type() const = 0;
     virtual ~AccountBase() {}
@@ -36,6 +42,7 @@ struct AccountBase : GCP_SPointerBase
 protected:
     AccountBase() {}
     mutable spDataObject m_rawData;
+    DigestCache m_fieldsDigest;
     bool m_shouldNotExist = false;
     spFH20 m_address;
     spVALUE m_balance;
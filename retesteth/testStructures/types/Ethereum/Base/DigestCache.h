@@ -0,0 +1,49 @@
+#pragma once
+#include <libdevcore/FixedHash.h>
+#include <atomic>
+#include <mutex>
+
+namespace test
+{
+namespace teststruct
+{
+// Hash of an object calculated on the first request
+// Threads comparing the same object wait only for that object, later requests just read the flag
+// A copy starts without the hash
+class DigestCache
+{
+public:
+    DigestCache() {}
+    DigestCache(DigestCache const&) {}
+    DigestCache& operator=(DigestCache const&)
+    {
+        reset();
+        return *this;
+    }
+
+    template <class T>
+    dev::h256 const& get(T const& _calculate) const
+    {
+        if (!m_ready.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_ready.load(std::memory_order_relaxed))
+            {
+                m_digest = _calculate();
+                m_ready.store(true, std::memory_order_release);
+            }
+        }
+        return m_digest;
+    }
+
+    // Called by the object that changes, not while other threads read it
+    void reset() { m_ready.store(false, std::memory_order_relaxed); }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable std::atomic<bool> m_ready = false;
+    mutable dev::h256 m_digest;
+};
+
+}  // namespace teststruct
+}  // namespace test
@@ -6,6 +6,12 @@
 
 using namespace std;
 
+namespace
+{
+// Encoded header with the empty extraData is about 600 bytes
+size_t const c_rlpHeaderReserve = 640;
+}
+
 namespace test::teststruct
 {
 
@@ -25,10 +31,44 @@ std::string BlockHeader::BlockTypeToString(BlockType _bl)
 
 void BlockHeader::recalculateHash()
 {
-    FH32* newHash = new FH32("0x" + dev::toString(dev::sha3(asRLPStream().out())));
+    // The buffer is reused between calls, headers are rehashed for every block
+    static thread_local dev::RLPStream s_header;
+    s_header.clear();
+    s_header.appendList(_rlpHeaderSize());
+    _streamRLP(s_header);
+    FH32* newHash = new FH32("0x" + dev::toString(dev::sha3(s_header.out())));
     m_hash = spFH32(newHash);
 }
 
+dev::RLPStream BlockHeader::asRLPStream() const
+{
+    dev::RLPStream header;
+    header.reserve(c_rlpHeaderReserve);
+    header.appendList(_rlpHeaderSize());
+    _streamRLP(header);
+    return header;
+}
+
+bool BlockHeader::_fieldsEqual(BlockHeader const& _rhs) const
+{
+    return m_hash->asString() == _rhs.m_hash->asString() &&
+           m_stateRoot->asString() == _rhs.m_stateRoot->asString() &&
+           m_number->asString() == _rhs.m_number->asString() &&
+           m_parentHash->asString() == _rhs.m_parentHash->asString() &&
+           m_difficulty->asString() == _rhs.m_difficulty->asString() &&
+           m_author->asString() == _rhs.m_author->asString() &&
+           m_extraData->asString() == _rhs.m_extraData->asString() &&
+           m_gasUsed->asString() == _rhs.m_gasUsed->asString() &&
+           m_gasLimit->asString() == _rhs.m_gasLimit->asString() &&
+           m_logsBloom->asString() == _rhs.m_logsBloom->asString() &&
+           m_mixHash->asString() == _rhs.m_mixHash->asString() &&
+           m_nonce->asString() == _rhs.m_nonce->asString() &&
+           m_receiptsRoot->asString() == _rhs.m_receiptsRoot->asString() &&
+           m_sha3Uncles->asString() == _rhs.m_sha3Uncles->asString() &&
+           m_timestamp->asString() == _rhs.m_timestamp->asString() &&
+           m_transactionsRoot->asString() == _rhs.m_transactionsRoot->asString();
+}
+
 bool BlockHeader::hasUncles() const
 {
     return m_sha3Uncles->asString() != C_EMPTY_LIST_HASH;
@@ -21,10 +21,12 @@ struct BlockHeader : GCP_SPointerBase
     virtual ~BlockHeader(){/* all smart pointers */};
 
     virtual spDataObject asDataObject() const = 0;
-    virtual dev::RLPStream const asRLPStream() const = 0;
+    dev::RLPStream asRLPStream() const;
     virtual BlockType type() const = 0;
 
-    bool operator==(BlockHeader const& _rhs) const { return asDataObject() == _rhs.asDataObject(); }
+    // Field-wise compare of the exported strings, same result as comparing asDataObject() of the headers
+    // VALUE== would compare the number and miss the leading zeros and the bigint form of the fields
+    bool operator==(BlockHeader const& _rhs) const { return type() == _rhs.type() && _fieldsEqual(_rhs); }
     bool operator!=(BlockHeader const& _rhs) const { return !(*this == _rhs); }
 
     void recalculateHash();
@@ -71,8 +73,13 @@ protected:
     void fromData(DataObject const&);
     virtual void checkDataScheme(DataObject const&) const = 0;
     virtual void _fromData(DataObject const&) = 0;
-    virtual size_t _fromRLP(dev::RLP const&) = 0;
+    virtual size_t _fromRLP(dev::RLPList const&) = 0;
     virtual size_t _rlpHeaderSize() const = 0;
+    // Append the header fields to the list opened by the caller
+    virtual void _streamRLP(dev::RLPStream&) const = 0;
+
+    // Compare fields with the header of the same type()
+    virtual bool _fieldsEqual(BlockHeader const& _rhs) const;
 
     // Common
     spFH32 m_stateRoot;
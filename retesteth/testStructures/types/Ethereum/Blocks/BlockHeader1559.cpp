@@ -56,7 +56,7 @@ void BlockHeader1559::_fromData(DataObject const& _data)
     m_baseFee = sVALUE(_data.atKey(c_baseFeePerGas));
 }
 
-size_t BlockHeader1559::_fromRLP(dev::RLP const& _rlp)
+size_t BlockHeader1559::_fromRLP(dev::RLPList const& _rlp)
 {
     // 0 - parentHash           // 8 - number
     // 1 - uncleHash            // 9 - gasLimit
@@ -73,7 +73,7 @@ size_t BlockHeader1559::_fromRLP(dev::RLP const& _rlp)
 
 BlockHeader1559::BlockHeader1559(dev::RLP const& _rlp)
 {
-    _fromRLP(_rlp);
+    _fromRLP(dev::RLPList(_rlp));
     recalculateHash();
 }
 
@@ -84,11 +84,17 @@ spDataObject BlockHeader1559::asDataObject() const
     return out;
 }
 
-const RLPStream BlockHeader1559::asRLPStream() const
+bool BlockHeader1559::_fieldsEqual(BlockHeader const& _rhs) const
 {
-    RLPStream header = BlockHeaderLegacy::asRLPStream();
+    BlockHeader1559 const& rhs = static_cast<BlockHeader1559 const&>(_rhs);
+    return BlockHeaderLegacy::_fieldsEqual(_rhs) &&
+           m_baseFee->asString() == rhs.m_baseFee->asString();
+}
+
+void BlockHeader1559::_streamRLP(RLPStream& header) const
+{
+    BlockHeaderLegacy::_streamRLP(header);
     header << m_baseFee->asBigInt();
-    return header;
 }
 
 namespace  {
@@ -14,7 +14,6 @@ struct BlockHeader1559 : BlockHeaderLegacy
     BlockHeader1559(dev::RLP const&);
 
     virtual spDataObject asDataObject() const override;
-    virtual dev::RLPStream const asRLPStream() const override;
     virtual BlockType type() const override { return BlockType::BlockHeader1559; }
 
     // Unique fields
@@ -29,7 +28,9 @@ protected:
     BlockHeader1559(){};
     virtual void checkDataScheme(DataObject const&) const override;
     virtual void _fromData(DataObject const&) override;
-    virtual size_t _fromRLP(dev::RLP const&) override;
+    virtual size_t _fromRLP(dev::RLPList const&) override;
+    virtual void _streamRLP(dev::RLPStream&) const override;
+    virtual bool _fieldsEqual(BlockHeader const&) const override;
     virtual size_t _rlpHeaderSize() const override { return 16; }
 
     // Ethereum eip1559 blockheader fields
@@ -64,7 +64,7 @@ void BlockHeader4844::_fromData(DataObject const& _data)
     m_parentBeaconBlockRoot = sFH32(_data.atKey(c_parentBeaconBlockRoot));
 }
 
-size_t BlockHeader4844::_fromRLP(dev::RLP const& _rlp)
+size_t BlockHeader4844::_fromRLP(dev::RLPList const& _rlp)
 {
     // 0 - parentHash           // 8 - number
     // 1 - uncleHash            // 9 - gasLimit
@@ -85,7 +85,7 @@ size_t BlockHeader4844::_fromRLP(dev::RLP const& _rlp)
 
 BlockHeader4844::BlockHeader4844(dev::RLP const& _rlp)
 {
-    _fromRLP(_rlp);
+    _fromRLP(dev::RLPList(_rlp));
     recalculateHash();
 }
 
@@ -98,13 +98,21 @@ spDataObject BlockHeader4844::asDataObject() const
     return out;
 }
 
-const RLPStream BlockHeader4844::asRLPStream() const
+bool BlockHeader4844::_fieldsEqual(BlockHeader const& _rhs) const
 {
-    RLPStream header = BlockHeaderShanghai::asRLPStream();
+    BlockHeader4844 const& rhs = static_cast<BlockHeader4844 const&>(_rhs);
+    return BlockHeaderShanghai::_fieldsEqual(_rhs) &&
+           m_excessBlobGas->asString() == rhs.m_excessBlobGas->asString() &&
+           m_blobGasUsed->asString() == rhs.m_blobGasUsed->asString() &&
+           m_parentBeaconBlockRoot->asString() == rhs.m_parentBeaconBlockRoot->asString();
+}
+
+void BlockHeader4844::_streamRLP(RLPStream& header) const
+{
+    BlockHeaderShanghai::_streamRLP(header);
     header << m_blobGasUsed->serializeRLP();
     header << m_excessBlobGas->serializeRLP();
     header << m_parentBeaconBlockRoot->serializeRLP();
-    return header;
 }
 
 
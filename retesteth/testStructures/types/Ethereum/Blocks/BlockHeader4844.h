@@ -12,7 +12,6 @@ struct BlockHeader4844 : BlockHeaderShanghai
     BlockHeader4844(dev::RLP const& _in);
 
     virtual spDataObject asDataObject() const override;
-    virtual dev::RLPStream const asRLPStream() const override;
     virtual BlockType type() const override { return BlockType::BlockHeader4844; }
 
     VALUE const& excessBlobGas() const { return m_excessBlobGas; }
@@ -28,7 +27,9 @@ struct BlockHeader4844 : BlockHeaderShanghai
 protected:
     virtual void checkDataScheme(DataObject const&) const override;
     virtual void _fromData(DataObject const&) override;
-    virtual size_t _fromRLP(dev::RLP const&) override;
+    virtual size_t _fromRLP(dev::RLPList const&) override;
+    virtual void _streamRLP(dev::RLPStream&) const override;
+    virtual bool _fieldsEqual(BlockHeader const&) const override;
     virtual size_t _rlpHeaderSize() const override { return 20; }
 
     spVALUE m_excessBlobGas;
@@ -87,7 +87,7 @@ void BlockHeaderLegacy::_fromData(DataObject const& _data)
     m_transactionsRoot = sFH32(_data.atKey(tkey));
 }
 
-size_t BlockHeaderLegacy::_fromRLP(dev::RLP const& _rlp)
+size_t BlockHeaderLegacy::_fromRLP(dev::RLPList const& _rlp)
 {
     // 0 - parentHash           // 8 - number
     // 1 - uncleHash            // 9 - gasLimit
@@ -118,7 +118,7 @@ size_t BlockHeaderLegacy::_fromRLP(dev::RLP const& _rlp)
 
 BlockHeaderLegacy::BlockHeaderLegacy(dev::RLP const& _rlp)
 {
-    _fromRLP(_rlp);
+    _fromRLP(dev::RLPList(_rlp));
     recalculateHash();
 }
 
@@ -144,11 +144,8 @@ spDataObject BlockHeaderLegacy::asDataObject() const
     return out;
 }
 
-const RLPStream BlockHeaderLegacy::asRLPStream() const
+void BlockHeaderLegacy::_streamRLP(RLPStream& header) const
 {
-    RLPStream header;
-    header.appendList(_rlpHeaderSize());
-
     header << h256(m_parentHash->asString());
     header << h256(m_sha3Uncles->asString());
     header << Address(m_author->asString());
@@ -164,7 +161,6 @@ const RLPStream BlockHeaderLegacy::asRLPStream() const
     header << test::sfromHex(m_extraData->asString());
     header << h256(m_mixHash->asString());
     header << h64(m_nonce->asString());
-    return header;
 }
 
 BlockHeaderLegacy const& BlockHeaderLegacy::castFrom(spBlockHeader const& _from)
@@ -16,7 +16,6 @@ struct BlockHeaderLegacy : BlockHeader
     virtual ~BlockHeaderLegacy(){/* all smart pointers */};
 
     virtual spDataObject asDataObject() const override;
-    virtual dev::RLPStream const asRLPStream() const override;
     virtual BlockType type() const override { return BlockType::BlockHeaderLegacy; }
 
     // Static
@@ -26,7 +25,8 @@ protected:
     BlockHeaderLegacy() {}
     virtual void checkDataScheme(DataObject const&) const override;
     virtual void _fromData(DataObject const&) override;
-    virtual size_t _fromRLP(dev::RLP const&) override;
+    virtual size_t _fromRLP(dev::RLPList const&) override;
+    virtual void _streamRLP(dev::RLPStream&) const override;
     virtual size_t _rlpHeaderSize() const override { return 15; }
 };
 
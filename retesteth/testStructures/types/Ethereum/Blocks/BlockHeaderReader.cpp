@@ -1,6 +1,7 @@
 #include "BlockHeaderReader.h"
 #include <retesteth/EthChecks.h>
 #include <retesteth/Constants.h>
+#include <retesteth/testStructures/Common.h>
 
 using namespace std;
 using namespace dataobject;
@@ -86,9 +87,10 @@ bool isHeaderMerge(dev::RLP const& _rlp)
 
     // https://eips.ethereum.org/EIPS/eip-3675
     static const FH32 mergeUncleHash(C_EMPTY_LIST_HASH);
-    if (VALUE(_rlp[7]) == 0
-        && FH32(_rlp[1]) == mergeUncleHash
-        && FH8(_rlp[14]) == FH8::zero())
+    dev::RLPList const items(_rlp);
+    if (VALUE(items[7]) == 0
+        && FH32(items[1]) == mergeUncleHash
+        && FH8(items[14]) == FH8::zero())
     {
         return true;
     }
@@ -151,6 +153,12 @@ spBlockHeader readBlockHeader(DataObject const& _filledData)
     return spBlockHeader(new BlockHeaderLegacy(_filledData));
 }
 
+spBlockHeader copyBlockHeader(BlockHeader const& _header)
+{
+    SkipJsonFieldsCheck skipCheck;
+    return readBlockHeader(_header.asDataObject());
+}
+
 bool isBlockPoS(BlockHeader const& _header)
 {
     return isBlockExportCurrentRandom(_header);
@@ -10,6 +10,9 @@ namespace test::teststruct
 spBlockHeader readBlockHeader(DataObject const& _data);
 spBlockHeader readBlockHeader(dev::RLP const& _rlp);
 
+// Copy of an already validated header, json scheme check is skipped
+spBlockHeader copyBlockHeader(BlockHeader const& _header);
+
 // Block Serialization conditions
 bool isBlockExportExcessBlobGas(BlockHeader const&);
 bool isBlockExportCurrentRandom(BlockHeader const&);
@@ -59,7 +59,7 @@ void BlockHeaderShanghai::_fromData(DataObject const& _data)
     m_withdrawalsRoot = sFH32(_data.atKey(c_withdrawalsRoot));
 }
 
-size_t BlockHeaderShanghai::_fromRLP(dev::RLP const& _rlp)
+size_t BlockHeaderShanghai::_fromRLP(dev::RLPList const& _rlp)
 {
     // 0 - parentHash           // 8 - number
     // 1 - uncleHash            // 9 - gasLimit
@@ -77,7 +77,7 @@ size_t BlockHeaderShanghai::_fromRLP(dev::RLP const& _rlp)
 
 BlockHeaderShanghai::BlockHeaderShanghai(dev::RLP const& _rlp)
 {
-    _fromRLP(_rlp);
+    _fromRLP(dev::RLPList(_rlp));
     recalculateHash();
 }
 
@@ -88,11 +88,17 @@ spDataObject BlockHeaderShanghai::asDataObject() const
     return out;
 }
 
-const RLPStream BlockHeaderShanghai::asRLPStream() const
+bool BlockHeaderShanghai::_fieldsEqual(BlockHeader const& _rhs) const
 {
-    RLPStream header = BlockHeaderMerge::asRLPStream();
+    BlockHeaderShanghai const& rhs = static_cast<BlockHeaderShanghai const&>(_rhs);
+    return BlockHeaderMerge::_fieldsEqual(_rhs) &&
+           m_withdrawalsRoot->asString() == rhs.m_withdrawalsRoot->asString();
+}
+
+void BlockHeaderShanghai::_streamRLP(RLPStream& header) const
+{
+    BlockHeaderMerge::_streamRLP(header);
     header << h256(m_withdrawalsRoot->asString());
-    return header;
 }
 
 namespace  {
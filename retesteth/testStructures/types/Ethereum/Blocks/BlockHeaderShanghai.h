@@ -12,7 +12,6 @@ struct BlockHeaderShanghai : BlockHeaderMerge
     BlockHeaderShanghai(dev::RLP const& _in);
 
     virtual spDataObject asDataObject() const override;
-    virtual dev::RLPStream const asRLPStream() const override;
     virtual BlockType type() const override { return BlockType::BlockHeaderShanghai; }
 
     FH32 const& withdrawalsRoot() const { return m_withdrawalsRoot; }
@@ -24,7 +23,9 @@ struct BlockHeaderShanghai : BlockHeaderMerge
 protected:
     virtual void checkDataScheme(DataObject const&) const override;
     virtual void _fromData(DataObject const&) override;
-    virtual size_t _fromRLP(dev::RLP const&) override;
+    virtual size_t _fromRLP(dev::RLPList const&) override;
+    virtual void _streamRLP(dev::RLPStream&) const override;
+    virtual bool _fieldsEqual(BlockHeader const&) const override;
     virtual size_t _rlpHeaderSize() const override { return 17; }
 
     spFH32 m_withdrawalsRoot;
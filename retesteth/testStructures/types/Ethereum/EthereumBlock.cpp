@@ -27,8 +27,7 @@ void EthereumBlock::recalculateUncleHash()
     FH32 newUnHash("0x" + dev::toString(dev::sha3(uncleList.out())));
     m_header.getContent().setUnclesHash(newUnHash);
 
-    FH32 newHeaderHash("0x" + dev::toString(dev::sha3(m_header->asRLPStream().out())));
-    m_header.getContent().setHeaderHash(newHeaderHash);
+    m_header.getContent().recalculateHash();
 }
 
 BYTES const EthereumBlock::getRLP() const
@@ -39,28 +38,62 @@ BYTES const EthereumBlock::getRLP() const
             (isBlockExportWithdrawals(m_header) || m_forceWithdrawalsRLP)
             && !m_forceNoWithdrawalsRLP;
 
-        RLPStream stream(isExportWithdrawalsRLP ? 4 : 3);
-        stream.appendRaw(m_header->asRLPStream().out());
+        // Encode the items first, then write the lists with known sizes straight into one buffer
+        RLPStream const header = m_header->asRLPStream();
 
-        // Transaction list
-        RLPStream transactionList(m_transactions.size());
+        std::vector<RLPStream> transactions;
+        transactions.reserve(m_transactions.size());
+        size_t transactionsSize = 0;
         for (auto const& tr : m_transactions)
-            transactionList.appendRaw(tr->asRLPStream().out());
-        stream.appendRaw(transactionList.out());
+        {
+            transactions.emplace_back(tr->asRLPStream());
+            transactionsSize += transactions.back().out().size();
+        }
 
-        // Uncle list
-        RLPStream uncleList(m_uncles.size());
+        std::vector<RLPStream> uncles;
+        uncles.reserve(m_uncles.size());
+        size_t unclesSize = 0;
         for (auto const& un : m_uncles)
-            uncleList.appendRaw(un->asRLPStream().out());
-        stream.appendRaw(uncleList.out());
+        {
+            uncles.emplace_back(un->asRLPStream());
+            unclesSize += uncles.back().out().size();
+        }
 
-        // Withdrawals
+        std::vector<RLPStream> withdrawals;
+        size_t withdrawalsSize = 0;
         if (isExportWithdrawalsRLP)
         {
-            RLPStream withdrawalsList(m_withdrawals.size());
+            withdrawals.reserve(m_withdrawals.size());
             for (auto const& wt : m_withdrawals)
-                withdrawalsList.appendRaw(wt->asRLPStream().out());
-            stream.appendRaw(withdrawalsList.out());
+            {
+                withdrawals.emplace_back(wt->asRLPStream());
+                withdrawalsSize += withdrawals.back().out().size();
+            }
+        }
+
+        size_t const blockSize = header.out().size() + RLPStream::listSize(transactionsSize) +
+                                 RLPStream::listSize(unclesSize) +
+                                 (isExportWithdrawalsRLP ? RLPStream::listSize(withdrawalsSize) : 0);
+        RLPStream stream;
+        stream.appendList(isExportWithdrawalsRLP ? 4 : 3, blockSize);
+        stream.appendRaw(header.out());
+
+        // Transaction list
+        stream.appendList(transactions.size(), transactionsSize);
+        for (auto const& tr : transactions)
+            stream.appendRaw(tr.out());
+
+        // Uncle list
+        stream.appendList(uncles.size(), unclesSize);
+        for (auto const& un : uncles)
+            stream.appendRaw(un.out());
+
+        // Withdrawals
+        if (isExportWithdrawalsRLP)
+        {
+            stream.appendList(withdrawals.size(), withdrawalsSize);
+            for (auto const& wt : withdrawals)
+                stream.appendRaw(wt.out());
         }
 
         return BYTES(dev::toHexPrefixed(stream.out()));
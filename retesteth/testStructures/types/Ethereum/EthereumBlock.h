@@ -20,7 +20,7 @@ struct EthereumBlock : GCP_SPointerBase
     void addTransaction(spTransaction const& _tr) { m_transactions.emplace_back(_tr); }
     void addUncle(spBlockHeader const& _header) { m_uncles.emplace_back(_header); }
     void addWithdrawal(spWithdrawal const& _withdrawal) { m_withdrawals.emplace_back(_withdrawal); }
-    void replaceHeader(spBlockHeader const& _header) { m_header = readBlockHeader(_header->asDataObject()); }
+    void replaceHeader(spBlockHeader const& _header) { m_header = copyBlockHeader(_header); }
     void recalculateUncleHash();
     BYTES const getRLP() const;
     void forceWithdrawalsRLP() { m_forceWithdrawalsRLP = true; }
@@ -50,7 +50,7 @@ struct EthereumBlockState : EthereumBlock
     EthereumBlockState(spBlockHeader const& _header, spState const& _state, FH32 const& _logHash)
       : m_state(_state), m_logHash(_logHash.asString())
     {
-        m_header = readBlockHeader(_header->asDataObject());
+        m_header = copyBlockHeader(_header);
         m_totalDifficulty = spVALUE(new VALUE(_header->difficulty().asBigInt()));
     }
 
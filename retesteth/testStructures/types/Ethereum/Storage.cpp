@@ -1,36 +1,166 @@
 #include "Storage.h"
+#include <libdevcore/SHA3.h>
+#include <retesteth/EthChecks.h>
 
 using namespace std;
+using namespace dev;
 namespace test::teststruct
 {
+namespace
+{
+dev::bigint const c_maxU256 = dev::bigint(std::numeric_limits<u256>::max());
+
+bool recordLess(Storage::StorageRecord const& _lhs, Storage::StorageRecord const& _rhs)
+{
+    return _lhs.key < _rhs.key;
+}
+
+u256 parseStorageKey(string const& _key)
+{
+    try
+    {
+        VALUE const key(_key);
+        if (key.isBigInt())
+            throw UpwardsException("Storage key can not be bigint `" + _key + "`");
+        return u256(key.asBigInt());
+    }
+    catch (std::exception const& _ex)
+    {
+        throw UpwardsException(string("Storage record in storage: ") + _ex.what());
+    }
+}
+
+// Values above u256 and the values marked as bigint go with their length, the rest take 32 bytes
+void appendDigestValue(bytes& _out, VALUE const& _value)
+{
+    if (!_value.isBigInt() && _value.asBigInt() >= 0 && _value.asBigInt() <= c_maxU256)
+    {
+        _out.push_back(0);
+        h256 const value(u256(_value.asBigInt()));
+        _out.insert(_out.end(), value.data(), value.data() + h256::size);
+        return;
+    }
+    bytes const& value = _value.serializeRLP();
+    _out.push_back(1);
+    _out.insert(_out.end(), value.begin(), value.end());
+}
+}  // namespace
+
 Storage::Storage(DataObject const& _data)
 {
+    m_records.reserve(_data.getSubObjects().size());
     for (auto const& el : _data.getSubObjects())
+        m_records.push_back({parseStorageKey(el->getKey()), spVALUE(new VALUE(el))});
+
+    // Keys like 0x1 and 0x01 are the same slot, the last one wins
+    std::stable_sort(m_records.begin(), m_records.end(), recordLess);
+    auto const last = std::unique(m_records.rbegin(), m_records.rend(),
+        [](StorageRecord const& _lhs, StorageRecord const& _rhs) { return _lhs.key == _rhs.key; });
+    m_records.erase(m_records.begin(), last.base());
+}
+
+Storage::StorageRecord const* Storage::findKey(u256 const& _key) const
+{
+    auto const it = std::lower_bound(m_records.begin(), m_records.end(), _key,
+        [](StorageRecord const& _record, u256 const& _k) { return _record.key < _k; });
+    if (it != m_records.end() && it->key == _key)
+        return &(*it);
+    return nullptr;
+}
+
+bool Storage::hasKey(VALUE const& _key) const
+{
+    if (_key.isBigInt() || _key.asBigInt() < 0 || _key.asBigInt() > c_maxU256)
+        return false;
+    return hasKey(u256(_key.asBigInt()));
+}
+
+VALUE const& Storage::atKey(u256 const& _key) const
+{
+    StorageRecord const* record = findKey(_key);
+    if (record == nullptr)
+        ETH_FAIL_MESSAGE("Storage::atKey key not found: " + toCompactHexPrefixed(_key, 1));
+    return record->value.getCContent();
+}
+
+VALUE const& Storage::atKey(VALUE const& _key) const
+{
+    assert(hasKey(_key));
+    return atKey(u256(_key.asBigInt()));
+}
+
+void Storage::merge(Storage const& _storage)
+{
+    // Records of _storage overwrite the records with the same keys
+    StorageRecords merged;
+    merged.reserve(m_records.size() + _storage.size());
+    auto lhs = m_records.begin();
+    auto rhs = _storage.records().begin();
+    while (lhs != m_records.end() || rhs != _storage.records().end())
     {
-        DataObject tmpKey;
-        tmpKey.setKey("Storage record in storage");  // Hint
-        tmpKey.setString(string(el->getKey()));
-        spVALUE key(new VALUE(tmpKey));
-        spVALUE val(new VALUE(el));
-        m_map[key->asString()] = {key, val};
+        if (rhs == _storage.records().end() || (lhs != m_records.end() && lhs->key < rhs->key))
+            merged.push_back(*lhs++);
+        else
+        {
+            if (lhs != m_records.end() && lhs->key == rhs->key)
+                lhs++;
+            merged.push_back(*rhs++);
+        }
     }
+    m_records.swap(merged);
+    m_digest.reset();
 }
 
-void Storage::merge(Storage const& _storage)
+std::vector<Storage::DiffRecord> Storage::diff(Storage const& _rhs) const
+{
+    std::vector<DiffRecord> res;
+    auto lhs = m_records.begin();
+    auto rhs = _rhs.records().begin();
+    while (lhs != m_records.end() || rhs != _rhs.records().end())
+    {
+        if (rhs == _rhs.records().end() || (lhs != m_records.end() && lhs->key < rhs->key))
+            res.push_back({&(*lhs++), nullptr});
+        else if (lhs == m_records.end() || rhs->key < lhs->key)
+            res.push_back({nullptr, &(*rhs++)});
+        else
+        {
+            if (lhs->value.getCContent() != rhs->value.getCContent())
+                res.push_back({&(*lhs), &(*rhs)});
+            lhs++;
+            rhs++;
+        }
+    }
+    return res;
+}
+
+h256 const& Storage::digest() const
 {
-    // same keys???
-    for (auto const& record : _storage.getKeys())
-        m_map[record.first] = record.second;
+    return m_digest.get([this]() {
+        bytes records;
+        records.reserve(m_records.size() * (h256::size * 2 + 1));
+        for (auto const& record : m_records)
+        {
+            h256 const key(record.key);
+            records.insert(records.end(), key.data(), key.data() + h256::size);
+            appendDigestValue(records, record.value);
+        }
+        return sha3(records);
+    });
 }
 
 spDataObject Storage::asDataObject() const
 {
+    // Filled tests list the storage keys in string order ("0x0100" before "0x02")
+    std::vector<std::pair<string, StorageRecord const*>> ordered;
+    ordered.reserve(m_records.size());
+    for (auto const& record : m_records)
+        ordered.emplace_back(record.keyString(), &record);
+    std::sort(ordered.begin(), ordered.end(),
+        [](auto const& _lhs, auto const& _rhs) { return _lhs.first < _rhs.first; });
+
     spDataObject out(new DataObject(DataType::Object));
-    for (auto const& el : m_map)
-    {
-        StorageRecord const& record = el.second;
-        (*out)[std::get<0>(record)->asString()] = std::get<1>(record)->asString();
-    }
+    for (auto const& el : ordered)
+        (*out).addSubObject(sDataObject(el.first, el.second->value->asString()));
     return out;
 }
 
@@ -1,29 +1,54 @@
 #pragma once
 #include <retesteth/testStructures/basetypes.h>
+#include <retesteth/testStructures/types/Ethereum/Base/DigestCache.h>
 #include <libdataobj/DataObject.h>
 namespace test
 {
 namespace teststruct
 {
-// Account Storage  "0x11" -> {value("0x11"),  value("0x1122334455..32") }
-// TODO review the logic here
+// Account Storage  "0x11" -> value("0x1122334455..32")
+// Records are kept in a flat vector sorted by the u256 key
+// A storage slot is u256, keys above it and bigint keys are rejected on parsing
 struct Storage : GCP_SPointerBase
 {
+    Storage() {}
     Storage(DataObject const&);
-    typedef std::tuple<spVALUE, spVALUE> StorageRecord;
+    struct StorageRecord
+    {
+        dev::u256 key;
+        spVALUE value;
+        std::string keyString() const { return dev::toCompactHexPrefixed(key, 1); }
+    };
+    typedef std::vector<StorageRecord> StorageRecords;
 
-    std::map<std::string, StorageRecord> const& getKeys() const { return m_map; }
-    bool hasKey(VALUE const& _key) const { return m_map.count(_key.asString()); }
-    VALUE const& atKey(VALUE const& _key) const
+    // Storage key differs between the two storages, missing side is nullptr
+    struct DiffRecord
     {
-        assert(m_map.count(_key.asString()));
-        return std::get<1>(m_map.at(_key.asString()));
-    }
+        StorageRecord const* lhs;
+        StorageRecord const* rhs;
+    };
+
+    StorageRecords const& records() const { return m_records; }
+    size_t size() const { return m_records.size(); }
+    bool hasKey(dev::u256 const& _key) const { return findKey(_key) != nullptr; }
+    bool hasKey(VALUE const& _key) const;
+    VALUE const& atKey(dev::u256 const& _key) const;
+    VALUE const& atKey(VALUE const& _key) const;
+    // Keys in string order like the filled tests have them, not in the u256 order of records()
     spDataObject asDataObject() const;
     void merge(Storage const& _storage);
 
+    // Walk both storages in key order once and return the keys where values differ
+    std::vector<DiffRecord> diff(Storage const& _rhs) const;
+
+    // Hash of all records, storages with the same records have the same digest
+    // Calculated once on the first request, merge drops it
+    dev::h256 const& digest() const;
+
 private:
-    std::map<std::string, StorageRecord> m_map;
+    StorageRecord const* findKey(dev::u256 const& _key) const;
+    StorageRecords m_records;
+    DigestCache m_digest;
 };
 
 typedef GCP_SPointer<Storage> spStorage;
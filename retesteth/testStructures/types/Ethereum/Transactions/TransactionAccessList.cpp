@@ -66,7 +66,8 @@ TransactionAccessList::TransactionAccessList(BYTES const& _rlp) : TransactionLeg
 
 void TransactionAccessList::fromRLP(dev::RLP const& _rlp)
 {
-    if (_rlp.itemCount() != _rlpHeaderSize())
+    dev::RLPList const rlp(_rlp);
+    if (rlp.size() != _rlpHeaderSize())
         throw test::UpwardsException(TransactionTypeToString(type())
                                      + "::fromRLP(RLP) expected to have exactly "
                                      + test::fto_string(_rlpHeaderSize()) + " elements!");
@@ -77,29 +78,27 @@ void TransactionAccessList::fromRLP(dev::RLP const& _rlp)
     // 3 - gasLimit     6 - data    9 - s
     DataObject trData;
     size_t i = 0;
-    m_chainID = spVALUE(new VALUE(_rlp[i++]));
-    m_nonce = spVALUE(new VALUE(_rlp[i++]));
-    m_gasPrice = spVALUE(new VALUE(_rlp[i++]));
-    m_gasLimit = spVALUE(new VALUE(_rlp[i++]));
-
-    auto const r = _rlp[i++];
-    std::ostringstream stream;
-    stream << r.toBytes();
+    m_chainID = spVALUE(new VALUE(rlp[i++]));
+    m_nonce = spVALUE(new VALUE(rlp[i++]));
+    m_gasPrice = spVALUE(new VALUE(rlp[i++]));
+    m_gasLimit = spVALUE(new VALUE(rlp[i++]));
+
+    auto const r = rlp[i++];
     m_creation = false;
-    if (stream.str() == "0x")
+    if (r.toBytesConstRef().empty())
         m_creation = true;
     else
         m_to = spFH20(new FH20(r));
 
-    m_value = spVALUE(new VALUE(_rlp[i++]));
-    m_data = spBYTES(new BYTES(_rlp[i++]));
+    m_value = spVALUE(new VALUE(rlp[i++]));
+    m_data = spBYTES(new BYTES(rlp[i++]));
 
     // read access list
-    m_accessList = spAccessList(new AccessList(_rlp[i++]));
+    m_accessList = spAccessList(new AccessList(rlp[i++]));
 
-    m_v = spVALUE(new VALUE(_rlp[i++]));
-    m_r = spVALUE(new VALUE(_rlp[i++]));
-    m_s = spVALUE(new VALUE(_rlp[i++]));
+    m_v = spVALUE(new VALUE(rlp[i++]));
+    m_r = spVALUE(new VALUE(rlp[i++]));
+    m_s = spVALUE(new VALUE(rlp[i++]));
     m_secretKey = spVALUE(new VALUE(0));
     rebuildRLP();
 }
@@ -107,13 +106,12 @@ void TransactionAccessList::fromRLP(dev::RLP const& _rlp)
 dev::h256 TransactionAccessList::buildVRSHash() const
 {
     dev::RLPStream stream;
+    // Prefixed 01 byte + tr.rlp
+    dev::byte const txType = 1;
+    stream.appendRaw(dev::bytesConstRef(&txType, 1), 0);
     stream.appendList(8);
     TransactionAccessList::streamHeader(stream);
-
-    // Alter output with prefixed 01 byte + tr.rlp
-    dev::bytes outa = stream.out();
-    outa.insert(outa.begin(), dev::byte(1));  // txType
-    return dev::sha3(outa);
+    return dev::sha3(stream.out());
 }
 
 void TransactionAccessList::buildVRS()
@@ -160,23 +158,23 @@ const spDataObject TransactionAccessList::asDataObject(ExportOrder _order) const
 void TransactionAccessList::rebuildRLP()
 {
     // RLP(01 + tr.rlp)
-    dev::RLPStream wrapper;
     dev::RLPStream out;
+    dev::byte const txType = 1;
+    out.appendRaw(dev::bytesConstRef(&txType, 1), 0);
     out.appendList(_rlpHeaderSize());
     streamHeader(out);
     out << v().serializeRLP();
     out << r().serializeRLP();
     out << s().serializeRLP();
 
-    // Alter output with prefixed 01 byte + tr.rlp
-    dev::bytes outa = out.out();
-    outa.insert(outa.begin(), dev::byte(1));
-
     // Encode bytearray into rlp
-    wrapper << outa;
-    m_outRlpStream = wrapper;
+    dev::bytes const& outa = out.out();
+    dev::RLPStream wrapper;
+    wrapper.reserve(outa.size() + 4);
+    wrapper.append(dev::bytesConstRef(&outa));
     m_rawRLPdata = spBYTES(new BYTES(dev::toHexPrefixed(outa)));
     m_hash = spFH32(new FH32("0x" + dev::toString(dev::sha3(outa))));
+    m_outRlpStream = std::move(wrapper);
 }
 
 }  // namespace teststruct
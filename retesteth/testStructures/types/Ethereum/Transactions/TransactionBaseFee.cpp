@@ -90,37 +90,36 @@ TransactionBaseFee::TransactionBaseFee(BYTES const& _rlp) : Transaction()
 
 void TransactionBaseFee::fromRLP(dev::RLP const& _rlp)
 {
-    if (_rlp.itemCount() != _rlpHeaderSize())
+    dev::RLPList const rlp(_rlp);
+    if (rlp.size() != _rlpHeaderSize())
         throw test::UpwardsException(TransactionTypeToString(type())
                                      + "::fromRLP(RLP) expected to have exactly "
                                      + test::fto_string(_rlpHeaderSize()) + " elements!");
 
     size_t i = 0;
-    m_chainID = sVALUE(_rlp[i++]);
+    m_chainID = sVALUE(rlp[i++]);
 
-    m_nonce = sVALUE(_rlp[i++]);
-    m_maxPriorityFeePerGas = sVALUE(_rlp[i++]);
-    m_maxFeePerGas = sVALUE(_rlp[i++]);
-    m_gasLimit = sVALUE(_rlp[i++]);
+    m_nonce = sVALUE(rlp[i++]);
+    m_maxPriorityFeePerGas = sVALUE(rlp[i++]);
+    m_maxFeePerGas = sVALUE(rlp[i++]);
+    m_gasLimit = sVALUE(rlp[i++]);
 
-    auto const r = _rlp[i++];
-    std::ostringstream stream;
-    stream << r.toBytes();
+    auto const r = rlp[i++];
     m_creation = false;
-    if (stream.str() == "0x")
+    if (r.toBytesConstRef().empty())
         m_creation = true;
     else
         m_to = sFH20(r);
 
-    m_value = sVALUE(_rlp[i++]);
-    m_data = sBYTES(_rlp[i++]);
+    m_value = sVALUE(rlp[i++]);
+    m_data = sBYTES(rlp[i++]);
 
     // read access list
-    m_accessList = spAccessList(new AccessList(_rlp[i++]));
+    m_accessList = spAccessList(new AccessList(rlp[i++]));
 
-    m_v = sVALUE(_rlp[i++]);
-    m_r = sVALUE(_rlp[i++]);
-    m_s = sVALUE(_rlp[i++]);
+    m_v = sVALUE(rlp[i++]);
+    m_r = sVALUE(rlp[i++]);
+    m_s = sVALUE(rlp[i++]);
 
     m_secretKey = sVALUE(0);
     rebuildRLP();
@@ -129,13 +128,12 @@ void TransactionBaseFee::fromRLP(dev::RLP const& _rlp)
 dev::h256 TransactionBaseFee::buildVRSHash() const
 {
     dev::RLPStream stream;
+    // Prefixed 02 byte + tr.rlp
+    dev::byte const txType = 2;
+    stream.appendRaw(dev::bytesConstRef(&txType, 1), 0);
     stream.appendList(9);
     streamHeader(stream);
-
-    // Alter output with prefixed 02 byte + tr.rlp
-    dev::bytes outa = stream.out();
-    outa.insert(outa.begin(), dev::byte(2));  // txType
-    return dev::sha3(outa);
+    return dev::sha3(stream.out());
 }
 
 void TransactionBaseFee::streamHeader(dev::RLPStream& _s) const
@@ -223,23 +221,23 @@ const spDataObject TransactionBaseFee::asDataObject(ExportOrder _order) const
 void TransactionBaseFee::rebuildRLP()
 {
     // RLP(02 + tr.rlp)
-    dev::RLPStream wrapper;
     dev::RLPStream out;
+    dev::byte const txType = 2;
+    out.appendRaw(dev::bytesConstRef(&txType, 1), 0);
     out.appendList(_rlpHeaderSize());
     TransactionBaseFee::streamHeader(out);
     out << v().serializeRLP();
     out << r().serializeRLP();
     out << s().serializeRLP();
 
-    // Alter output with prefixed 02 byte + tr.rlp
-    dev::bytes outa = out.out();
-    outa.insert(outa.begin(), dev::byte(2));
-
     // Encode bytearray into rlp
-    wrapper << outa;
-    m_outRlpStream = wrapper;
+    dev::bytes const& outa = out.out();
+    dev::RLPStream wrapper;
+    wrapper.reserve(outa.size() + 4);
+    wrapper.append(dev::bytesConstRef(&outa));
     m_rawRLPdata = spBYTES(new BYTES(dev::toHexPrefixed(outa)));
     m_hash = spFH32(new FH32("0x" + dev::toString(dev::sha3(outa))));
+    m_outRlpStream = std::move(wrapper);
 }
 
 
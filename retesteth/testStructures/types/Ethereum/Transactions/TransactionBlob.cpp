@@ -79,44 +79,43 @@ TransactionBlob::TransactionBlob(BYTES const& _rlp) : TransactionBaseFee()
 
 void TransactionBlob::fromRLP(dev::RLP const& _rlp)
 {
-    if (_rlp.itemCount() != _rlpHeaderSize())
+    dev::RLPList const rlp(_rlp);
+    if (rlp.size() != _rlpHeaderSize())
         throw test::UpwardsException(TransactionTypeToString(type())
                                      + "::fromRLP(RLP) expected to have exactly "
                                      + test::fto_string(_rlpHeaderSize()) + " elements!");
 
     size_t i = 0;
-    m_chainID = sVALUE(_rlp[i++]);
+    m_chainID = sVALUE(rlp[i++]);
 
-    m_nonce = sVALUE(_rlp[i++]);
-    m_maxPriorityFeePerGas = sVALUE(_rlp[i++]);
-    m_maxFeePerGas = sVALUE(_rlp[i++]);
-    m_gasLimit = sVALUE(_rlp[i++]);
+    m_nonce = sVALUE(rlp[i++]);
+    m_maxPriorityFeePerGas = sVALUE(rlp[i++]);
+    m_maxFeePerGas = sVALUE(rlp[i++]);
+    m_gasLimit = sVALUE(rlp[i++]);
 
-    auto const r = _rlp[i++];
-    std::ostringstream stream;
-    stream << r.toBytes();
+    auto const r = rlp[i++];
     m_creation = false;
-    if (stream.str() == "0x")
+    if (r.toBytesConstRef().empty())
         m_creation = true;
     else
         m_to = sFH20(r);
 
-    m_value = sVALUE(_rlp[i++]);
-    m_data = sBYTES(_rlp[i++]);
+    m_value = sVALUE(rlp[i++]);
+    m_data = sBYTES(rlp[i++]);
 
     // read access list
-    m_accessList = spAccessList(new AccessList(_rlp[i++]));
+    m_accessList = spAccessList(new AccessList(rlp[i++]));
 
     // read blob
-    m_maxFeePerBlobGas = sVALUE(_rlp[i++]);
+    m_maxFeePerBlobGas = sVALUE(rlp[i++]);
 
-    auto const& listHashes = _rlp[i++];
+    auto const listHashes = rlp[i++];
     for (auto const& el : listHashes)
         m_blobVersionedHashes.emplace_back(FH32(el));
 
-    m_v = sVALUE(_rlp[i++]);
-    m_r = sVALUE(_rlp[i++]);
-    m_s = sVALUE(_rlp[i++]);
+    m_v = sVALUE(rlp[i++]);
+    m_r = sVALUE(rlp[i++]);
+    m_s = sVALUE(rlp[i++]);
 
     m_secretKey = sVALUE(0);
     rebuildRLP();
@@ -125,12 +124,12 @@ void TransactionBlob::fromRLP(dev::RLP const& _rlp)
 dev::h256 TransactionBlob::buildVRSHash() const
 {
     dev::RLPStream stream;
+    // Prefixed 03 byte + tr.rlp
+    dev::byte const txType = 3;
+    stream.appendRaw(dev::bytesConstRef(&txType, 1), 0);
     stream.appendList(11);
     streamHeader(stream);
-    // Alter output with prefixed 03 byte + tr.rlp
-    dev::bytes outa = stream.out();
-    outa.insert(outa.begin(), dev::byte(3));  // txType
-    return dev::sha3(outa);
+    return dev::sha3(stream.out());
 }
 
 void TransactionBlob::streamHeader(dev::RLPStream& _s) const
@@ -175,34 +174,37 @@ const spDataObject TransactionBlob::asDataObject(ExportOrder _order) const
 
     if (_order == ExportOrder::ToolStyle)
     {
+        static DataObjectNormalizer const toolNormalizer = DataObjectNormalizer()
+            .add(mod_removeLeadingZerosFromHexValues, {"data", "to", "input", "address", "hash", "storageKeys", "sender"})
+            .add(mod_removeBigIntHint);
         (*out)["type"] = "0x3";
-        (*out).performModifier(mod_removeLeadingZerosFromHexValues, DataObject::ModifierOption::RECURSIVE,
-            {"data", "to", "input", "address", "hash", "storageKeys", "sender"});
+        toolNormalizer.perform(out.getContent());
     }
-    (*out).performModifier(mod_removeBigIntHint);
+    else
+        (*out).performModifier(mod_removeBigIntHint);
     return out;
 }
 
 void TransactionBlob::rebuildRLP()
 {
     // RLP(03 + tr.rlp)
-    dev::RLPStream wrapper;
     dev::RLPStream out;
+    dev::byte const txType = 3;
+    out.appendRaw(dev::bytesConstRef(&txType, 1), 0);
     out.appendList(_rlpHeaderSize());
     TransactionBlob::streamHeader(out);
     out << v().serializeRLP();
     out << r().serializeRLP();
     out << s().serializeRLP();
 
-    // Alter output with prefixed 03 byte + tr.rlp
-    dev::bytes outa = out.out();
-    outa.insert(outa.begin(), dev::byte(3));
-
     // Encode bytearray into rlp
-    wrapper << outa;
-    m_outRlpStream = wrapper;
+    dev::bytes const& outa = out.out();
+    dev::RLPStream wrapper;
+    wrapper.reserve(outa.size() + 4);
+    wrapper.append(dev::bytesConstRef(&outa));
     m_rawRLPdata = sBYTES(dev::toHexPrefixed(outa));
     m_hash = sFH32("0x" + dev::toString(dev::sha3(outa)));
+    m_outRlpStream = std::move(wrapper);
 }
 
 
@@ -72,7 +72,8 @@ void TransactionLegacy::_fromData(DataObject const& _data)
 
 void TransactionLegacy::fromRLP(dev::RLP const& _rlp)
 {
-    if (_rlp.itemCount() != _rlpHeaderSize())
+    dev::RLPList const rlp(_rlp);
+    if (rlp.size() != _rlpHeaderSize())
         throw test::UpwardsException(TransactionTypeToString(type())
                                      + "::fromRLP(RLP) expected to have exactly "
                                      + test::fto_string(_rlpHeaderSize()) + " elements!");
@@ -81,24 +82,22 @@ void TransactionLegacy::fromRLP(dev::RLP const& _rlp)
     // 1 - gasPrice     4 - value   7 - r
     // 2 - gasLimit     5 - data    8 - s
     size_t i = 0;
-    m_nonce = sVALUE(_rlp[i++]);
-    m_gasPrice = sVALUE(_rlp[i++]);
-    m_gasLimit = sVALUE(_rlp[i++]);
+    m_nonce = sVALUE(rlp[i++]);
+    m_gasPrice = sVALUE(rlp[i++]);
+    m_gasLimit = sVALUE(rlp[i++]);
 
-    auto const r = _rlp[i++];
-    std::ostringstream stream;
-    stream << r.toBytes();
+    auto const r = rlp[i++];
     m_creation = false;
-    if (stream.str() == "0x")
+    if (r.toBytesConstRef().empty())
         m_creation = true;
     else
         m_to = sFH20(r);
 
-    m_value = sVALUE(_rlp[i++]);
-    m_data = sBYTES(_rlp[i++]);
-    m_v = sVALUE(_rlp[i++]);
-    m_r = sVALUE(_rlp[i++]);
-    m_s = sVALUE(_rlp[i++]);
+    m_value = sVALUE(rlp[i++]);
+    m_data = sBYTES(rlp[i++]);
+    m_v = sVALUE(rlp[i++]);
+    m_r = sVALUE(rlp[i++]);
+    m_s = sVALUE(rlp[i++]);
 
     if (m_v.getCContent() == 27 || m_v.getCContent() == 28)
         m_chainID = sVALUE(1);
@@ -234,9 +233,9 @@ void TransactionLegacy::rebuildRLP()
     out << v().serializeRLP();
     out << r().serializeRLP();
     out << s().serializeRLP();
-    m_outRlpStream = out;
     m_rawRLPdata = sBYTES(dev::toHexPrefixed(out.out()));
     m_hash = sFH32("0x" + dev::toString(dev::sha3(out.out())));
+    m_outRlpStream = std::move(out);
 }
 
 }  // namespace teststruct
@@ -0,0 +1,87 @@
+#include "TrieRoots.h"
+#include <libdevcore/SHA3.h>
+#include <libdevcore/TrieHash.h>
+#include <retesteth/EthChecks.h>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+test::teststruct::FH32 asFH32(h256 const& _hash)
+{
+    return test::teststruct::FH32(toHexPrefixed(_hash));
+}
+
+h256 storageTrieRoot(test::teststruct::Storage const& _storage)
+{
+    vector<pair<bytes, bytes>> items;
+    items.reserve(_storage.size());
+    for (auto const& record : _storage.records())
+    {
+        // Zero values are not stored in the trie
+        if (record.value->asBigInt() == 0)
+            continue;
+        RLPStream value;
+        value << record.value->asBigInt();
+        items.emplace_back(sha3(h256(record.key)).asBytes(), value.out());
+    }
+    return trieRoot(items);
+}
+}  // namespace
+
+namespace test::teststruct
+{
+FH32 storageRoot(Storage const& _storage)
+{
+    return asFH32(storageTrieRoot(_storage));
+}
+
+FH32 stateRoot(State const& _state)
+{
+    vector<pair<bytes, bytes>> items;
+    items.reserve(_state.accounts().size());
+    for (auto const& [address, account] : _state.accounts())
+    {
+        RLPStream accountRlp(4);
+        accountRlp << account->nonce().asBigInt();
+        accountRlp << account->balance().asBigInt();
+        accountRlp << storageTrieRoot(account->storage());
+        accountRlp << sha3(fromHex(account->code().asString()));
+        items.emplace_back(sha3(fromHex(address.asString())).asBytes(), accountRlp.out());
+    }
+    return asFH32(trieRoot(items));
+}
+
+FH32 transactionsRoot(vector<spTransaction> const& _transactions)
+{
+    vector<bytes> items;
+    items.reserve(_transactions.size());
+    for (auto const& tr : _transactions)
+        items.emplace_back(fromHex(tr->getRawBytes().asString()));
+    return asFH32(orderedTrieRoot(items));
+}
+
+FH32 withdrawalsRoot(vector<spWithdrawal> const& _withdrawals)
+{
+    vector<bytes> items;
+    items.reserve(_withdrawals.size());
+    for (auto const& wt : _withdrawals)
+        items.emplace_back(wt->asRLPStream().out());
+    return asFH32(orderedTrieRoot(items));
+}
+
+FH32 receiptsRoot(vector<ToolResponseReceipt> const& _receipts)
+{
+    vector<bytes> items;
+    items.reserve(_receipts.size());
+    for (auto const& receipt : _receipts)
+    {
+        if (receipt.consensusBytes().empty())
+            throw test::UpwardsException("receiptsRoot: receipt " + receipt.trHash().asString() + " has no consensus fields");
+        items.emplace_back(receipt.consensusBytes());
+    }
+    return asFH32(orderedTrieRoot(items));
+}
+
+}  // namespace teststruct
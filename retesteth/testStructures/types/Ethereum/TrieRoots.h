@@ -0,0 +1,19 @@
+#pragma once
+#include "State.h"
+#include "Withdrawals.h"
+#include "Transactions/Transaction.h"
+#include "../RPC/SubElements/ToolResponseReceipt.h"
+
+namespace test::teststruct
+{
+// Merkle Patricia trie roots of the test structures, calculated by retesteth
+// without asking the client. Used to verify and replace the roots returned by t8n tools
+FH32 stateRoot(State const& _state);
+FH32 storageRoot(Storage const& _storage);
+FH32 transactionsRoot(std::vector<spTransaction> const& _transactions);
+FH32 withdrawalsRoot(std::vector<spWithdrawal> const& _withdrawals);
+
+// The receipts have to carry their consensus fields, see ToolResponseReceipt::consensusBytes
+FH32 receiptsRoot(std::vector<ToolResponseReceipt> const& _receipts);
+
+}  // namespace teststruct
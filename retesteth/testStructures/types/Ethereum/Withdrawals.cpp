@@ -47,7 +47,7 @@ spDataObject Withdrawal::asDataObject(ExportOrder _order) const
     return ret;
 }
 
-const RLPStream Withdrawal::asRLPStream() const
+RLPStream Withdrawal::asRLPStream() const
 {
     RLPStream rlp;
     rlp.appendList(4);
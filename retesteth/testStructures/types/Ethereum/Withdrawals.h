@@ -15,7 +15,7 @@ struct Withdrawal : GCP_SPointerBase
     spVALUE validatorIndex;
     spFH20 address;
     spVALUE amount;
-    const dev::RLPStream asRLPStream() const;
+    dev::RLPStream asRLPStream() const;
 };
 
 typedef dataobject::GCP_SPointer<Withdrawal> spWithdrawal;
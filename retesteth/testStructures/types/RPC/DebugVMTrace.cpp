@@ -1,7 +1,7 @@
 #include "DebugVMTrace.h"
 #include <EthChecks.h>
 #include <retesteth/helpers/TestHelper.h>
-#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
 #include <testStructures/Common.h>
 #include <boost/filesystem/fstream.hpp>
 #include <Options.h>
@@ -55,45 +55,15 @@ void DebugVMTrace::DebugVMTraceRaw::print() const
 DebugVMTrace::DebugVMTraceNice::DebugVMTraceNice(string const& _info, fs::path const& _logs)
 {
     m_infoString = _info;
-    string line;
-    size_t k = 0;
     if (!fs::exists(_logs))
         return;
 
-    try
-    {
-        fs::ifstream fileHandler(_logs);
-        if (Options::get().fillvmtrace)
-        {
-            while (getline(fileHandler, line))
-                readLog(line);
-        }
-        else
-        {
-            while (getline(fileHandler, line))
-            {
-                if (++k < c_maxRowsToPrint)
-                    readLog(line);
-                else if (k == c_maxRowsToPrint)
-                {
-                    m_limitReached = true;
-                    break;
-                }
-            }
-        }
-        if (m_log.size() == 0)
-            ETH_WARNING("Reading empty vmtrace logs: " + _logs.string());
-        fileHandler.close();
-    }
-    catch (const ifstream::failure& e) {
-        throw UpwardsException("Error reading trace file: " + _logs.string());
-    }
-}
-
-void DebugVMTrace::DebugVMTraceNice::readLog(string const& _line)
-{
-    auto const data = ConvertJsoncppStringToData(_line);
-    m_log.emplace_back(VMLogRecord(data));
+    // The trace is parsed in place from the mapped file, rows are rendered only when printed
+    dev::MappedFile const file(_logs);
+    size_t const maxRows = Options::get().fillvmtrace ? 0 : c_maxRowsToPrint - 1;
+    m_limitReached = !m_log.read(file.view(), maxRows);
+    if (m_log.empty())
+        ETH_WARNING("Reading empty vmtrace logs: " + _logs.string());
 }
 
 DebugVMTrace::DebugVMTrace(string const& _info, fs::path const& _logs)
@@ -124,23 +94,24 @@ DebugVMTrace::DebugVMTrace(string const& _info, fs::path const& _logs)
 void DebugVMTrace::DebugVMTraceNice::print() const
 {
     ETH_DC_MESSAGE(DC::DEFAULT, m_infoString);
-    if (m_log.size() == 0)
+    if (m_log.empty())
         return;
 
     string s_comment = "";
-    dev::bigint maxGas = m_log.at(0).isShort ? 500000 : m_log.at(0).gas->asBigInt();
+    dev::bigint maxGas = m_log.isShort(0) ? 500000 : m_log.gas(0);
     size_t k = 0;
     size_t const step = 9;
     string const stepw = "          ";
 
     std::cout << cBYellowBlack << "N" << setw(15) << "OPNAME" << setw(10) << "GASCOST" << setw(10) << "TOTALGAS" << setw(10)
               << "REMAINGAS" << setw(10) << "STACK" << cDefault << std::endl;
-    for (VMLogRecord const& el : m_log)
+    for (size_t i = 0; i < m_log.size(); i++)
     {
         // Last record with error info
-        if (el.isShort)
+        if (m_log.isShort(i))
             continue;
 
+        VMLogRecord const el = m_log.record(i);
         if (!s_comment.empty())
         {
             std::cout << setw(step * el.depth) << cYellow << s_comment << cDefault << std::endl;
@@ -218,7 +189,7 @@ void DebugVMTrace::exportLogs(fs::path const& _folder) const
     }
 }
 
-std::vector<VMLogRecord> const& DebugVMTrace::getLog()
+VMTraceLog const& DebugVMTrace::getLog()
 {
     return m_impl->getLog();
 }
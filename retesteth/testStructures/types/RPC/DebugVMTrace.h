@@ -1,5 +1,5 @@
 #pragma once
-#include "VMLogRecord.h"
+#include "VMTraceLog.h"
 #include <libdataobj/DataObject.h>
 #include <boost/filesystem/path.hpp>
 
@@ -13,11 +13,11 @@ private:
     {
     public:
         virtual void print() const = 0;
-        std::vector<VMLogRecord> const& getLog() const { return m_log; };
+        VMTraceLog const& getLog() const { return m_log; };
         virtual ~DebugVMTraceImplInterface(){}
     protected:
         std::string m_infoString;
-        std::vector<VMLogRecord> m_log;
+        VMTraceLog m_log;
     };
     class DebugVMTraceRaw : public DebugVMTraceImplInterface
     {
@@ -33,7 +33,6 @@ private:
         DebugVMTraceNice(std::string const& _info, boost::filesystem::path const&);
         void print() const override;
     private:
-        void readLog(std::string const&);
         bool m_limitReached = false;
     };
 
@@ -43,7 +42,7 @@ public:
     DebugVMTrace(std::string const& _info, boost::filesystem::path const& _logs);
     void print() const;
     void exportLogs(boost::filesystem::path const& _folder) const;
-    std::vector<VMLogRecord> const& getLog();
+    VMTraceLog const& getLog();
     ~DebugVMTrace();
 
 private:
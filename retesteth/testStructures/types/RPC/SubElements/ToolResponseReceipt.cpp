@@ -23,6 +23,37 @@ ToolResponseReceipt::ToolResponseReceipt(DataObject const& _data)
 
     m_trHash = sFH32(_data.atKey(c_transactionHash));
     m_trGasUsed = sVALUE(_data.atKey(c_gasUsed));
+
+    // Before Byzantium the receipt holds the post state root instead of the status
+    bool const hasRoot = _data.count("root") && _data.atKey("root").asString().size() > 2;
+    if ((hasRoot || _data.count("status")) && _data.count("cumulativeGasUsed") && _data.count(c_logsBloom))
+    {
+        dev::RLPStream rlp(4);
+        if (hasRoot)
+            rlp << FH32(_data.atKey("root")).serializeRLP();
+        else
+            rlp << VALUE(_data.atKey("status")).serializeRLP();
+        rlp << VALUE(_data.atKey("cumulativeGasUsed")).serializeRLP();
+        rlp << FH256(_data.atKey(c_logsBloom)).serializeRLP();
+
+        size_t const logsCount = _data.count("logs") ? _data.atKey("logs").getSubObjects().size() : 0;
+        rlp.appendList(logsCount);
+        for (size_t i = 0; i < logsCount; i++)
+        {
+            DataObject const& log = _data.atKey("logs").getSubObjects().at(i);
+            auto const& topics = log.atKey("topics").getSubObjects();
+            rlp.appendList(3);
+            rlp << FH20(log.atKey("address")).serializeRLP();
+            rlp.appendList(topics.size());
+            for (auto const& topic : topics)
+                rlp << FH32(topic).serializeRLP();
+            rlp << dev::fromHex(log.atKey("data").asString());
+        }
+
+        if (_data.count("type") && VALUE(_data.atKey("type")).asBigInt() != 0)
+            m_consensusBytes.push_back((dev::byte)VALUE(_data.atKey("type")).asBigInt());
+        m_consensusBytes.insert(m_consensusBytes.end(), rlp.out().begin(), rlp.out().end());
+    }
 }
 
 
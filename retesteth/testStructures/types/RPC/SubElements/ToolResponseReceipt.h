@@ -12,10 +12,15 @@ struct ToolResponseReceipt
     FH32 const& trHash() const { return m_trHash; }
     VALUE const& gasUsed() const { return m_trGasUsed; }
 
+    // Receipt as stored in the receipts trie: type || rlp([status, cumulativeGasUsed, logsBloom, logs])
+    // Empty if the tool did not export the consensus fields
+    dev::bytes const& consensusBytes() const { return m_consensusBytes; }
+
 private:
     ToolResponseReceipt() {}
     spVALUE m_trGasUsed;
     spFH32 m_trHash;
+    dev::bytes m_consensusBytes;
 };
 
 }  // namespace teststruct
@@ -50,7 +50,8 @@ VMLogRecord::VMLogRecord(DataObject const& _obj)
                     {"depth", {{DataType::Integer}, jsonField::Required}},
                     {"refund", {{DataType::Integer}, jsonField::Required}},
                     {"opName", {{DataType::String}, jsonField::Required}},
-                    {"returnData", {{DataType::String}, jsonField::Optional}},
+                    {"returnStack", {{DataType::Array}, jsonField::Optional}},
+                    {"returnData", {{DataType::String, DataType::Null}, jsonField::Optional}},
                     {"error", {{DataType::String}, jsonField::Optional}}});
         }
 
@@ -78,12 +79,13 @@ VMLogRecord::VMLogRecord(DataObject const& _obj)
             memSize = _obj.atKey("memSize").asInt();
             for (auto const& el : _obj.atKey("stack").getSubObjects())
                 stack.emplace_back(el->asString());
-            if (_obj.count("returnData") && !_obj.atKey("returnData").asString().empty())
+            if (_obj.count("returnData") && _obj.atKey("returnData").type() == DataType::String &&
+                !_obj.atKey("returnData").asString().empty())
                 returnData = spBYTES(new BYTES(_obj.atKey("returnData")));
             else
                 returnData = spBYTES(new BYTES(DataObject("0x")));
             depth = _obj.atKey("depth").asInt();
-            refund = _obj.atKey("refund").asInt();
+            refund = spVALUE(new VALUE(dev::bigint(_obj.atKey("refund").asInt())));
             opName = _obj.atKey("opName").asString();
             error = _obj.count("error") ? _obj.atKey("error").asString() : "";
         }
@@ -14,16 +14,17 @@ Transaction number: 0, hash: 0x5363f287fccaad86a0ce8d2c5b15b4b917afe6ebac6a87e61
 
 struct VMLogRecord
 {
+    VMLogRecord() {}
     VMLogRecord(DataObject const&);
-    size_t pc;
-    size_t op;
+    size_t pc = 0;
+    size_t op = 0;
     spVALUE gas;
     spVALUE gasCost;
     spBYTES memory;
-    long long memSize;
+    long long memSize = 0;
     std::vector<std::string> stack;
     spBYTES returnData;
-    size_t depth;
+    size_t depth = 0;
     spVALUE refund;
     std::string opName;
     std::string error;
@@ -0,0 +1,378 @@
+#include "VMTraceLog.h"
+#include <retesteth/EthChecks.h>
+#include <libdataobj/ConvertFile.h>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+using namespace dataobject;
+using namespace test;
+using namespace test::teststruct;
+
+namespace
+{
+// Cursor over one trace line. Covers the json produced by the clients for EIP-3155 traces.
+// Anything unusual (escapes, floats, nested objects in known fields) makes the caller use the general json parser
+class TraceLineCursor
+{
+public:
+    TraceLineCursor(string_view _line) : m_p(_line.data()), m_end(_line.data() + _line.size()) {}
+
+    void skipWs()
+    {
+        while (m_p < m_end && (*m_p == ' ' || *m_p == '\t' || *m_p == '\r' || *m_p == '\n'))
+            m_p++;
+    }
+
+    bool eat(char _c)
+    {
+        skipWs();
+        if (m_p < m_end && *m_p == _c)
+        {
+            m_p++;
+            return true;
+        }
+        return false;
+    }
+
+    bool peek(char _c)
+    {
+        skipWs();
+        return m_p < m_end && *m_p == _c;
+    }
+
+    bool atEnd()
+    {
+        skipWs();
+        return m_p == m_end;
+    }
+
+    bool readString(string_view& _out)
+    {
+        if (!eat('"'))
+            return false;
+        char const* const close = static_cast<char const*>(memchr(m_p, '"', m_end - m_p));
+        if (close == nullptr || memchr(m_p, '\\', close - m_p) != nullptr)
+            return false;
+        _out = string_view(m_p, close - m_p);
+        m_p = close + 1;
+        return true;
+    }
+
+    bool readUint(uint64_t& _out)
+    {
+        skipWs();
+        char const* const begin = m_p;
+        uint64_t value = 0;
+        while (m_p < m_end && *m_p >= '0' && *m_p <= '9')
+            value = value * 10 + (*m_p++ - '0');
+        _out = value;
+        return m_p != begin && m_p - begin < 20 && (m_p == m_end || (*m_p != '.' && *m_p != 'e' && *m_p != 'E'));
+    }
+
+    // "0x5c878" hex quantity
+    bool readHexString(uint64_t& _out)
+    {
+        string_view str;
+        if (!readString(str) || str.size() < 3 || str.size() > 18 || str[0] != '0' || str[1] != 'x')
+            return false;
+        uint64_t value = 0;
+        for (size_t i = 2; i < str.size(); i++)
+        {
+            char const c = str[i];
+            int digit;
+            if (c >= '0' && c <= '9')
+                digit = c - '0';
+            else if (c >= 'a' && c <= 'f')
+                digit = c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F')
+                digit = c - 'A' + 10;
+            else
+                return false;
+            value = (value << 4) | digit;
+        }
+        _out = value;
+        return true;
+    }
+
+    bool readNull()
+    {
+        skipWs();
+        if (m_end - m_p >= 4 && memcmp(m_p, "null", 4) == 0)
+        {
+            m_p += 4;
+            return true;
+        }
+        return false;
+    }
+
+    // Skip a value of a field that is not stored
+    bool skipValue()
+    {
+        skipWs();
+        if (m_p == m_end)
+            return false;
+        if (*m_p == '"')
+        {
+            string_view str;
+            return readString(str);
+        }
+        if (*m_p == '[' || *m_p == '{')
+        {
+            char const close = *m_p == '[' ? ']' : '}';
+            m_p++;
+            if (eat(close))
+                return true;
+            do
+            {
+                string_view key;
+                if (close == '}' && (!readString(key) || !eat(':')))
+                    return false;
+                if (!skipValue())
+                    return false;
+            } while (eat(','));
+            return eat(close);
+        }
+        while (m_p < m_end && *m_p != ',' && *m_p != '}' && *m_p != ']' && *m_p != ' ')
+            m_p++;
+        return true;
+    }
+
+private:
+    char const* m_p;
+    char const* m_end;
+};
+
+enum TraceField : uint32_t
+{
+    PC = 1 << 0,
+    OP = 1 << 1,
+    GAS = 1 << 2,
+    GASCOST = 1 << 3,
+    MEMSIZE = 1 << 4,
+    STACK = 1 << 5,
+    DEPTH = 1 << 6,
+    REFUND = 1 << 7,
+    OPNAME = 1 << 8,
+    OUTPUT = 1 << 9,
+    GASUSED = 1 << 10
+};
+uint32_t const c_stepFields = PC | OP | GAS | GASCOST | MEMSIZE | STACK | DEPTH | REFUND | OPNAME;
+uint32_t const c_summaryFields = OUTPUT | GASUSED;
+
+uint64_t valueToUint64(spVALUE const& _value, string const& _field)
+{
+    if (_value.isEmpty())
+        return 0;
+    if (_value->asBigInt() > numeric_limits<uint64_t>::max())
+        throw UpwardsException("VMTraceLog: `" + _field + "` does not fit uint64: " + _value->asString());
+    return (uint64_t)_value->asBigInt();
+}
+}  // namespace
+
+namespace test::teststruct
+{
+bool VMTraceLog::read(string_view _data, size_t _maxRows)
+{
+    size_t pos = 0;
+    while (pos < _data.size())
+    {
+        size_t end = _data.find('\n', pos);
+        if (end == string_view::npos)
+            end = _data.size();
+        string_view const line = _data.substr(pos, end - pos);
+        pos = end + 1;
+        if (line.find_first_not_of(" \t\r") == string_view::npos)
+            continue;
+        if (_maxRows != 0 && size() >= _maxRows)
+            return false;
+        appendLine(line);
+    }
+    return true;
+}
+
+void VMTraceLog::appendLine(string_view _line)
+{
+    if (parseLine(_line))
+        return;
+
+    // Lines the fast parser does not cover
+    spDataObject const data = ConvertJsoncppStringToData(string(_line));
+    append(VMLogRecord(data));
+}
+
+bool VMTraceLog::parseLine(string_view _line)
+{
+    size_t const stackSize = m_stack.size();
+    size_t const arenaSize = m_arena.size();
+    auto const rollback = [this, stackSize, arenaSize]() {
+        m_stack.resize(stackSize);
+        m_arena.resize(arenaSize);
+        return false;
+    };
+
+    uint64_t pc = 0, op = 0, gas = 0, gasCost = 0, memSize = 0, depth = 0, refund = 0;
+    string_view opName, error, memory, returnData;
+    uint32_t fields = 0;
+
+    TraceLineCursor cur(_line);
+    if (!cur.eat('{'))
+        return false;
+    if (!cur.peek('}'))
+    {
+        do
+        {
+            string_view key;
+            if (!cur.readString(key) || !cur.eat(':'))
+                return rollback();
+
+            bool ok = true;
+            if (key == "pc")
+                ok = cur.readUint(pc), fields |= PC;
+            else if (key == "op")
+                ok = cur.readUint(op) && op < 256, fields |= OP;
+            else if (key == "gas")
+                ok = cur.readHexString(gas), fields |= GAS;
+            else if (key == "gasCost")
+                ok = cur.readHexString(gasCost), fields |= GASCOST;
+            else if (key == "memSize")
+                ok = cur.readUint(memSize), fields |= MEMSIZE;
+            else if (key == "depth")
+                ok = cur.readUint(depth) && depth <= numeric_limits<uint16_t>::max(), fields |= DEPTH;
+            else if (key == "refund")
+                ok = cur.readUint(refund), fields |= REFUND;
+            else if (key == "opName")
+                ok = cur.readString(opName), fields |= OPNAME;
+            else if (key == "error")
+                ok = cur.readString(error);
+            else if (key == "memory")
+                ok = cur.readString(memory);
+            else if (key == "returnData")
+                ok = cur.readNull() || cur.readString(returnData);
+            else if (key == "output")
+                ok = cur.skipValue(), fields |= OUTPUT;
+            else if (key == "gasUsed")
+                ok = cur.skipValue(), fields |= GASUSED;
+            else if (key == "stack")
+            {
+                fields |= STACK;
+                ok = cur.eat('[');
+                if (ok && !cur.eat(']'))
+                {
+                    do
+                    {
+                        string_view item;
+                        ok = cur.readString(item);
+                        if (ok)
+                            m_stack.emplace_back(addString(item));
+                    } while (ok && cur.eat(','));
+                    ok = ok && cur.eat(']');
+                }
+            }
+            else
+                ok = cur.skipValue();
+
+            if (!ok)
+                return rollback();
+        } while (cur.eat(','));
+    }
+    if (!cur.eat('}') || !cur.atEnd())
+        return rollback();
+
+    bool const isStep = (fields & c_stepFields) == c_stepFields;
+    bool const isSummary = !(fields & PC) && (fields & c_summaryFields) == c_summaryFields;
+    if (!isStep && !isSummary)
+        return rollback();
+
+    size_t const row = size();
+    m_isShort.push_back(isSummary);
+    m_pc.push_back(pc);
+    m_op.push_back(op);
+    m_gas.push_back(gas);
+    m_gasCost.push_back(gasCost);
+    m_memSize.push_back(memSize);
+    m_refund.push_back(refund);
+    m_depth.push_back(depth);
+    m_opName.push_back(isStep ? internOpName(opName) : 0);
+    m_stackBegin.push_back(m_stack.size());
+    if (!error.empty())
+        m_error.emplace(row, addString(error));
+    if (isStep && memory.size() > 2)
+        m_memory.emplace(row, addString(memory));
+    if (isStep && !returnData.empty())
+        m_returnData.emplace(row, addString(returnData));
+    return true;
+}
+
+void VMTraceLog::append(VMLogRecord const& _record)
+{
+    size_t const row = size();
+    m_isShort.push_back(_record.isShort);
+    m_pc.push_back(_record.pc);
+    m_op.push_back(_record.op);
+    m_gas.push_back(valueToUint64(_record.gas, "gas"));
+    m_gasCost.push_back(valueToUint64(_record.gasCost, "gasCost"));
+    m_memSize.push_back(_record.memSize);
+    m_refund.push_back(valueToUint64(_record.refund, "refund"));
+    m_depth.push_back(_record.depth);
+    m_opName.push_back(_record.isShort ? 0 : internOpName(_record.opName));
+    for (auto const& el : _record.stack)
+        m_stack.emplace_back(addString(el));
+    m_stackBegin.push_back(m_stack.size());
+    if (!_record.error.empty())
+        m_error.emplace(row, addString(_record.error));
+    if (!_record.memory.isEmpty() && _record.memory->asString().size() > 2)
+        m_memory.emplace(row, addString(_record.memory->asString()));
+    if (!_record.returnData.isEmpty() && _record.returnData->asString().size() > 2)
+        m_returnData.emplace(row, addString(_record.returnData->asString()));
+}
+
+VMLogRecord VMTraceLog::record(size_t _i) const
+{
+    VMLogRecord record;
+    record.isShort = m_isShort.at(_i);
+    auto const error = m_error.find(_i);
+    if (error != m_error.end())
+        record.error = arenaString(error->second);
+    if (record.isShort)
+        return record;
+
+    record.pc = m_pc.at(_i);
+    record.op = m_op.at(_i);
+    record.gas = spVALUE(new VALUE(dev::bigint(m_gas.at(_i))));
+    record.gasCost = spVALUE(new VALUE(dev::bigint(m_gasCost.at(_i))));
+    record.memSize = m_memSize.at(_i);
+    record.refund = spVALUE(new VALUE(dev::bigint(m_refund.at(_i))));
+    record.depth = m_depth.at(_i);
+    record.opName = m_opNames.at(m_opName.at(_i));
+    for (size_t k = m_stackBegin.at(_i); k < m_stackBegin.at(_i + 1); k++)
+        record.stack.emplace_back(arenaString(m_stack.at(k)));
+
+    auto const memory = m_memory.find(_i);
+    record.memory = spBYTES(new BYTES(DataObject(memory != m_memory.end() ? arenaString(memory->second) : "0x")));
+    auto const returnData = m_returnData.find(_i);
+    record.returnData =
+        spBYTES(new BYTES(DataObject(returnData != m_returnData.end() ? arenaString(returnData->second) : "0x")));
+    return record;
+}
+
+VMTraceLog::ArenaRef VMTraceLog::addString(string_view _str)
+{
+    ArenaRef const ref(m_arena.size(), _str.size());
+    m_arena.append(_str);
+    return ref;
+}
+
+uint16_t VMTraceLog::internOpName(string_view _name)
+{
+    // Few distinct names, linear search from the most recent is enough
+    for (size_t i = m_opNames.size(); i > 0; i--)
+        if (m_opNames[i - 1] == _name)
+            return i - 1;
+    if (m_opNames.size() == numeric_limits<uint16_t>::max())
+        throw UpwardsException("VMTraceLog: too many distinct opNames in the trace");
+    m_opNames.emplace_back(_name);
+    return m_opNames.size() - 1;
+}
+
+}  // namespace test::teststruct
@@ -0,0 +1,52 @@
+#pragma once
+#include "VMLogRecord.h"
+#include <map>
+#include <string_view>
+
+namespace test::teststruct
+{
+// EIP-3155 trace stored by columns, one row per trace line
+// Rows are rendered into VMLogRecord only when requested
+class VMTraceLog
+{
+public:
+    // Read trace lines from _data, at most _maxRows rows (0 - no limit)
+    // Return false if stopped by the limit
+    bool read(std::string_view _data, size_t _maxRows = 0);
+    void appendLine(std::string_view _line);
+    void append(VMLogRecord const& _record);
+
+    size_t size() const { return m_op.size(); }
+    bool empty() const { return m_op.empty(); }
+    bool isShort(size_t _i) const { return m_isShort.at(_i); }
+    uint8_t op(size_t _i) const { return m_op.at(_i); }
+    uint64_t gas(size_t _i) const { return m_gas.at(_i); }
+    uint16_t depth(size_t _i) const { return m_depth.at(_i); }
+    VMLogRecord record(size_t _i) const;
+
+private:
+    typedef std::pair<size_t, size_t> ArenaRef;  // offset, size in m_arena
+    bool parseLine(std::string_view _line);
+    ArenaRef addString(std::string_view _str);
+    std::string arenaString(ArenaRef const& _ref) const { return m_arena.substr(_ref.first, _ref.second); }
+    uint16_t internOpName(std::string_view _name);
+
+    std::vector<uint64_t> m_pc;
+    std::vector<uint8_t> m_op;
+    std::vector<uint64_t> m_gas;
+    std::vector<uint64_t> m_gasCost;
+    std::vector<uint64_t> m_memSize;
+    std::vector<uint64_t> m_refund;
+    std::vector<uint16_t> m_depth;
+    std::vector<uint16_t> m_opName;
+    std::vector<bool> m_isShort;
+    std::vector<uint32_t> m_stackBegin = {0};  // row stack is m_stack[m_stackBegin[i], m_stackBegin[i + 1])
+    std::vector<ArenaRef> m_stack;
+    std::map<size_t, ArenaRef> m_error;  // only rows with error, memory, returnData
+    std::map<size_t, ArenaRef> m_memory;
+    std::map<size_t, ArenaRef> m_returnData;
+    std::string m_arena;
+    std::vector<std::string> m_opNames;
+};
+
+}  // namespace test::teststruct
@@ -27,11 +27,12 @@ void requireStateTestsFillerEnvScheme(spDataObject const& _data)
 
 void convertEnvDecFieldsToHex(spDataObject& _data)
 {
-    (*_data).performModifier(mod_valueToCompactEvenHexPrefixed, DataObject::ModifierOption::RECURSIVE,
-        {"currentCoinbase", "previousHash", "currentRandom"});
+    static DataObjectNormalizer const envNormalizer = DataObjectNormalizer()
+        .add(mod_valueToCompactEvenHexPrefixed, {"currentCoinbase", "previousHash", "currentRandom"})
+        .add(mod_valueToLowerCase);
     (*_data).atKeyUnsafe("currentCoinbase").performModifier(mod_valueInsertZeroXPrefix);
     (*_data).atKeyUnsafe("previousHash").performModifier(mod_valueInsertZeroXPrefix);
-    (*_data).performModifier(mod_valueToLowerCase);
+    envNormalizer.perform(_data.getContent());
 }
 }  // namespace
 
@@ -84,14 +84,12 @@ StateTestInFilled::StateTestInFilled(spDataObject& _data)
     m_env = GCP_SPointer<StateTestEnv>(new StateTestEnv(_data->atKey("env")));
 
     // -- Some tests has storage keys/values with leading zeros. Convert it to hex value
+    static DataObjectNormalizer const storageNormalizer = {mod_keyToCompactEvenHexPrefixed, mod_valueToCompactEvenHexPrefixed};
     for (auto& spAcc : _data.getContent().atKeyUnsafe("pre").getSubObjectsUnsafe())
     {
         DataObject& acc = spAcc.getContent();
         for (auto& rec : acc["storage"].getSubObjectsUnsafe())
-        {
-            rec.getContent().performModifier(mod_keyToCompactEvenHexPrefixed);
-            rec.getContent().performModifier(mod_valueToCompactEvenHexPrefixed);
-        }
+            storageNormalizer.perform(rec.getContent());
     }
     // -- REMOVE THIS, FIX THE TESTS
     m_pre = spState(new State(MOVE(_data, "pre")));
@@ -0,0 +1,266 @@
+#include "FilledTestIndex.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+using namespace std;
+using namespace dev;
+using namespace dataobject;
+namespace fs = boost::filesystem;
+
+namespace
+{
+string const c_indexFileName = ".retesteth-index";
+
+// Parsed index files by directory, reloaded when the index file changes
+struct CachedIndex
+{
+    string fileId;
+    bool updated = false;  // has records that are not saved yet
+    map<string, pair<string, test::testsuite::FilledTestIndex::TestRecords>> files;  // file => (file id, tests)
+};
+map<string, CachedIndex> g_indexCache;
+std::mutex g_indexMutex;
+
+CachedIndex& loadIndex(fs::path const& _dir)
+{
+    fs::path const indexFile = _dir / c_indexFileName;
+    string const indexId = test::fileIdentity(indexFile);
+    CachedIndex& cached = g_indexCache[_dir.string()];
+    if (cached.fileId == indexId || cached.updated)
+        return cached;
+
+    cached = CachedIndex();
+    cached.fileId = indexId;
+    if (indexId.empty())
+        return cached;
+    try
+    {
+        spDataObject const index = ConvertJsoncppStringToData(dev::contentsString(indexFile));
+        for (auto const& file : index->getSubObjects())
+        {
+            test::testsuite::FilledTestIndex::TestRecords records;
+            for (auto const& test : file->atKey("tests").getSubObjects())
+            {
+                test::testsuite::FilledTestIndex::TestRecord record;
+                record.name = test->getKey();
+                record.begin = std::stoull(test->atKey("begin").asString());
+                record.end = std::stoull(test->atKey("end").asString());
+                record.sourceHash = test->atKey("sourceHash").asString();
+                record.generatedTestHash = test->atKey("generatedTestHash").asString();
+                record.fillingToolVersion = test->atKey("filling-tool-version").asString();
+                records.emplace_back(std::move(record));
+            }
+            cached.files[file->getKey()] = {file->atKey("id").asString(), std::move(records)};
+        }
+    }
+    catch (std::exception const&)
+    {
+        // Broken index is not used and rewritten on the next fill
+        cached.files.clear();
+    }
+    return cached;
+}
+
+void saveIndex(fs::path const& _dir, CachedIndex& _index)
+{
+    spDataObject index(new DataObject(DataType::Object));
+    for (auto const& [fileName, file] : _index.files)
+    {
+        spDataObject tests(new DataObject(DataType::Object));
+        for (auto const& record : file.second)
+        {
+            spDataObject test(new DataObject(DataType::Object));
+            // Offsets are kept as strings, DataObject integers are int and filled files may exceed 2GB
+            (*test)["begin"] = to_string(record.begin);
+            (*test)["end"] = to_string(record.end);
+            (*test)["sourceHash"] = record.sourceHash;
+            (*test)["generatedTestHash"] = record.generatedTestHash;
+            (*test)["filling-tool-version"] = record.fillingToolVersion;
+            (*tests).addSubObject(record.name, test);
+        }
+        spDataObject entry(new DataObject(DataType::Object));
+        (*entry)["id"] = file.first;
+        (*entry).addSubObject("tests", tests);
+        (*index).addSubObject(fileName, entry);
+    }
+    fs::path const indexFile = _dir / c_indexFileName;
+    writeFile(indexFile, asBytes(index->asJson()), true);
+    _index.fileId = test::fileIdentity(indexFile);
+    _index.updated = false;
+}
+
+// Skip a json string starting at _pos (the opening quote), return the position after the closing quote
+size_t skipString(string_view _json, size_t _pos)
+{
+    for (size_t i = _pos + 1; i < _json.size(); i++)
+    {
+        if (_json[i] == '\\')
+            i++;
+        else if (_json[i] == '"')
+            return i + 1;
+    }
+    throw std::runtime_error("FilledTestIndex: unterminated string");
+}
+
+size_t skipWs(string_view _json, size_t _pos)
+{
+    while (_pos < _json.size() && isspace((unsigned char)_json[_pos]))
+        _pos++;
+    return _pos;
+}
+
+// Skip a json value starting at _pos, return the position after it
+size_t skipValue(string_view _json, size_t _pos)
+{
+    size_t depth = 0;
+    for (size_t i = _pos; i < _json.size(); i++)
+    {
+        char const c = _json[i];
+        if (c == '"')
+        {
+            i = skipString(_json, i) - 1;
+            if (depth == 0)
+                return i + 1;
+        }
+        else if (c == '{' || c == '[')
+            depth++;
+        else if (c == '}' || c == ']')
+        {
+            if (depth == 0)
+                return i;
+            if (--depth == 0)
+                return i + 1;
+        }
+        else if (depth == 0 && (c == ',' || isspace((unsigned char)c)))
+            return i;
+    }
+    throw std::runtime_error("FilledTestIndex: unterminated value");
+}
+}  // namespace
+
+namespace test::testsuite
+{
+vector<tuple<string, size_t, size_t>> FilledTestIndex::scanTopLevelObject(string_view _json)
+{
+    vector<tuple<string, size_t, size_t>> members;
+    size_t pos = skipWs(_json, 0);
+    if (pos == _json.size() || _json[pos] != '{')
+        throw std::runtime_error("FilledTestIndex: json object expected");
+    pos = skipWs(_json, pos + 1);
+    while (pos < _json.size() && _json[pos] == '"')
+    {
+        size_t const keyEnd = skipString(_json, pos);
+        string key(_json.substr(pos + 1, keyEnd - pos - 2));
+        if (key.find('\\') != string::npos)
+            throw std::runtime_error("FilledTestIndex: escaped test name");
+        pos = skipWs(_json, keyEnd);
+        if (pos == _json.size() || _json[pos] != ':')
+            throw std::runtime_error("FilledTestIndex: `:` expected");
+        size_t const begin = skipWs(_json, pos + 1);
+        size_t const end = skipValue(_json, begin);
+        members.emplace_back(std::move(key), begin, end);
+        pos = skipWs(_json, end);
+        if (pos < _json.size() && _json[pos] == ',')
+            pos = skipWs(_json, pos + 1);
+    }
+    if (pos == _json.size() || _json[pos] != '}')
+        throw std::runtime_error("FilledTestIndex: `}` expected");
+    return members;
+}
+
+void FilledTestIndex::update(fs::path const& _file, DataObject const& _data, string const& _json)
+{
+    TestRecords records;
+    try
+    {
+        for (auto const& [name, begin, end] : scanTopLevelObject(_json))
+        {
+            TestRecord record;
+            record.name = name;
+            record.begin = begin;
+            record.end = end;
+            if (_data.count(name) && _data.atKey(name).count("_info"))
+            {
+                DataObject const& info = _data.atKey(name).atKey("_info");
+                if (info.count("sourceHash"))
+                    record.sourceHash = info.atKey("sourceHash").asString();
+                if (info.count("generatedTestHash"))
+                    record.generatedTestHash = info.atKey("generatedTestHash").asString();
+                if (info.count("filling-tool-version"))
+                    record.fillingToolVersion = info.atKey("filling-tool-version").asString();
+            }
+            records.emplace_back(std::move(record));
+        }
+    }
+    catch (std::exception const&)
+    {
+        // Tests that can't be indexed are read by parsing the file
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_indexMutex);
+    fs::path const dir = _file.parent_path();
+    CachedIndex& index = loadIndex(dir);
+    index.files[_file.filename().string()] = {fileIdentity(_file), std::move(records)};
+    index.updated = true;
+}
+
+void FilledTestIndex::save()
+{
+    std::lock_guard<std::mutex> lock(g_indexMutex);
+    for (auto& [dir, index] : g_indexCache)
+    {
+        if (!index.updated)
+            continue;
+        try
+        {
+            saveIndex(dir, index);
+        }
+        catch (std::exception const&)
+        {
+            // Without the index the tests are read by parsing the files
+            index.updated = false;
+        }
+    }
+}
+
+optional<FilledTestIndex::TestRecords> FilledTestIndex::read(fs::path const& _file)
+{
+    std::lock_guard<std::mutex> lock(g_indexMutex);
+    CachedIndex const& index = loadIndex(_file.parent_path());
+    auto const entry = index.files.find(_file.filename().string());
+    if (entry == index.files.end() || entry->second.first != fileIdentity(_file))
+        return nullopt;
+    return entry->second.second;
+}
+
+spDataObject FilledTestIndex::readTest(fs::path const& _file, string const& _name)
+{
+    auto const records = read(_file);
+    if (!records.has_value())
+        return spDataObject(0);
+    for (auto const& record : records.value())
+    {
+        if (record.name != _name)
+            continue;
+        try
+        {
+            MappedFile const file(_file);
+            if (record.end > file.size() || record.begin >= record.end)
+                return spDataObject(0);
+            string const json = "{\"" + _name + "\":" + string(file.view().substr(record.begin, record.end - record.begin)) + "}";
+            return ConvertJsoncppStringToData(json);
+        }
+        catch (std::exception const&)
+        {
+            return spDataObject(0);
+        }
+    }
+    return spDataObject(0);
+}
+
+}  // namespace test::testsuite
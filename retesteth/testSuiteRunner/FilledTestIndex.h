@@ -0,0 +1,43 @@
+#pragma once
+#include <libdataobj/DataObject.h>
+#include <boost/filesystem/path.hpp>
+#include <optional>
+#include <string_view>
+
+namespace test::testsuite
+{
+// Index of the filled tests of one directory, written next to them as `.retesteth-index` when filling
+// For every test file (checked by size, mtime, inode) it keeps the test names, the _info fields used
+// by the hash checks and the byte range of each test object, so a test can be read without the rest of the file
+class FilledTestIndex
+{
+public:
+    struct TestRecord
+    {
+        std::string name;
+        size_t begin = 0;  // byte range of the test object in the file
+        size_t end = 0;
+        std::string sourceHash;
+        std::string generatedTestHash;
+        std::string fillingToolVersion;
+    };
+    typedef std::vector<TestRecord> TestRecords;
+
+    // Index the filled tests _data that were just written into _file as _json
+    // The index is kept in memory until save(), so a directory index is written once and not per filled file
+    static void update(boost::filesystem::path const& _file, dataobject::DataObject const& _data, std::string const& _json);
+
+    // Write the index of every directory updated since the last save
+    static void save();
+
+    // Records of _file if it is indexed and did not change since, nullopt otherwise
+    static std::optional<TestRecords> read(boost::filesystem::path const& _file);
+
+    // Read only the test _name from _file using the index, empty if the index can't be used
+    static dataobject::spDataObject readTest(boost::filesystem::path const& _file, std::string const& _name);
+
+    // Byte ranges of the members of the top level json object: name, begin, end
+    static std::vector<std::tuple<std::string, size_t, size_t>> scanTopLevelObject(std::string_view _json);
+};
+
+}  // namespace test::testsuite
@@ -0,0 +1,271 @@
+#include "FillerHashIndex.h"
+#include "FilledTestIndex.h"
+#include "TestSuiteHelperFunctions.h"
+#include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/FileSystem.h>
+#include <libdevcore/SHA3.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <atomic>
+#include <thread>
+
+using namespace std;
+using namespace dev;
+using namespace dataobject;
+using namespace test::debug;
+namespace fs = boost::filesystem;
+
+namespace
+{
+string const c_indexFileName = "fillerHashIndex.json";
+
+fs::path indexPath()
+{
+    fs::path dataDir = test::Options::get().datadir;
+    if (dataDir.empty())
+        dataDir = dev::getDataDir("retesteth");
+    return dataDir / c_indexFileName;
+}
+
+string fillerId(fs::path const& _filler, bool _sorted)
+{
+    string const id = test::fileIdentity(_filler);
+    return id.empty() || !_sorted ? id : id + ":sorted";
+}
+
+// Keep only the fields of the filled test that checkFillerHash looks at
+spDataObject readFilledInfo(fs::path const& _filled)
+{
+    auto const records = test::testsuite::FilledTestIndex::read(_filled);
+    if (records.has_value())
+    {
+        spDataObject info(new DataObject(DataType::Object));
+        for (auto const& record : records.value())
+        {
+            spDataObject trimmedInfo(new DataObject(DataType::Object));
+            if (!record.sourceHash.empty())
+                (*trimmedInfo)["sourceHash"] = record.sourceHash;
+            if (!record.fillingToolVersion.empty())
+                (*trimmedInfo)["filling-tool-version"] = record.fillingToolVersion;
+            spDataObject trimmed(new DataObject(DataType::Object));
+            (*trimmed).addSubObject("_info", trimmedInfo);
+            (*info).addSubObject(record.name, trimmed);
+        }
+        return info;
+    }
+
+    string const src = dev::contentsString(_filled);
+    if (src.empty())
+        throw std::runtime_error("empty filled test");
+
+    spDataObject const data = ConvertJsoncppStringToData(src, {.stopper = "_info"});
+    spDataObject info(new DataObject(DataType::Object));
+    for (auto const& test : data->getSubObjects())
+    {
+        if (test->type() != DataType::Object)
+        {
+            (*info).addSubObject(test->copy());
+            continue;
+        }
+        spDataObject trimmed(new DataObject(DataType::Object));
+        if (test->count("_info"))
+        {
+            DataObject const& testInfo = test->atKey("_info");
+            spDataObject trimmedInfo(new DataObject(DataType::Object));
+            for (string const key : {"sourceHash", "filling-tool-version"})
+                if (testInfo.count(key))
+                    (*trimmedInfo).addSubObject(key, testInfo.atKey(key).copy());
+            (*trimmed).addSubObject("_info", trimmedInfo);
+        }
+        (*info).addSubObject(test->getKey(), trimmed);
+    }
+    return info;
+}
+
+// Run _task(i) for i in [0, _count) on all cores
+template <class T>
+void parallelFor(size_t _count, T const& _task)
+{
+    size_t const threads = min<size_t>(_count, max(1u, std::thread::hardware_concurrency()));
+    std::atomic<size_t> next = 0;
+    vector<std::thread> workers;
+    for (size_t i = 0; i < threads; i++)
+        workers.emplace_back([&next, _count, &_task]() {
+            for (size_t k = next++; k < _count; k = next++)
+                _task(k);
+        });
+    for (auto& worker : workers)
+        worker.join();
+}
+}  // namespace
+
+namespace test::testsuite
+{
+FillerHashIndex& FillerHashIndex::get()
+{
+    static FillerHashIndex instance(indexPath());
+    return instance;
+}
+
+void FillerHashIndex::prefetch(vector<pair<fs::path, fs::path>> const& _fillerAndFilled)
+{
+    // readFillerTestFile sorts legacy fillers on load, which changes the hash
+    bool const sorted = Options::isLegacy();
+    vector<pair<fs::path, string>> fillers;
+    vector<pair<fs::path, string>> filled;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_loaded)
+            load();
+
+        set<string> queued;
+        for (auto const& [filler, filledTest] : _fillerAndFilled)
+        {
+            string const fillerKey = filler.string();
+            string const fillerFileId = fillerId(filler, sorted);
+            if (!fillerFileId.empty() && !queued.count(fillerKey) &&
+                (!m_fillers.count(fillerKey) || m_fillers.at(fillerKey).fileId != fillerFileId))
+                fillers.emplace_back(filler, fillerFileId);
+            queued.emplace(fillerKey);
+
+            string const filledKey = filledTest.string();
+            string const filledFileId = test::fileIdentity(filledTest);
+            if (!filledFileId.empty() && !queued.count(filledKey) &&
+                (!m_filled.count(filledKey) || m_filled.at(filledKey).fileId != filledFileId))
+                filled.emplace_back(filledTest, filledFileId);
+            queued.emplace(filledKey);
+        }
+    }
+    if (fillers.empty() && filled.empty())
+        return;
+
+    ETH_DC_MESSAGE(DC::STATS, "Calculate filler hashes: " + test::fto_string(fillers.size()) + " fillers, " +
+                                  test::fto_string(filled.size()) + " filled tests");
+    vector<optional<h256>> hashes(fillers.size());
+    vector<spDataObject> infos(filled.size(), spDataObject(0));
+    parallelFor(fillers.size() + filled.size(), [&](size_t _i) {
+        try
+        {
+            if (_i < fillers.size())
+                hashes.at(_i) = fillerSourceHash(parseFillerFile(fillers.at(_i).first, sorted));
+            else
+                infos.at(_i - fillers.size()) = readFilledInfo(filled.at(_i - fillers.size()).first);
+        }
+        catch (std::exception const&)
+        {
+            // Not indexed, the error is reported when checkFillerHash reads the file
+        }
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < fillers.size(); i++)
+    {
+        if (hashes.at(i).has_value())
+            m_fillers[fillers.at(i).first.string()] = Entry{fillers.at(i).second, hashes.at(i).value(), spDataObject()};
+        else
+            m_fillers.erase(fillers.at(i).first.string());
+    }
+    for (size_t i = 0; i < filled.size(); i++)
+    {
+        if (!infos.at(i).isEmpty())
+            m_filled[filled.at(i).first.string()] = Entry{filled.at(i).second, h256(), infos.at(i)};
+        else
+            m_filled.erase(filled.at(i).first.string());
+    }
+    m_updated = true;
+}
+
+optional<h256> FillerHashIndex::fillerHash(fs::path const& _filler, bool _sorted) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const entry = m_fillers.find(_filler.string());
+    if (entry == m_fillers.end() || entry->second.fileId != fillerId(_filler, _sorted))
+        return nullopt;
+    return entry->second.hash;
+}
+
+spDataObject FillerHashIndex::filledInfo(fs::path const& _filled) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const entry = m_filled.find(_filled.string());
+    if (entry == m_filled.end() || entry->second.fileId != test::fileIdentity(_filled))
+        return spDataObject(0);
+    return entry->second.info;
+}
+
+void FillerHashIndex::load()
+{
+    m_loaded = true;
+    fs::path const& path = m_indexPath;
+    if (!fs::exists(path))
+        return;
+    try
+    {
+        spDataObject const index = ConvertJsoncppStringToData(dev::contentsString(path));
+        if (index->count("fillers"))
+        {
+            for (auto const& el : index->atKey("fillers").getSubObjects())
+                m_fillers[el->getKey()] = Entry{el->atKey("id").asString(), h256(el->atKey("hash").asString()), spDataObject()};
+        }
+        if (index->count("filled"))
+        {
+            for (auto const& el : index->atKey("filled").getSubObjects())
+                m_filled[el->getKey()] = Entry{el->atKey("id").asString(), h256(), el->atKey("info").copy()};
+        }
+    }
+    catch (std::exception const& _ex)
+    {
+        // Broken index is rebuilt
+        ETH_DC_MESSAGE(DC::WARNING, "Ignoring filler hash index `" + path.string() + "`: " + _ex.what());
+        m_fillers.clear();
+        m_filled.clear();
+    }
+}
+
+void FillerHashIndex::save()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_updated)
+        return;
+    m_updated = false;
+
+    // Tests that were removed or renamed since they were indexed
+    std::erase_if(m_fillers, [](auto const& _el) { return !fs::exists(_el.first); });
+    std::erase_if(m_filled, [](auto const& _el) { return !fs::exists(_el.first); });
+
+    spDataObject index(new DataObject(DataType::Object));
+    spDataObject fillers(new DataObject(DataType::Object));
+    for (auto const& [path, entry] : m_fillers)
+    {
+        spDataObject el(new DataObject(DataType::Object));
+        (*el)["id"] = entry.fileId;
+        (*el)["hash"] = toHexPrefixed(entry.hash);
+        (*fillers).addSubObject(path, el);
+    }
+    spDataObject filled(new DataObject(DataType::Object));
+    for (auto const& [path, entry] : m_filled)
+    {
+        spDataObject el(new DataObject(DataType::Object));
+        (*el)["id"] = entry.fileId;
+        (*el).addSubObject("info", entry.info->copy());
+        (*filled).addSubObject(path, el);
+    }
+    (*index).addSubObject("fillers", fillers);
+    (*index).addSubObject("filled", filled);
+
+    fs::path const& path = m_indexPath;
+    try
+    {
+        if (!fs::exists(path.parent_path()))
+            fs::create_directories(path.parent_path());
+        writeFile(path, asBytes(index->asJson(0, false)), true);
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_DC_MESSAGE(DC::WARNING, "Can't save filler hash index `" + path.string() + "`: " + _ex.what());
+    }
+}
+
+}  // namespace test::testsuite
@@ -0,0 +1,52 @@
+#pragma once
+#include <libdataobj/DataObject.h>
+#include <libdevcore/FixedHash.h>
+#include <boost/filesystem/path.hpp>
+#include <map>
+#include <mutex>
+#include <optional>
+
+namespace test::testsuite
+{
+// Filler hashes and the _info sections of filled tests, computed in parallel before the hash check
+// Results are stored in <datadir>/fillerHashIndex.json keyed by (path, size, mtime, inode) of the file,
+// so unchanged test trees are verified without parsing the fillers again
+class FillerHashIndex
+{
+public:
+    static FillerHashIndex& get();
+    // Index stored in _indexPath, get() uses <datadir>/fillerHashIndex.json
+    explicit FillerHashIndex(boost::filesystem::path const& _indexPath) : m_indexPath(_indexPath) {}
+
+    // Compute whatever is not in the index for the pairs (filler, filled test)
+    // Files that fail to parse are left out, checkFillerHash reads them and reports the error
+    void prefetch(std::vector<std::pair<boost::filesystem::path, boost::filesystem::path>> const& _fillerAndFilled);
+
+    // Write the index if prefetch added to it, called once at the end of the run
+    // Entries of the files that no longer exist are dropped here
+    void save();
+
+    // Hash of the filler source if the file did not change since it was indexed
+    std::optional<dev::h256> fillerHash(boost::filesystem::path const& _filler, bool _sorted) const;
+
+    // Tests of the filled file with only the _info fields checkFillerHash needs, empty if not indexed
+    dataobject::spDataObject filledInfo(boost::filesystem::path const& _filled) const;
+
+private:
+    struct Entry
+    {
+        std::string fileId;
+        dev::h256 hash;
+        dataobject::spDataObject info;
+    };
+    void load();
+
+    boost::filesystem::path const m_indexPath;
+    bool m_loaded = false;
+    bool m_updated = false;
+    std::map<std::string, Entry> m_fillers;
+    std::map<std::string, Entry> m_filled;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace test::testsuite
@@ -19,6 +19,7 @@
  */
 
 #include "TestSuiteHelperFunctions.h"
+#include "FilledTestIndex.h"
 #include <libdevcore/CommonIO.h>
 #include <retesteth/EthChecks.h>
 #include <retesteth/ExitHandler.h>
@@ -115,6 +116,7 @@ void TestSuite::runAllTestsInFolder(string const& _testFolder) const
             ThreadManager::addTask(job);
         }
         ThreadManager::joinThreads();
+        testsuite::FilledTestIndex::save();
         testOutput.finishTest();
     };
     runFunctionForAllClients(thisPart);
@@ -123,7 +125,23 @@ void TestSuite::runAllTestsInFolder(string const& _testFolder) const
 
 void TestSuite::runFunctionForAllClients(std::function<void()> _func)
 {
-    for (auto const& config : Options::getDynamicOptions().getClientConfigs())
+    auto& dynOpt = Options::getDynamicOptions();
+    if (Options::get().concurrentClients && dynOpt.getClientConfigs().size() > 1)
+    {
+        // setCurrentConfig prepares the config, all of them are set before any client thread starts
+        // The client threads read their config from the task scope only
+        Options::DynamicOptions::CurrentConfigScope restoreCurrentConfig;
+        for (auto const& config : dynOpt.getClientConfigs())
+        {
+            dynOpt.setCurrentConfig(config);
+            ETH_DC_MESSAGE(
+                DC::STATS, "Running tests for config '" + config.cfgFile().name() + "' " + test::fto_string(config.getId().id()));
+        }
+        runFunctionForClientsConcurrently(dynOpt.getClientConfigs(), _func);
+        return;
+    }
+
+    for (auto const& config : dynOpt.getClientConfigs())
     {
         Options::getDynamicOptions().setCurrentConfig(config);
         ETH_DC_MESSAGE(
@@ -138,6 +156,39 @@ void TestSuite::runFunctionForAllClients(std::function<void()> _func)
     }
 }
 
+void TestSuite::runFunctionForClientsConcurrently(std::vector<ClientConfig> const& _configs, std::function<void()> const& _func)
+{
+    // Each client config runs the tests on its own thread with its own sessions and -j jobs
+    std::vector<thread> clientThreads;
+    std::vector<std::exception_ptr> clientErrors(_configs.size());
+    for (size_t i = 0; i < _configs.size(); i++)
+    {
+        clientThreads.emplace_back([&_func, &config = _configs.at(i), &error = clientErrors.at(i)]() {
+            Options::DynamicOptions::TaskConfigScope scope(config);
+            try
+            {
+                _func();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        });
+    }
+    for (auto& th : clientThreads)
+        th.join();
+
+    // Disconnect threads from the clients and stop every client with its own stop script
+    for (auto const& config : _configs)
+    {
+        Options::DynamicOptions::TaskConfigScope scope(config);
+        RPCSession::clear(true);
+    }
+    for (auto const& error : clientErrors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
 void TestSuite::executeTest(string const& _testFolder, fs::path const& _fillerTestFilePath) const
 {
     try
@@ -265,7 +316,15 @@ void TestSuite::executeFile(boost::filesystem::path const& _file) const
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json structure " + _file.filename().string());
     TestOutputHelper::get().setCurrentTestInfo(
         TestInfo("Read json structure: "  + _file.filename().string()));
-    spDataObject res = test::readJsonData(_file);
+    spDataObject res(0);
+    auto const& singletest = Options::get().singletest;
+    if (selectsTestsByName() && !singletest.subname.empty() && !TestOutputHelper::get().getPythonTestFlag())
+    {
+        // Read only the selected test when the filled test index is up to date
+        res = testsuite::FilledTestIndex::readTest(_file, singletest.subname);
+    }
+    if (res.isEmpty())
+        res = test::readJsonData(_file);
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json finish");
     doTests(res, opt);
 }
@@ -20,6 +20,7 @@
 
 #pragma once
 #include <libdataobj/DataObject.h>
+#include <retesteth/configs/ClientConfig.h>
 #include <retesteth/testSuiteRunner/TestSuiteHelperFunctions.h>
 #include <boost/filesystem/path.hpp>
 #include <functional>
@@ -34,6 +35,8 @@ class TestSuite
 {
 protected:
     virtual bool legacyTestSuiteFlag() const { return false; }
+    // Tests in a file are selected by name with --singletest <file>/<test>
+    virtual bool selectsTestsByName() const { return false; }
 
 private:
     // Execute Test.json file
@@ -117,6 +120,10 @@ public:
     //
     static void runFunctionForAllClients(std::function<void()> _func);
 
+    // Run _func for all _configs at the same time, each on its own thread under the config's TaskConfigScope
+    // Close the sessions of every config when all of them have finished and rethrow the first failure
+    static void runFunctionForClientsConcurrently(std::vector<ClientConfig> const& _configs, std::function<void()> const& _func);
+
 protected:
     // A folder of the test suite. like "VMTests". should be implemented for each test suite.
     virtual TestPath suiteFolder() const = 0;
@@ -26,17 +26,14 @@ TestFileData readFillerTestFile(fs::path const& _testFileName)
     // Adds around 1% to execution time
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json structure " + string(_testFileName.filename().c_str()));
     TestFileData testData;
-    if (_testFileName.extension() == ".json")
+    try
     {
-        CJOptions opt { .jsonParse = CJOptions::JsonParse::ALLOW_COMMENTS, .autosort = bSortOnLoad,};
-        testData.data = test::readJsonData(_testFileName, opt);
+        testData.data = parseFillerFile(_testFileName, bSortOnLoad);
+    }
+    catch (std::exception const& _ex)
+    {
+        ETH_ERROR_MESSAGE(string("\nError when parsing file (") + _testFileName.c_str() + ") " + _ex.what());
     }
-    else if (_testFileName.extension() == ".yml")
-        testData.data = test::readYamlData(_testFileName, bSortOnLoad);
-    else if (_testFileName.extension() == ".py")
-        testData.data = spDataObject(new DataObject(dev::contentsString(_testFileName)));
-    else
-        ETH_ERROR_MESSAGE("Unknown test format! \n" + _testFileName.string());
     ETH_DC_MESSAGE(DC::TESTLOG, "Read json structure finish");
 
     // Do not calculate the hash on Legacy tests unless --checkhash option provided
@@ -52,9 +49,9 @@ TestFileData readFillerTestFile(fs::path const& _testFileName)
         return testData;
     }
 
-    string const srcString = testData.data->asJson(0, false);
     if (test::Options::get().showhash)
     {
+        string const srcString = testData.data->asJson(0, false);
         std::string output = "Not a Json object!";
 #ifdef JSONCPP
         if (_testFileName.extension() == ".json")
@@ -71,11 +68,31 @@ TestFileData readFillerTestFile(fs::path const& _testFileName)
         std::cerr << "JSON: '" << std::endl << output << "'" << std::endl;
         std::cerr << "DATA: '" << std::endl << srcString << "'" << std::endl;
     }
-    testData.hash = sha3(srcString);
+    testData.hash = fillerSourceHash(testData.data);
     testData.hashCalculated = true;
     return testData;
 }
 
+spDataObject parseFillerFile(fs::path const& _filler, bool _sorted)
+{
+    if (_filler.extension() != ".json" && _filler.extension() != ".yml" && _filler.extension() != ".py")
+        throw UpwardsException("Unknown test format! \n" + _filler.string());
+
+    dev::MappedFile const file(_filler);
+    if (_filler.extension() == ".py")
+        return spDataObject(new DataObject(string(file.view())));
+    if (file.size() == 0)
+        throw UpwardsException("Contents of " + _filler.string() + " is empty. Trying to parse empty file. (forgot --filltests?)");
+    if (_filler.extension() == ".json")
+        return ConvertJsoncppStringToData(file.view(), {.jsonParse = CJOptions::JsonParse::ALLOW_COMMENTS, .autosort = _sorted});
+    return ConvertYamlStringToData(file.view(), _sorted);
+}
+
+dev::h256 fillerSourceHash(DataObject const& _filler)
+{
+    return sha3(_filler.asJson(0, false));
+}
+
 void removeComments(spDataObject& _obj)
 {
     if (_obj->type() == DataType::Object)
@@ -18,6 +18,11 @@ bool addClientInfoIfUpdate(DataObject& _filledTest, boost::filesystem::path cons
     boost::filesystem::path const& _existingFilledTest);
 
 TestFileData readFillerTestFile(boost::filesystem::path const& _testFileName);
+
+// Filler parsed the way its source hash is calculated, throws on an empty file, unknown format or a parse error
+// Does not report to the test output, so it can run off the main thread
+spDataObject parseFillerFile(boost::filesystem::path const& _filler, bool _sorted);
+dev::h256 fillerSourceHash(DataObject const& _filler);
 void removeComments(spDataObject& _obj);
 bool checkFillerHash(boost::filesystem::path const& _compiledTest, boost::filesystem::path const& _sourceTest);
 
@@ -1,4 +1,5 @@
 #include "TestSuiteHelperFunctions.h"
+#include "FilledTestIndex.h"
 #include <libdevcore/CommonIO.h>
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
@@ -47,6 +48,27 @@ bool checkIfThereAreUpdatesToTheTest(spDataObject _oldFilledTestFile, spDataObje
     return false;
 }
 
+// Hashes of the existing filled tests, from the filled test index when it is up to date
+spDataObject readOldFilledTestHashes(fs::path const& _existingFilledTest)
+{
+    auto const records = test::testsuite::FilledTestIndex::read(_existingFilledTest);
+    if (!records.has_value())
+        return test::readJsonData(_existingFilledTest);
+
+    spDataObject hashes(new DataObject(DataType::Object));
+    for (auto const& record : records.value())
+    {
+        spDataObject info(new DataObject(DataType::Object));
+        if (!record.generatedTestHash.empty())
+            (*info)["generatedTestHash"] = record.generatedTestHash;
+        (*info)["sourceHash"] = record.sourceHash;
+        spDataObject test(new DataObject(DataType::Object));
+        (*test).addSubObject("_info", info);
+        (*hashes).addSubObject(record.name, test);
+    }
+    return hashes;
+}
+
 }  // namespace
 
 
@@ -59,7 +81,7 @@ bool addClientInfoIfUpdate(DataObject& _newFilledTestData, fs::path const& _test
 
     spDataObject oldFilledTestFile;
     if (Options::get().filltests && fs::exists(_existingFilledTest) && !Options::get().forceupdate)
-        oldFilledTestFile = test::readJsonData(_existingFilledTest);
+        oldFilledTestFile = readOldFilledTestHashes(_existingFilledTest);
 
     session::SessionInterface& session = session::RPCSession::instance(TestOutputHelper::getThreadID());
     for (spDataObject& newFilledTest : _newFilledTestData.getSubObjectsUnsafe())
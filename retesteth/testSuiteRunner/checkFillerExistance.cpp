@@ -3,6 +3,7 @@
 #include <retesteth/helpers/TestHelper.h>
 #include "TestSuite.h"
 #include "TestSuiteHelperFunctions.h"
+#include "FillerHashIndex.h"
 #include <retesteth/helpers/TestOutputHelper.h>
 
 #include <libdevcore/CommonIO.h>
@@ -50,6 +51,19 @@ void checkGeneratedTest(fs::path const& _filledPath, std::vector<fs::path> const
     std::vector<fs::path>& _verifiedGeneratedTests)
 {
     auto const& opt = Options::get();
+    if (!(opt.filltests && !opt.filloutdated) && !opt.showhash)
+    {
+        // Parse fillers and filled tests on all cores before the checks below
+        vector<pair<fs::path, fs::path>> hashChecks;
+        for (auto const& filler : _fillers)
+        {
+            TestOutputHelper::get().setCurrentTestInfo(TestInfo("CheckFiller", filler.stem().string()));
+            for (auto const& testName : getGeneratedTestNames(filler))
+                hashChecks.emplace_back(filler, _filledPath / (testName + ".json"));
+        }
+        FillerHashIndex::get().prefetch(hashChecks);
+    }
+
     string message = "Tests are not generated (forgot --filltests?): ";
     for (auto const& filler : _fillers)
     {
@@ -2,6 +2,7 @@
 #include "Options.h"
 #include <retesteth/helpers/TestHelper.h>
 #include "TestSuiteHelperFunctions.h"
+#include "FillerHashIndex.h"
 //#include <libdevcore/CommonIO.h>
 
 using namespace std;
@@ -44,14 +45,25 @@ bool checkFillerHash(fs::path const& _compiledTest, fs::path const& _sourceTest)
     bool isTestOutdated = false;
     ETH_DC_MESSAGE(DC::TESTLOG, string("Check `") + _compiledTest.c_str() + "` hash");
     ETH_DC_MESSAGE(DC::TESTLOG, string("SrcFile `") + _sourceTest.c_str() + "`");
-    TestFileData fillerData = readFillerTestFile(_sourceTest);
+
+    // Use the results of the parallel pre-pass when the files did not change
+    TestFileData fillerData;
+    auto const indexedHash = FillerHashIndex::get().fillerHash(_sourceTest, Options::isLegacy());
+    if (indexedHash.has_value() && !Options::get().showhash)
+        fillerData.hash = indexedHash.value();
+    else
+        fillerData = readFillerTestFile(_sourceTest);
 
     // If no hash calculated, skip the hash check
     if (!fillerData.hashCalculated)
         return isTestOutdated;
 
-    CJOptions opt { .stopper = "_info" };
-    spDataObject compiledTestFileData = test::readJsonData(_compiledTest, opt);
+    spDataObject compiledTestFileData = FillerHashIndex::get().filledInfo(_compiledTest);
+    if (compiledTestFileData.isEmpty())
+    {
+        CJOptions opt { .stopper = "_info" };
+        compiledTestFileData = test::readJsonData(_compiledTest, opt);
+    }
     for (auto const& test : compiledTestFileData->getSubObjects())
     {
         DataObject const& testRef = test.getCContent();
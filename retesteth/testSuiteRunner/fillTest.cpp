@@ -1,6 +1,7 @@
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include "TestSuiteHelperFunctions.h"
+#include "FilledTestIndex.h"
 #include "testSuiteRunner/TestSuite.h"
 #include <Options.h>
 #include <libdevcore/CommonIO.h>
@@ -61,8 +62,12 @@ void updatePythonTestInfo(TestFileData& _testData, fs::path const& _pythonFiller
         if (update)
         {
             (*output).performModifier(mod_sortKeys, DataObject::ModifierOption::NONRECURSIVE);
-            writeFile(outputTestFilePath, asBytes(output->asJson()));
+            string const json = output->asJson();
+            writeFile(outputTestFilePath, asBytes(json));
+            FilledTestIndex::update(outputTestFilePath, output.getCContent(), json);
         }
+        else
+            FilledTestIndex::update(outputTestFilePath, output.getCContent(), res);
     }
 }
 
@@ -158,7 +163,9 @@ void TestSuite::_fillCopier(
     ETH_DC_MESSAGE(DC::TESTLOG, " TO " + _outputTestFilePath.path().string());
     assert(_fillerTestFilePath.string() != _outputTestFilePath.path().string());
     addClientInfoIfUpdate(_testData.data.getContent(), _fillerTestFilePath, _testData.hash, _outputTestFilePath.path());
-    writeFile(_outputTestFilePath.path(), asBytes(_testData.data->asJson()));
+    string const json = _testData.data->asJson();
+    writeFile(_outputTestFilePath.path(), asBytes(json));
+    FilledTestIndex::update(_outputTestFilePath.path(), _testData.data.getCContent(), json);
     ETH_FAIL_REQUIRE_MESSAGE(
         boost::filesystem::exists(_outputTestFilePath.path().string()), "Error when copying the test file!");
 }
@@ -178,7 +185,9 @@ bool TestSuite::_fillJsonYml(TestFileData& _testData, fs::path const& _fillerTes
             if (update)
             {
                 (*output).performModifier(mod_sortKeys, DataObject::ModifierOption::NONRECURSIVE);
-                writeFile(_outputTestFilePath.path(), asBytes(output->asJson()));
+                string const json = output->asJson();
+                writeFile(_outputTestFilePath.path(), asBytes(json));
+                FilledTestIndex::update(_outputTestFilePath.path(), output.getCContent(), json);
             }
         }
         wereErrors = false;
@@ -250,35 +250,50 @@ void modifyTransactionChainIDByNetwork(test::Transaction const& _tr, FORK const&
 spDataObject storageDiff(Storage const& _pre, Storage const& _post)
 {
     spDataObject res;
-    for (auto const& _postKey : _post.getKeys())
+    for (auto const& record : _pre.diff(_post))
     {
-        auto const& postKey = std::get<0>(_postKey.second);
-        auto const& postValue = std::get<1>(_postKey.second);
-        if (_pre.hasKey(postKey))
+        if (record.lhs == nullptr)
         {
-            // old key changed
-            auto const& preAtPostKey = _pre.atKey(postKey);
-            if (preAtPostKey != postValue)
-            {
-                auto const msg = preAtPostKey.asString() + " -> " + postValue->asString() + " (" +
-                                 preAtPostKey.asDecString() + " -> " + postValue->asDecString() + ")";
-                (*res)[postKey->asString()] = msg;
-            }
+            // new key appeared
+            VALUE const& postValue = record.rhs->value;
+            auto const msg = "0x -> " + postValue.asString() + " (" + "0x -> " + postValue.asDecString() + ")";
+            (*res)[record.rhs->keyString()] = msg;
+        }
+        else if (record.rhs == nullptr)
+        {
+            // old key removed
+            (*res)["DELETED: " + record.lhs->keyString()] = record.lhs->value->asString();
         }
         else
         {
-            // new key appeared
-            auto const msg = "0x -> " + postValue->asString() + " (" + "0x -> " + postValue->asDecString() + ")";
-            (*res)[postKey->asString()] = msg;
+            // old key changed
+            VALUE const& preValue = record.lhs->value;
+            VALUE const& postValue = record.rhs->value;
+            auto const msg = preValue.asString() + " -> " + postValue.asString() + " (" +
+                             preValue.asDecString() + " -> " + postValue.asDecString() + ")";
+            (*res)[record.rhs->keyString()] = msg;
         }
     }
-    for (auto const& _preKey : _pre.getKeys())
+    return res;
+}
+
+std::vector<StateDiffRecord> diffStates(State const& _pre, State const& _post)
+{
+    std::vector<StateDiffRecord> res;
+    auto pre = _pre.accounts().begin();
+    auto post = _post.accounts().begin();
+    while (pre != _pre.accounts().end() || post != _post.accounts().end())
     {
-        auto const& preKey = std::get<0>(_preKey.second);
-        if (!_post.hasKey(preKey))
+        if (post == _post.accounts().end() || (pre != _pre.accounts().end() && pre->first < post->first))
+            res.push_back({&pre++->second.getCContent(), nullptr});
+        else if (pre == _pre.accounts().end() || post->first < pre->first)
+            res.push_back({nullptr, &post++->second.getCContent()});
+        else
         {
-            // old key removed
-            (*res)["DELETED: " + preKey->asString()] = std::get<1>(_preKey.second)->asString();
+            if (pre->second->digest() != post->second->digest())
+                res.push_back({&pre->second.getCContent(), &post->second.getCContent()});
+            pre++;
+            post++;
         }
     }
     return res;
@@ -287,46 +302,54 @@ spDataObject storageDiff(Storage const& _pre, Storage const& _post)
 spDataObject stateDiff(State const& _pre, State const& _post)
 {
     spDataObject res(new DataObject(DataType::Object));
-    for (auto const& postAcc : _post.accounts())
+    auto const records = diffStates(_pre, _post);
+    for (auto const& record : records)
     {
-        if (_pre.hasAccount(postAcc.first))
+        if (record.post == nullptr)
+            continue;
+
+        AccountBase const& accPost = *record.post;
+        if (record.pre != nullptr)
         {
             // check for updates
-            auto const& accPre = _pre.getAccount(postAcc.first);
-            auto const& accPost = postAcc.second;
+            AccountBase const& accPre = *record.pre;
+            string const address = accPost.address().asString();
 
             auto const& preBalance = accPre.balance();
-            auto const& postBalance = accPost->balance();
+            auto const& postBalance = accPost.balance();
             if (preBalance != postBalance)
             {
                 auto const msg = preBalance.asString() + " -> " + postBalance.asString() + " (" +
                                  preBalance.asDecString() + " -> " + postBalance.asDecString() + ")";
-                (*res)[postAcc.first.asString()][c_balance] = msg;
+                (*res)[address][c_balance] = msg;
             }
 
             auto const& preNonce = accPre.nonce();
-            auto const& postNonce = accPost->nonce();
+            auto const& postNonce = accPost.nonce();
             if (preNonce != postNonce)
             {
                 auto const msg = preNonce.asString() + " -> " + postNonce.asString() + " (" +
                                  preNonce.asDecString() + " -> " + postNonce.asDecString() + ")";
-                (*res)[postAcc.first.asString()][c_nonce] = msg;
+                (*res)[address][c_nonce] = msg;
             }
 
             auto const& preCode = accPre.code();
-            auto const& postCode = accPost->code();
+            auto const& postCode = accPost.code();
             if (preCode != postCode)
-                (*res)[postAcc.first.asString()][c_code] = preCode.asString() + " -> " + postCode.asString();
+                (*res)[address][c_code] = preCode.asString() + " -> " + postCode.asString();
 
-            auto const storageDiffRes = storageDiff(accPre.storage(), accPost->storage());
-            if (storageDiffRes->getSubObjects().size())
-                (*res)[postAcc.first.asString()].atKeyPointer(c_storage) = storageDiffRes;
+            if (accPre.storage().digest() != accPost.storage().digest())
+            {
+                auto const storageDiffRes = storageDiff(accPre.storage(), accPost.storage());
+                if (storageDiffRes->getSubObjects().size())
+                    (*res)[address].atKeyPointer(c_storage) = storageDiffRes;
+            }
         }
         else
         {
             // this is new account
-            string const key = "NEW: " + postAcc.first.asString();
-            (*res).atKeyPointer(key) = postAcc.second->asDataObject()->copy();
+            string const key = "NEW: " + accPost.address().asString();
+            (*res).atKeyPointer(key) = accPost.asDataObject()->copy();
 
             // Print dec values
             VALUE balance((*res).atKey(key).atKey(c_balance));
@@ -340,12 +363,12 @@ spDataObject stateDiff(State const& _pre, State const& _post)
             }
         }
     }
-    for (auto const& preAcc : _pre.accounts())
+    for (auto const& record : records)
     {
-        if (!_post.hasAccount(preAcc.first))
+        if (record.post == nullptr)
         {
             // this is deleted account
-            spDataObject deleted(new DataObject(string("DELETED: ") + preAcc.first.asString()));
+            spDataObject deleted(new DataObject(string("DELETED: ") + record.pre->address().asString()));
             (*res).addSubObject(deleted);
         }
     }
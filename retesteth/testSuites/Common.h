@@ -67,6 +67,16 @@ void compareStates(StateBase const& _stateExpect, test::session::SessionInterfac
 // Compare expected StateIncomplete against post state State
 void compareStates(StateBase const& _stateExpect, State const& _statePost);
 
+// Account that differs between two states, the missing side is nullptr
+struct StateDiffRecord
+{
+    AccountBase const* pre;
+    AccountBase const* post;
+};
+
+// Walk both states in address order once, accounts with equal digests are skipped
+std::vector<StateDiffRecord> diffStates(State const& _pre, State const& _post);
+
 // make State diff
 spDataObject stateDiff(State const& _pre, State const& _post);
 
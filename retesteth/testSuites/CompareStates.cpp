@@ -10,32 +10,11 @@ namespace test
 
 CompareResult compareAccounts(AccountBase const& _expectAccount, State::Account const& _remoteAccount);
 
-State::Account remoteGetAccount(SessionInterface& _session, VALUE const& _bNumber, VALUE const& _trIndex, FH20 const& _account)
+namespace
 {
-    // TODO make sp here. do not copy returned data
-    // Read the returned memory and put it in the account
-    spVALUE balance = _session.eth_getBalance(_account, _bNumber);
-    spVALUE nonce = _session.eth_getTransactionCount(_account, _bNumber);
-    spBYTES code = _session.eth_getCode(_account, _bNumber);
-
-    bool hasStorage = true;
-    FH32 beginHash = FH32::zero();
-    spStorage tmpStorage = spStorage(new Storage(DataObject(DataType::Object)));
-    size_t safety = 500;
-    while (hasStorage && --safety)
-    {
-        // Read storage from remote account by 20 records at a time
-        DebugStorageRangeAt res(_session.debug_storageRangeAt(_bNumber, _trIndex, _account, beginHash, 20));
-        if (res.nextKey().isZero())
-            hasStorage = false;
-        else
-            beginHash = res.nextKey();
-        (*tmpStorage).merge(res.storage());
-    }
-    if (safety == 0)
-        ETH_ERROR_MESSAGE("remoteGetAccount::DebugStorageRangeAt seems like an endless loop!");
-    return State::Account(_account, balance, nonce, code, tmpStorage);
-}
+// Remote accounts are requested by chunks, the client might batch the requests of one chunk
+size_t const c_remoteAccountsChunk = 16;
+}  // namespace
 
 // Get full remote state from the client
 spState getRemoteState(SessionInterface& _session)
@@ -59,22 +38,23 @@ spState getRemoteState(SessionInterface& _session)
         nextKey = range.nextKey();
     }
 
-    // Use recentBNumber and trIndex once to request account information in loop
-    auto getRemoteAccount = [&_session, &recentBNumber, &trIndex](
-                                FH20 const& _account) { return remoteGetAccount(_session, recentBNumber, trIndex, _account); };
-
     size_t byteSize = 0;
     std::map<FH20, spAccountBase> stateAccountMap;
-    for (auto const& acc : accountList)
+    for (size_t begin = 0; begin < accountList.size(); begin += c_remoteAccountsChunk)
     {
-        spAccountBase remAccount(new State::Account(getRemoteAccount(acc)));
-        stateAccountMap.emplace(acc, remAccount);
-        if (!Options::get().fullstate)
+        std::vector<FH20> const chunk(accountList.begin() + begin,
+            accountList.begin() + std::min(begin + c_remoteAccountsChunk, accountList.size()));
+        for (auto& account : _session.getRemoteAccounts(chunk, recentBNumber, trIndex))
         {
-            byteSize += remAccount->storage().getKeys().size() * 64;
-            byteSize += remAccount->code().asString().size() / 2;
-            if (byteSize > 1048510) // 1MB
-                throw StateTooBig();
+            spAccountBase remAccount(new State::Account(std::move(account)));
+            stateAccountMap.emplace(remAccount->address(), remAccount);
+            if (!Options::get().fullstate)
+            {
+                byteSize += remAccount->storage().size() * 64;
+                byteSize += remAccount->code().asString().size() / 2;
+                if (byteSize > 1048510) // 1MB
+                    throw StateTooBig();
+            }
         }
     }
     return spState(new State(stateAccountMap));
@@ -89,10 +69,6 @@ void compareStates(StateBase const& _stateExpect, SessionInterface& _session)
     EthGetBlockBy recentBlock(_session.eth_getBlockByNumber(recentBNumber, Request::LESSOBJECTS));
     VALUE trIndex(recentBlock.transactions().size());
 
-    // Use recentBNumber and trIndex once to request account information in loop
-    auto getRemoteAccount = [&_session, &recentBNumber, &trIndex](
-                                FH20 const& _account) { return remoteGetAccount(_session, recentBNumber, trIndex, _account); };
-
     // Construct accountList by asking packs of 10th of accounts from remote client
     std::set<FH20> remoteAccountList;
     FH32 nextKey("0x0000000000000000000000000000000000000000000000000000000000000001");
@@ -104,6 +80,7 @@ void compareStates(StateBase const& _stateExpect, SessionInterface& _session)
         nextKey = range.nextKey();
     }
 
+    std::vector<AccountBase const*> accountsToCompare;
     for (auto const& ael : _stateExpect.accounts())
     {
         AccountBase const& a = ael.second.getCContent();
@@ -122,11 +99,24 @@ void compareStates(StateBase const& _stateExpect, SessionInterface& _session)
         }
         else if (a.shouldNotExist() && !remoteHasAccount)
             continue;
+        accountsToCompare.emplace_back(&a);
+    }
 
-        // Compare account in postState with expect section account
-        CompareResult accountCompareResult = compareAccounts(a, getRemoteAccount(a.address()));
-        if (accountCompareResult != CompareResult::Success)
-            result = accountCompareResult;
+    // Compare accounts in postState with expect section accounts
+    for (size_t begin = 0; begin < accountsToCompare.size(); begin += c_remoteAccountsChunk)
+    {
+        size_t const end = std::min(begin + c_remoteAccountsChunk, accountsToCompare.size());
+        std::vector<FH20> chunk;
+        for (size_t i = begin; i < end; i++)
+            chunk.emplace_back(accountsToCompare.at(i)->address());
+
+        std::vector<State::Account> const remoteAccounts = _session.getRemoteAccounts(chunk, recentBNumber, trIndex);
+        for (size_t i = begin; i < end; i++)
+        {
+            CompareResult accountCompareResult = compareAccounts(*accountsToCompare.at(i), remoteAccounts.at(i - begin));
+            if (accountCompareResult != CompareResult::Success)
+                result = accountCompareResult;
+        }
     }
 
     if (result != CompareResult::Success)
@@ -136,72 +126,66 @@ void compareStates(StateBase const& _stateExpect, SessionInterface& _session)
 // Compare one storage against another
 CompareResult compareStorage(Storage const& _expectStorage, Storage const& _remoteStorage, FH20 const& _remoteAccount)
 {
+    // Storages with the same records need no walk
+    if (_expectStorage.digest() == _remoteStorage.digest())
+        return CompareResult::Success;
+
     CompareResult result = CompareResult::Success;
     string const message = "Check State: Remote account '" + _remoteAccount.asString() + "' ";
 
-    for (auto const& element : _expectStorage.getKeys())
+    // Only the keys that differ are visited, matching storages produce an empty diff
+    std::vector<Storage::StorageRecord const*> remoteExtraRecords;
+    for (auto const& record : _expectStorage.diff(_remoteStorage))
     {
-        VALUE const& expKey = std::get<0>(element.second);
-        VALUE const& expVal = std::get<1>(element.second);
-
-        // If remote storage doesn't exist and expected is not 00 (zeros omited)
-        if (!_remoteStorage.hasKey(expKey) && expVal.asBigInt() != 0)
+        if (record.lhs == nullptr)
         {
-            ETH_MARK_ERROR(message + "test expected storage key: '" + expKey.asString() + "' to be set to: '" +
-                           expVal.asString() + "', but remote key '" + expKey.asString() + "' does not exist!");
-            result = CompareResult::IncorrectStorage;
+            remoteExtraRecords.emplace_back(record.rhs);
+            continue;
         }
-        else if (_remoteStorage.hasKey(expKey))
+
+        VALUE const& expVal = record.lhs->value;
+        // If remote storage doesn't exist and expected is not 00 (zeros omited)
+        if (record.rhs == nullptr)
         {
-            VALUE const& remoteVal = _remoteStorage.atKey(expKey);
-            // Treat expVal as ANY allowed value if it has bigint prefix
-            if (remoteVal != expVal && !expVal.isBigInt())
+            if (expVal.asBigInt() != 0)
             {
-                ETH_MARK_ERROR(message + "has incorrect storage [" + expKey.asString() + "] = `" +
-                               remoteVal.asString() + "(" + remoteVal.asDecString() + ")" +
-                               "`, test expected [" + expKey.asString() + "] = `" +
-                               expVal.asString() + "(" + expVal.asDecString() + ")" +
-                               "`");
+                string const expKey = record.lhs->keyString();
+                ETH_MARK_ERROR(message + "test expected storage key: '" + expKey + "' to be set to: '" +
+                               expVal.asString() + "', but remote key '" + expKey + "' does not exist!");
                 result = CompareResult::IncorrectStorage;
             }
         }
-    }
-
-    if (_expectStorage.getKeys().size() == _remoteStorage.getKeys().size())
-    {
-        string storage = message + " has storage records that are not checked by expected storage!";
-        for (auto const& element : _remoteStorage.getKeys())
+        // Treat expVal as ANY allowed value if it has bigint prefix
+        else if (!expVal.isBigInt())
         {
-            VALUE const& remKey = std::get<0>(element.second);
-            auto const& remVal = std::get<1>(element.second);
-            storage += "\n [" + remKey.asDecString() + "] = " + remVal->asString();
-            storage += "(";
-            storage += remVal->asDecString();
-            storage += ")\n";
-            if (!_expectStorage.hasKey(remKey))
-            {
-                ETH_MARK_ERROR(storage);
-                result = CompareResult::IncorrectStorage;
-            }
+            string const expKey = record.lhs->keyString();
+            VALUE const& remoteVal = record.rhs->value;
+            ETH_MARK_ERROR(message + "has incorrect storage [" + expKey + "] = `" +
+                           remoteVal.asString() + "(" + remoteVal.asDecString() + ")" +
+                           "`, test expected [" + expKey + "] = `" +
+                           expVal.asString() + "(" + expVal.asDecString() + ")" +
+                           "`");
+            result = CompareResult::IncorrectStorage;
         }
     }
 
-    if (_expectStorage.getKeys().size() < _remoteStorage.getKeys().size())
-    {
-        string storage = message + " has more storage records than expected!";
-        std::vector<string> keys;
-        for (auto const& el : _remoteStorage.getKeys())
-        {
-            if (!_expectStorage.hasKey(VALUE(el.first)))
-                keys.emplace_back(el.first);
-        }
-        auto const& remVal = _remoteStorage.atKey(VALUE(keys.at(0)));
-        storage += "\n [" + keys.at(0) + "] = " + remVal.asString();
-        storage += "(";
-        storage += remVal.asDecString();
-        storage += ")\n";
+    if (remoteExtraRecords.empty())
+        return result;
+
+    auto const printRecord = [](Storage::StorageRecord const& _record) {
+        VALUE const& remVal = _record.value;
+        return "\n [" + _record.keyString() + "] = " + remVal.asString() + "(" + remVal.asDecString() + ")\n";
+    };
 
-        ETH_MARK_ERROR(storage);
+    if (_expectStorage.size() == _remoteStorage.size())
+    {
+        for (auto const& remRecord : remoteExtraRecords)
+            ETH_MARK_ERROR(message + " has storage records that are not checked by expected storage!" + printRecord(*remRecord));
+        result = CompareResult::IncorrectStorage;
+    }
+    else if (_expectStorage.size() < _remoteStorage.size())
+    {
+        ETH_MARK_ERROR(message + " has more storage records than expected!" + printRecord(*remoteExtraRecords.at(0)));
         result = CompareResult::IncorrectStorage;
     }
 
@@ -212,6 +196,10 @@ CompareResult compareStorage(Storage const& _expectStorage, Storage const& _remo
 // Compare Expected Account agains Account
 CompareResult compareAccounts(AccountBase const& _expectAccount, State::Account const& _remoteAccount)
 {
+    // An expected account with all fields set matches the remote one by digest
+    if (_expectAccount.digest() == _remoteAccount.digest())
+        return CompareResult::Success;
+
     // report all errors, but return the last error as a compare result
     CompareResult result = CompareResult::Success;
     auto checkEqual = [&_remoteAccount](VALUE const& _expect, VALUE const& _remote, string const& _what) -> bool {
@@ -134,7 +134,7 @@ bool BlockchainTestRunner::checkLastRPCBlockException(BlockchainTestBlock const&
                 "blocks test suite) " +
                 m_session.getLastRPCError().message());
 
-        if (Options::getDynamicOptions().getCurrentConfig().cfgFile().socketType() == ClientConfgSocketType::TransitionTool)
+        if (Options::getDynamicOptions().getCurrentConfig().cfgFile().isTransitionTool())
         {
             string const& sBlockException = _tblock.getExpectException();
             if (!sBlockException.empty())
@@ -175,9 +175,7 @@ void BlockchainTestRunner::performOptionCommands(BlockchainTestBlock const& _tbl
 
 void BlockchainTestRunner::validateBlockHeader(BlockchainTestBlock const& _tblock, EthGetBlockBy const& _latestBlock)
 {
-    spDataObject remoteHeader = _latestBlock.header()->asDataObject();
-    spDataObject testHeader = _tblock.header()->asDataObject();
-    bool condition = remoteHeader->asJson(0, false) == testHeader->asJson(0, false);
+    bool condition = _latestBlock.header().getCContent() == _tblock.header().getCContent();
     /*if (_opt.isLegacyTests)
         {
             inTestHeader = bdata.atKey("blockHeader");  // copy!!!
@@ -200,6 +198,9 @@ void BlockchainTestRunner::validateBlockHeader(BlockchainTestBlock const& _tbloc
     string message;
     if (!condition)
     {
+        // Render json only to report the difference
+        spDataObject remoteHeader = _latestBlock.header()->asDataObject();
+        spDataObject testHeader = _tblock.header()->asDataObject();
         string errField;
         message = "Client return HEADER vs Test HEADER: \n";
         message += compareBlockHeaders(remoteHeader.getCContent(), testHeader.getCContent(), errField);
@@ -213,25 +214,27 @@ void BlockchainTestRunner::validateUncles(BlockchainTestBlock const& _tblock, Et
 {
     // Verify uncles to one described in the fields
     size_t ind = 0;
-    string message = "Client return UNCLES: " + to_string(_latestBlock.uncles().size()) + " vs " +
-                     "Test UNCLES: " + to_string(_tblock.uncles().size());
+    auto const message = [&_tblock, &_latestBlock]() {
+        return "Client return UNCLES: " + to_string(_latestBlock.uncles().size()) + " vs " +
+               "Test UNCLES: " + to_string(_tblock.uncles().size());
+    };
     ETH_ERROR_REQUIRE_MESSAGE(_latestBlock.uncles().size() == _tblock.uncles().size(),
-        "Client report different uncle count after importing the rlp than expected by test! \n" + message);
+        "Client report different uncle count after importing the rlp than expected by test! \n" + message());
     for (spBlockHeader const& tuncle : _tblock.uncles())
     {
-        FH32 clientUncleHash = _latestBlock.uncles().at(ind++);  // EthGetBlockBy return only hashes
+        FH32 const& clientUncleHash = _latestBlock.uncles().at(ind++);  // EthGetBlockBy return only hashes
         if (clientUncleHash != tuncle->hash())
-            ETH_ERROR_MESSAGE("Remote client returned block with unclehash that is not expected by test! " + message);
+            ETH_ERROR_MESSAGE("Remote client returned block with unclehash that is not expected by test! " + message());
     }
 }
 
 void BlockchainTestRunner::validateTransactions(BlockchainTestBlock const& _tblock, EthGetBlockBy const& _latestBlock)
 {
     // Check Transaction count
-    string message = "Client return TRANSACTIONS: " + to_string(_latestBlock.transactions().size()) + " vs " +
-                     "Test TRANSACTIONS: " + to_string(_tblock.transactions().size());
     ETH_ERROR_REQUIRE_MESSAGE(_latestBlock.transactions().size() == _tblock.transactions().size(),
-        "Client report different transaction count after importing the rlp than expected by test! \n" + message);
+        "Client report different transaction count after importing the rlp than expected by test! \n"
+        "Client return TRANSACTIONS: " + to_string(_latestBlock.transactions().size()) + " vs " +
+            "Test TRANSACTIONS: " + to_string(_tblock.transactions().size()));
 
     // Verify transactions to one described in the fields
     size_t ind = 0;
@@ -250,27 +253,22 @@ void BlockchainTestRunner::validateTransactions(BlockchainTestBlock const& _tblo
             "(" +
                 clientTr.blockNumber().asDecString() + " != " + _tblock.header()->number().asDecString() + ")");
 
-        BYTES const testTr = tr->getRawBytes();
-        BYTES const remoteTr = clientTr.transaction()->getRawBytes();
-        bool isRemoteTrEqualTestTr = remoteTr == testTr;
-        if (!isRemoteTrEqualTestTr)
-        {
-            auto origSender = tr->sender();
-
-            // Try a different v|chainid formula for legacy transaction
-            spDataObject data = tr->asDataObject();
-            (*data).atKeyUnsafe("v") = clientTr.transaction()->v().asString();
-            (*data).atKeyUnsafe("r") = clientTr.transaction()->r().asString();
-            (*data).atKeyUnsafe("s") = clientTr.transaction()->s().asString();
+        BYTES const& remoteTr = clientTr.transaction()->getRawBytes();
+        if (remoteTr == tr->getRawBytes())
+            continue;
 
-            auto newTestTr = readTransaction(dataobject::move(data));
-            ETH_ERROR_REQUIRE_MESSAGE(newTestTr->sender() == origSender, "Error checking remote transaction: can't recover the same sender with remote vrs!");
+        // Try a different v|chainid formula for legacy transaction
+        auto origSender = tr->sender();
+        spDataObject data = tr->asDataObject();
+        (*data).atKeyUnsafe("v") = clientTr.transaction()->v().asString();
+        (*data).atKeyUnsafe("r") = clientTr.transaction()->r().asString();
+        (*data).atKeyUnsafe("s") = clientTr.transaction()->s().asString();
 
-            BYTES& testTrCheat = const_cast<BYTES&>(testTr);
-            testTrCheat = newTestTr->getRawBytes();
-            isRemoteTrEqualTestTr = remoteTr == testTrCheat;
-        }
+        auto newTestTr = readTransaction(dataobject::move(data));
+        ETH_ERROR_REQUIRE_MESSAGE(newTestTr->sender() == origSender, "Error checking remote transaction: can't recover the same sender with remote vrs!");
 
+        BYTES const& testTr = newTestTr->getRawBytes();
+        bool const isRemoteTrEqualTestTr = remoteTr == testTr;
         ETH_ERROR_REQUIRE_MESSAGE(isRemoteTrEqualTestTr, "Error checking remote transaction, remote tr `" + remoteTr.asString() +
                                                           "` is different to test tr `" + testTr.asString() + "`)");
     }
@@ -30,9 +30,13 @@ using namespace dataobject;
         FillerPath suiteFillerFolder() const override;  \
     };
 
-REGISTER_SUITE_OVERRIDE(BlockchainTestValidSuite, TestSuite,)
-REGISTER_SUITE_OVERRIDE(BlockchainTestInvalidSuite, TestSuite,)
-REGISTER_SUITE_OVERRIDE(BlockchainTestTransitionSuite, TestSuite,)
+#define SELECTBYNAMEFLAG  \
+    protected:            \
+        bool selectsTestsByName() const override { return true; }
+
+REGISTER_SUITE_OVERRIDE(BlockchainTestValidSuite, TestSuite, SELECTBYNAMEFLAG)
+REGISTER_SUITE_OVERRIDE(BlockchainTestInvalidSuite, TestSuite, SELECTBYNAMEFLAG)
+REGISTER_SUITE_OVERRIDE(BlockchainTestTransitionSuite, TestSuite, SELECTBYNAMEFLAG)
 
 REGISTER_SUITE(BlockchainTestEIPSuite, BlockchainTestInvalidSuite)
 REGISTER_SUITE(BlockchainTestPyspecSuite, BlockchainTestInvalidSuite)
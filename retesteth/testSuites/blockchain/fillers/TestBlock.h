@@ -37,7 +37,7 @@ public:
     // Attach uncle header of potential fork to this block. If test has no uncles this will not be called
     void setNextBlockForked(spBlockHeader const& _next)
     {
-        m_nextBlockForked = readBlockHeader(_next->asDataObject());
+        m_nextBlockForked = copyBlockHeader(_next);
     }
     spBlockHeader const& getNextBlockForked() const { return m_nextBlockForked; }
 
@@ -32,7 +32,7 @@ TestBlockchain::TestBlockchain(BlockchainTestFillerEnv const& _testEnv, State co
 
 bool clientSupportWithdrawalsRPC()
 {
-    return Options::getCurrentConfig().cfgFile().socketType() == ClientConfgSocketType::TransitionTool;
+    return Options::getCurrentConfig().cfgFile().isTransitionTool();
 }
 
 void TestBlockchain::_mineBlock_importWithdrawals(BlockchainTestFillerBlock const& _blockInTest)
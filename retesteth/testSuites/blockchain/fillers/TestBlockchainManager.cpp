@@ -331,7 +331,7 @@ spBlockHeader TestBlockchainManager::prepareUncle(
 
     if (tmpRefToSchemeBlock == NULL)
         ETH_ERROR_MESSAGE("tmpRefToSchemeBlock is NULL!");
-    spBlockHeader uncleBlockHeader = readBlockHeader((*tmpRefToSchemeBlock).asDataObject());
+    spBlockHeader uncleBlockHeader = copyBlockHeader(*tmpRefToSchemeBlock);
 
     // Perform uncle header modifications according to the uncle section in blockchain test filler block
     // If there is a field that is being overwritten in the uncle header
@@ -187,8 +187,12 @@ string StateTestFillerRunner::performVmtraceAnalys(FH32 const& _trHash, StateTes
         if (!_expResult.getExpectException(_network).empty())
             return vmtrace;
         DebugVMTrace ret(m_session.debug_traceTransaction(_trHash));
-        for (auto const& log : ret.getLog())
-            vmtrace += dev::toCompactHex(log.op);
+        VMTraceLog const& log = ret.getLog();
+        for (size_t i = 0; i < log.size(); i++)
+        {
+            if (!log.isShort(i))
+                vmtrace += dev::toCompactHex(log.op(i));
+        }
     }
     return vmtrace;
 }
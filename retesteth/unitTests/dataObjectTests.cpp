@@ -19,9 +19,12 @@
  */
 
 #include <libdataobj/ConvertFile.h>
+#include <libdataobj/ConvertYaml.h>
+#include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testSuites/Common.h>
 #include <retesteth/testStructures/Common.h>
+#include <retesteth/unitTests/testSuites.h>
 #include <libdevcore/SHA3.h>
 
 using namespace std;
@@ -225,6 +228,14 @@ BOOST_AUTO_TEST_CASE(dataobject_invalidJson8)
     BOOST_ERROR("Expected DataObject exception when parsing json!");
 }
 
+BOOST_AUTO_TEST_CASE(dataobject_invalidJson9)
+{
+    // The view ends inside the number, the digits after it are not a part of the json
+    string const buffer = R"({"a":12345})";
+    BOOST_CHECK_THROW(ConvertJsoncppStringToData(std::string_view(buffer).substr(0, 8)), DataObjectException);
+    BOOST_CHECK_THROW(ConvertJsoncppStringToData(std::string_view(buffer).substr(0, 6)), DataObjectException);
+}
+
 BOOST_AUTO_TEST_CASE(dataobject_readJson1)
 {
     string data = R"(
@@ -1133,6 +1144,78 @@ BOOST_AUTO_TEST_CASE(dataobject_removeLeadingZerosFromHexValueEVEN)
     BOOST_CHECK(obj->getKey() == "00012235");
 }
 
+BOOST_AUTO_TEST_CASE(dataobject_normalizer)
+{
+    string const data = R"({
+        "0x00Ab" : "0x000Ff",
+        "0x01" : { "0x0002" : "0X0a", "code" : "0x000A", "nested" : { "0X000C" : "0x00000d" } },
+        "code" : { "0x000E" : "0x000f" }
+    })";
+    spDataObject chained = ConvertJsoncppStringToData(data);
+    (*chained).performModifier(mod_removeLeadingZerosFromHexValueEVEN, DataObject::ModifierOption::RECURSIVE, {"code"});
+    (*chained).performModifier(mod_removeLeadingZerosFromHexKeyEVEN);
+    (*chained).performModifier(mod_valueToLowerCase);
+    (*chained).performModifier(mod_keyToLowerCase, DataObject::ModifierOption::RECURSIVE, {"nested"});
+
+    spDataObject fused = ConvertJsoncppStringToData(data);
+    DataObjectNormalizer()
+        .add(mod_removeLeadingZerosFromHexValueEVEN, {"code"})
+        .add(mod_removeLeadingZerosFromHexKeyEVEN)
+        .add(mod_valueToLowerCase)
+        .add(mod_keyToLowerCase, {"nested"})
+        .perform(fused.getContent());
+
+    BOOST_CHECK(chained->asJson() == fused->asJson());
+    BOOST_CHECK(fused->at(0).getKey() == "0xab");
+    BOOST_CHECK(fused->at(0).asString() == "0xff");
+    BOOST_CHECK(fused->at(1).at(1).asString() == "0x000a");
+    BOOST_CHECK(fused->at(2).at(0).getKey() == "0x0e");
+    BOOST_CHECK(fused->at(2).at(0).asString() == "0x000f");
+}
+
+BOOST_AUTO_TEST_CASE(dataobject_convertDecStateToHex)
+{
+    spDataObject state = ConvertJsoncppStringToData(R"({
+        "0x095E7BAEA6A6C7C4C2DFEB977EFAC326AF552D87" : {
+            "balance" : "1000", "code" : "0x", "nonce" : "1",
+            "storage" : { "0x0ABC" : "0x0F", "10" : "255" }
+        }
+    })");
+    teststruct::convertDecStateToHex(state, {}, teststruct::StateToHex::NOCOMPILECODE);
+    BOOST_REQUIRE(state->getSubObjects().size() == 1);
+    DataObject const& acc = state->at(0);
+    BOOST_CHECK(acc.getKey() == "0x095e7baea6a6c7c4c2dfeb977efac326af552d87");
+    BOOST_CHECK(acc.atKey("balance").asString() == "0x03e8");
+    BOOST_CHECK(acc.atKey("nonce").asString() == "0x01");
+    DataObject const& storage = acc.atKey("storage");
+    BOOST_REQUIRE(storage.getSubObjects().size() == 2);
+    BOOST_CHECK(storage.at(0).getKey() == "0x0abc");
+    BOOST_CHECK(storage.at(0).asString() == "0x0f");
+    BOOST_CHECK(storage.at(1).getKey() == "0x0a");
+    BOOST_CHECK(storage.at(1).asString() == "0xff");
+}
+
+BOOST_AUTO_TEST_CASE(dataobject_normalizerLargeStorage)
+{
+    size_t const c_slots = 2000;
+    spDataObject chained(new DataObject(DataType::Object));
+    for (size_t i = 0; i < c_slots; i++)
+        (*chained).addSubObject(sDataObject("0x000" + toCompactHex(u256(i), 1), "0x00" + toCompactHex(u256(i * 7), 1)));
+    spDataObject fused(new DataObject());
+    (*fused).copyFrom(chained.getCContent());
+
+    (*chained).performModifier(mod_removeLeadingZerosFromHexValueEVEN);
+    (*chained).performModifier(mod_removeLeadingZerosFromHexKeyEVEN);
+    DataObjectNormalizer({mod_removeLeadingZerosFromHexValueEVEN, mod_removeLeadingZerosFromHexKeyEVEN}).perform(fused.getContent());
+    BOOST_CHECK(chained->asJson() == fused->asJson());
+
+    BOOST_REQUIRE(fused->getSubObjects().size() == c_slots);
+    BOOST_CHECK(fused->at(300).getKey() == "0x012c");
+    BOOST_CHECK(fused->at(300).asString() == "0x0834");
+    BOOST_CHECK(fused->at(c_slots - 1).getKey() == "0x07cf");
+    BOOST_CHECK(fused->at(c_slots - 1).asString() == "0x36a9");
+}
+
 BOOST_AUTO_TEST_CASE(dataobject_removeLeadingZerosFromHexValues)
 {
     spDataObject obj = sDataObject("0x0000112233");
@@ -1305,4 +1388,123 @@ BOOST_AUTO_TEST_CASE(dataobject_copyFrom_emptyArray)
     }
 }
 
+BOOST_AUTO_TEST_CASE(dataobject_yamlParser_conformance)
+{
+    vector<string> const documents = {
+        test::unittests::c_sampleStateTestFiller,
+        test::unittests::c_sampleStateTestFilled,
+        test::unittests::c_sampleBlockchainTestFiller,
+        test::unittests::c_sampleBlockchainTestFilled,
+        "",
+        "# only a comment\n",
+        "plain scalar\n  continues here\n\n  after empty line",
+        "rules: [2, allowEmpty: true, nested: [warn, error], empty:]\nstep: &step\n  run: x\nsteps:\n  - *step\n",
+        "code: |\n  first\n    \n  after spaces line\n",
+        R"(---
+# Filler with comments
+stateTest:
+  _info :
+    comment: "Quoted \"comment\" é \x41\
+      continued"
+  env:
+    currentCoinbase: 2adc25665018aa1fe0e6bc666dac8fc2697ff9ba   # comment
+    currentDifficulty: '0x20000'
+    currentNumber: !!int 1
+    negative: !!int -1
+    hex: !!int 0x10
+    enabled: !!bool Yes
+    disabled: !!bool off
+    empty:
+    tilde: ~
+    notNull: "null"
+    url: http://example.com:8545
+  pre:
+    0x095e7baea6a6c7c4c2dfeb977efac326af552d87:
+      balance: '1000000000000000000'
+      code: |
+        {
+          [[0]] (ADD 1 1)
+        }
+      folded: >-
+        first
+        second
+
+        third
+          indented
+      keep: |+
+        kept
+
+      storage: {}
+      nonce: 0
+  expect:
+  - indexes:
+      data: !!int -1
+      gas: [ 0, 1 ]
+      value: [ !!int -1 ]
+    network:
+    - '>=Cancun'
+    - 'Berlin'
+    result:
+      'single ''quoted'' key': &account
+        balance: 0x0ba1a9ce0ba1a9ce
+        storage: { 0x00: 0x01, "0x01" : '0x02' }
+      alias: *account
+      list:
+        - - nested
+          - items
+        -
+        - - 1
+  multiline: 'single quoted
+    folded
+
+    line'
+  flow: [a, b c, {k: v, empty: }, [x, y]]
+  flowMultiline: {
+    a: 1,   # comment inside flow
+    b: [2,
+        3],
+  }
+...
+ignored: after document end
+)",
+    };
+
+    for (bool const sort : {false, true})
+    {
+        for (auto const& doc : documents)
+        {
+            spDataObject const expected = ConvertYamlToData(YAML::Load(doc), sort);
+            spDataObject const actual = ConvertYamlStringToData(doc, sort);
+            BOOST_CHECK_EQUAL(actual->asJson(), expected->asJson());
+            BOOST_CHECK(actual->type() == expected->type());
+        }
+    }
+
+    BOOST_CHECK_THROW(ConvertYamlStringToData("a: 1\na: 2\n"), DataObjectException);
+    BOOST_CHECK_THROW(ConvertYamlStringToData("a: !!int abc\n"), DataObjectException);
+    BOOST_CHECK_THROW(ConvertYamlStringToData("a: [1, 2\n"), DataObjectException);
+    BOOST_CHECK_THROW(ConvertYamlStringToData("a:\n  b: 1\n c: 2\n"), DataObjectException);
+
+    // Rejected by yaml-cpp or by the conversion of its nodes
+    vector<string> const invalid = {
+        "a: b: c\n",
+        "key: value with: colon\n",
+        "a: b:\n",
+        "- a: b: c\n",
+        "a: - 1\n",
+        "a: -\n",
+        "a: x\n  b: y\n",
+        "? k : v\n",
+        "a: ? x\n",
+        "a: @x\n",
+    };
+    for (auto const& doc : invalid)
+    {
+        BOOST_CHECK_THROW(ConvertYamlToData(YAML::Load(doc)), std::exception);
+        BOOST_CHECK_THROW(ConvertYamlStringToData(doc), DataObjectException);
+    }
+    BOOST_CHECK(ConvertYamlStringToData("a: b # c: d\n")->atKey("a").asString() == "b");
+    BOOST_CHECK(ConvertYamlStringToData("a: http://x:80 y\n")->atKey("a").asString() == "http://x:80 y");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
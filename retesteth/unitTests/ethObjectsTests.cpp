@@ -22,12 +22,19 @@
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
 #include <retesteth/testSuites/Common.h>
+#include <retesteth/testStructures/types/Ethereum/TrieRoots.h>
+#include <retesteth/unitTests/testSuites.h>
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/HexCodec.h>
+#include <libdevcore/TrieHash.h>
+#include <boost/filesystem/fstream.hpp>
 
 using namespace std;
 using namespace dev;
 using namespace test;
 using namespace test::debug;
 using namespace test::teststruct;
+namespace fs = boost::filesystem;
 
 BOOST_FIXTURE_TEST_SUITE(EthObjectsSuite, TestOutputHelperFixture)
 
@@ -557,6 +564,236 @@ BOOST_AUTO_TEST_CASE(compareStates_storageCombinations)
     ExpectVsPost("0x00", "0x01", "0x00", "0x01", CompareResult::IncorrectStorage, "0x03");
 }
 
+BOOST_AUTO_TEST_CASE(storage_sortedMergeAndDiff)
+{
+    spDataObject storageA;
+    (*storageA)["0x0100"] = "0x01";
+    (*storageA)["0x02"] = "0x02";
+    (*storageA)["0x03"] = "0x03";
+    spDataObject storageB;
+    (*storageB)["0x02"] = "0x02";
+    (*storageB)["0x03"] = "0x04";
+    (*storageB)["0x05"] = "0x05";
+
+    Storage a(storageA);
+    Storage b(storageB);
+    BOOST_CHECK(a.records().at(0).keyString() == "0x02");
+    BOOST_CHECK(a.records().at(2).keyString() == "0x0100");
+    BOOST_CHECK(a.hasKey(VALUE(256)));
+    BOOST_CHECK(!a.hasKey(VALUE(5)));
+
+    auto const diff = a.diff(b);
+    BOOST_CHECK(diff.size() == 3);
+    BOOST_CHECK(diff.at(0).lhs->keyString() == "0x03" && diff.at(0).rhs->value->asString() == "0x04");
+    BOOST_CHECK(diff.at(1).lhs == nullptr && diff.at(1).rhs->keyString() == "0x05");
+    BOOST_CHECK(diff.at(2).lhs->keyString() == "0x0100" && diff.at(2).rhs == nullptr);
+
+    a.merge(b);
+    BOOST_CHECK(a.size() == 4);
+    BOOST_CHECK(a.atKey(VALUE(3)).asString() == "0x04");
+    BOOST_CHECK(a.diff(b).size() == 1);
+    BOOST_CHECK(a.asDataObject()->asJson(0, false) == R"({"0x0100":"0x01","0x02":"0x02","0x03":"0x04","0x05":"0x05"})");
+}
+
+BOOST_AUTO_TEST_CASE(storage_keyOutOfRange)
+{
+    spDataObject bigintKey;
+    (*bigintKey)["0x:bigint 0x01"] = "0x01";
+    BOOST_CHECK_THROW(Storage{bigintKey}, UpwardsException);
+
+    spDataObject aboveU256;
+    (*aboveU256)["0x010000000000000000000000000000000000000000000000000000000000000000"] = "0x01";
+    BOOST_CHECK_THROW(Storage{aboveU256}, UpwardsException);
+
+    spDataObject maxU256;
+    (*maxU256)["0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"] = "0x01";
+    Storage const max(maxU256);
+    BOOST_CHECK(max.hasKey(std::numeric_limits<dev::u256>::max()));
+}
+
+BOOST_AUTO_TEST_CASE(storage_largeAccountCompare)
+{
+    size_t const c_slots = 3000;
+    size_t const c_changedSlot = 1500;
+    spDataObject expectStorage(new DataObject(DataType::Object));
+    spDataObject postStorage(new DataObject(DataType::Object));
+    spDataObject changedStorage(new DataObject(DataType::Object));
+    for (size_t i = 1; i <= c_slots; i++)
+    {
+        string const key = dev::toCompactHexPrefixed(i, 1);
+        (*expectStorage).addSubObject(sDataObject(key, key));
+        (*postStorage).addSubObject(sDataObject(key, key));
+        (*changedStorage).addSubObject(sDataObject(key, i == c_changedSlot ? "0x01" : key));
+    }
+
+    Storage const expect(expectStorage);
+    Storage const post(postStorage);
+    Storage const changed(changedStorage);
+    BOOST_CHECK(expect.size() == c_slots);
+    BOOST_CHECK(expect.diff(post).empty());
+
+    // Records are in key number order, 0x0100 comes after 0xff
+    BOOST_CHECK(expect.records().at(0).keyString() == "0x01");
+    BOOST_CHECK(expect.records().at(254).keyString() == "0xff");
+    BOOST_CHECK(expect.records().at(255).keyString() == "0x0100");
+    BOOST_CHECK(expect.records().back().keyString() == dev::toCompactHexPrefixed(c_slots, 1));
+    BOOST_CHECK(expect.atKey(VALUE(c_changedSlot)).asString() == "0x05dc");
+
+    auto const diff = expect.diff(changed);
+    BOOST_REQUIRE(diff.size() == 1);
+    BOOST_CHECK(diff.at(0).lhs->keyString() == "0x05dc");
+    BOOST_CHECK(diff.at(0).lhs->value->asString() == "0x05dc");
+    BOOST_CHECK(diff.at(0).rhs->value->asString() == "0x01");
+
+    spDataObject expectData;
+    (*expectData)["0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b"].atKeyPointer("storage") = expectStorage;
+    spDataObject postData;
+    (*postData)["0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b"]["balance"] = "0x082124";
+    (*postData)["0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b"]["code"] = "0x1234";
+    (*postData)["0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b"]["nonce"] = "0x01";
+    (*postData)["0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b"].atKeyPointer("storage") = postStorage;
+    testCompareResult(expectData, postData, CompareResult::Success);
+}
+
+BOOST_AUTO_TEST_CASE(stateDiff_digests)
+{
+    auto const account = [](string const& _balance, string const& _slot) {
+        spDataObject acc;
+        (*acc)["balance"] = _balance;
+        (*acc)["code"] = "0x";
+        (*acc)["nonce"] = "0x00";
+        (*acc)["storage"]["0x01"] = _slot;
+        return acc;
+    };
+    spDataObject preData;
+    (*preData).atKeyPointer("0x095e7baea6a6c7c4c2dfeb977efac326af552d87") = account("0x01", "0x01");
+    (*preData).atKeyPointer("0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b") = account("0x0a", "0x02");
+    (*preData).atKeyPointer("0xb94f5374fce5edbc8e2a8697c15331677e6ebf0b") = account("0x02", "0x03");
+    spDataObject postData;
+    (*postData).atKeyPointer("0x095e7baea6a6c7c4c2dfeb977efac326af552d87") = account("0x01", "0x01");
+    (*postData).atKeyPointer("0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b") = account("0x0a", "0x05");
+    (*postData).atKeyPointer("0xc94f5374fce5edbc8e2a8697c15331677e6ebf0b") = account("0x03", "0x04");
+    State const pre(dataobject::move(preData));
+    State const post(dataobject::move(postData));
+
+    FH20 const same("0x095e7baea6a6c7c4c2dfeb977efac326af552d87");
+    BOOST_CHECK(pre.getAccount(same).digest() == post.getAccount(same).digest());
+    FH20 const changed("0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b");
+    BOOST_CHECK(pre.getAccount(changed).digest() != post.getAccount(changed).digest());
+
+    auto const records = diffStates(pre, post);
+    BOOST_REQUIRE(records.size() == 3);
+    BOOST_CHECK(records.at(0).pre->address() == changed && records.at(0).post->address() == changed);
+    BOOST_CHECK(records.at(1).pre != nullptr && records.at(1).post == nullptr);
+    BOOST_CHECK(records.at(2).pre == nullptr && records.at(2).post != nullptr);
+
+    spDataObject const diff = stateDiff(pre, post);
+    BOOST_CHECK(diff->getSubObjects().size() == 3);
+    BOOST_CHECK(diff->atKey(changed.asString()).atKey("storage").atKey("0x01").asString() == "0x02 -> 0x05 (2 -> 5)");
+    BOOST_CHECK(diff->count("NEW: 0xc94f5374fce5edbc8e2a8697c15331677e6ebf0b"));
+    BOOST_CHECK(diff->getSubObjects().back()->asString() == "DELETED: 0xb94f5374fce5edbc8e2a8697c15331677e6ebf0b");
+}
+
+BOOST_AUTO_TEST_CASE(stateDiff_digestAfterStorageMerge)
+{
+    spDataObject slots;
+    (*slots)["0x01"] = "0x01";
+    spStorage storage(new Storage(slots));
+    spVALUE balance(new VALUE(1));
+    spVALUE nonce(new VALUE(0));
+    spBYTES code(new BYTES(string("0x")));
+    spStorage sameStorage(new Storage(slots));
+    State::Account const account(FH20("0x095e7baea6a6c7c4c2dfeb977efac326af552d87"), balance, nonce, code, storage);
+    State::Account const same(FH20("0x095e7baea6a6c7c4c2dfeb977efac326af552d87"), balance, nonce, code, sameStorage);
+    BOOST_CHECK(account.digest() == same.digest());
+
+    // The storage is filled after the account digest was taken, like the paged debug_storageRangeAt
+    spDataObject more;
+    (*more)["0x02"] = "0x02";
+    (*storage).merge(Storage(more));
+    BOOST_CHECK(account.storage().digest() != same.storage().digest());
+    BOOST_CHECK(account.digest() != same.digest());
+    (*sameStorage).merge(Storage(more));
+    BOOST_CHECK(account.digest() == same.digest());
+}
+
+BOOST_AUTO_TEST_CASE(hexCodec_blocksAndTails)
+{
+    // Sizes around the 16 and 32 byte blocks and a large blob
+    vector<size_t> sizes;
+    for (size_t i = 0; i <= 70; i++)
+        sizes.push_back(i);
+    sizes.push_back(24576);
+
+    for (size_t const size : sizes)
+    {
+        bytes data(size);
+        for (size_t i = 0; i < size; i++)
+            data[i] = (uint8_t)(i * 37 + size);
+
+        string expected;
+        for (auto const b : data)
+        {
+            expected += "0123456789abcdef"[b >> 4];
+            expected += "0123456789abcdef"[b & 0x0f];
+        }
+        string const hex = toHex(data);
+        BOOST_REQUIRE_EQUAL(hex, expected);
+        BOOST_CHECK(fromHex(hex) == data);
+        BOOST_CHECK(isHex("0x" + hex));
+
+        string upper = hex;
+        std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+        BOOST_CHECK(fromHex("0x" + upper, WhenError::Throw) == data);
+        BOOST_CHECK(normalizeHex(upper.data(), upper.size()));
+        BOOST_CHECK_EQUAL(upper, hex);
+    }
+
+    // A bad character is found at any position of the blocks and the tail
+    string const valid = toHex(bytes(40, 0xab));
+    for (size_t i = 0; i < valid.size(); i++)
+    {
+        for (char const bad : {'g', 'G', ' ', '/', ':', '@', '`', '\x80', '\xb0'})
+        {
+            string hex = valid;
+            hex[i] = bad;
+            BOOST_CHECK(!isHex(hex));
+            BOOST_CHECK(fromHex(hex).empty());
+            BOOST_CHECK_THROW(fromHex(hex, WhenError::Throw), BadHexCharacter);
+            BOOST_CHECK(!normalizeHex(hex.data(), hex.size()));
+        }
+    }
+
+    BOOST_CHECK(fromHex("0xabc") == bytes({0x0a, 0xbc}));
+    BOOST_CHECK(fromHex("0x") == bytes());
+    BOOST_CHECK(toHexPrefixed(bytes()) == "0x");
+}
+
+BOOST_AUTO_TEST_CASE(trieRoot_vectors)
+{
+    auto const item = [](string const& _key, string const& _value) {
+        return std::make_pair(asBytes(_key), asBytes(_value));
+    };
+    BOOST_CHECK(toHexPrefixed(trieRoot({})) == "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421");
+    BOOST_CHECK(toHexPrefixed(trieRoot({item("dogglesworth", "cat"), item("doe", "reindeer"), item("dog", "puppy")})) ==
+                "0x8aad789dff2f538bca5d8ea56e8abe10f4c7ba3a5dea95fea4cd6e7c3a1168d3");
+    BOOST_CHECK(toHexPrefixed(trieRoot({item("foo", "bar"), item("food", "bass")})) ==
+                "0x17beaa1648bafa633cda809c90c04af50fc8aed3cb40d16efbddee6fdf63c4c3");
+    BOOST_CHECK(toHexPrefixed(orderedTrieRoot({})) == "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421");
+}
+
+BOOST_AUTO_TEST_CASE(trieRoot_sampleBlockchainTest)
+{
+    spDataObject const filled = ConvertJsoncppStringToData(test::unittests::c_sampleBlockchainTestFilled);
+    DataObject const& sample = filled->getSubObjects().at(0);
+
+    spDataObject pre = sample.atKey("pre").copy();
+    BOOST_CHECK(stateRoot(State(dataobject::move(pre))) == FH32(sample.atKey("genesisBlockHeader").atKey("stateRoot")));
+    spDataObject post = sample.atKey("postState").copy();
+    BOOST_CHECK(stateRoot(State(dataobject::move(post))).asString() ==
+                "0x341ff296dfc16b4b6c16eae2cb6ee46e6baf88a435c591fdc26f0acf3b7630dc");
+}
+
 BOOST_AUTO_TEST_CASE(clientconfigTest)
 {
     string data = R"(
@@ -594,4 +831,270 @@ BOOST_AUTO_TEST_CASE(clientconfigTest)
     BOOST_CHECK(cfg.socketAdresses().at(1).asString() == "127.0.0.1:8546");
 }
 
+void checkSchema(DataObject const& _data)
+{
+    REQUIRE_JSONFIELDS(_data, "TestSchema " + _data.getKey(),
+        {{"balance", {{DataType::String}, jsonField::Required}},
+            {"nonce", {{DataType::String, DataType::Integer}, jsonField::Required}},
+            {"storage", {{DataType::Object}, jsonField::Optional}}});
+}
+
+string schemaError(string const& _json)
+{
+    try
+    {
+        checkSchema(ConvertJsoncppStringToData(_json));
+    }
+    catch (std::exception const& _ex)
+    {
+        return string(_ex.what()).substr(0, string(_ex.what()).find('\n'));
+    }
+    return string();
+}
+
+BOOST_AUTO_TEST_CASE(requireJsonFields_schema)
+{
+    BOOST_CHECK(schemaError(R"({"balance" : "0x01", "nonce" : 1})").empty());
+    BOOST_CHECK(schemaError(R"({"nonce" : "0x01", "storage" : {}, "balance" : "0x01"})").empty());
+    BOOST_CHECK(schemaError(R"({"balance" : "0x01", "nonce" : 1, "code" : ""})") ==
+                "Unexpected field 'code' in config: TestSchema ");
+    BOOST_CHECK(schemaError(R"({"balance" : "0x01", "storage" : {}})") ==
+                "Expected field 'nonce' not found in config: TestSchema ");
+    BOOST_CHECK(schemaError(R"({"balance" : "0x01", "nonce" : 1, "storage" : []})") ==
+                "Field 'storage' expected to be `object`, but set to `array` in TestSchema ");
+
+    {
+        SkipJsonFieldsCheck skipCheck;
+        BOOST_CHECK(schemaError(R"({"code" : ""})").empty());
+    }
+    BOOST_CHECK(!schemaError(R"({"code" : ""})").empty());
+}
+
+BOOST_AUTO_TEST_CASE(requireJsonFields_largeState)
+{
+    size_t const c_accounts = 500;
+    size_t const c_badAccount = 250;
+    spDataObject stateData(new DataObject(DataType::Object));
+    for (size_t i = 1; i <= c_accounts; i++)
+    {
+        spDataObject acc;
+        (*acc).setKey(dev::toHexPrefixed(dev::h160(i)));
+        (*acc)["balance"] = dev::toCompactHexPrefixed(i, 1);
+        (*acc)["code"] = "0x";
+        (*acc)["nonce"] = "0x00";
+        (*acc).atKeyPointer("storage") = spDataObject(new DataObject(DataType::Object));
+        (*stateData).addSubObject(acc);
+    }
+    spDataObject badStateData(new DataObject());
+    (*badStateData).copyFrom(stateData.getCContent());
+    (*badStateData).atUnsafe(c_badAccount - 1)["codeHash"] = "0x";
+    spDataObject badStateDataCopy(new DataObject());
+    (*badStateDataCopy).copyFrom(badStateData.getCContent());
+
+    State const checked(dataobject::move(stateData));
+    BOOST_CHECK(checked.accounts().size() == c_accounts);
+    BOOST_CHECK(checked.getAccount(FH20(dev::toHexPrefixed(dev::h160(c_accounts)))).balance().asString() ==
+                dev::toCompactHexPrefixed(c_accounts, 1));
+
+    // One unexpected field in the middle of the state fails the check
+    try
+    {
+        State const bad(dataobject::move(badStateData));
+        BOOST_ERROR("Expected Exception!");
+    }
+    catch (std::exception const& _ex)
+    {
+        BOOST_CHECK(string(_ex.what()).find("Unexpected field 'codeHash'") != string::npos);
+    }
+    TestOutputHelper::get().resetErrors();
+
+    SkipJsonFieldsCheck skipCheck;
+    State const skipped(dataobject::move(badStateDataCopy));
+    BOOST_CHECK(skipped.accounts().size() == c_accounts);
+    BOOST_CHECK(skipped.getAccount(FH20(dev::toHexPrefixed(dev::h160(c_badAccount)))).balance().asString() ==
+                dev::toCompactHexPrefixed(c_badAccount, 1));
+}
+
+BOOST_AUTO_TEST_CASE(blockHeader_typedEquality)
+{
+    string const str = R"(
+    {
+        "bloom" : "0x00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+        "coinbase" : "0x8888f1f195afa192cfee860698584c030f4c9db1",
+        "difficulty" : "0x020000",
+        "extraData" : "0x42",
+        "gasLimit" : "0x7fffffffffffffff",
+        "gasUsed" : "0x5208",
+        "hash" : "0x847536e7d3904bda73f001fe77aca7367b7c315bef7c700f61f2e05f5b471f69",
+        "mixHash" : "0x0000000000000000000000000000000000000000000000000000000000000000",
+        "nonce" : "0x0000000000000000",
+        "number" : "0x01",
+        "parentHash" : "0xef2e504cf630cee6a2dc9005096c1b069c480e94d0e7ba0ef0b5265ab63d5ddb",
+        "receiptTrie" : "0x056b23fbba480696b65fe5a59b8f2148a1299103c4f57df839233af2cf4ca2d2",
+        "stateRoot" : "0xaf6f8d5679bb2df0688ff6067ed389928ca945569e5e22b3433fce09bb8f5e54",
+        "timestamp" : "0x54c99069",
+        "transactionsTrie" : "0xc33a0be2fd6c2ee1701d2adbba07b9eb9d7e3e881f2b5cae34d3379f2ce31301",
+        "uncleHash" : "0x1dcc4de8dec75d7aab85b567b6ccd41ad312451b948a7413f0a142fd40d49347",
+        "baseFeePerGas" : "0x0e"
+    })";
+    spDataObject data = ConvertJsoncppStringToData(str);
+    spBlockHeader const header = readBlockHeader(data);
+    spBlockHeader const copy = readBlockHeader(header->asDataObject());
+    BOOST_CHECK(header.getCContent() == copy.getCContent());
+    BOOST_CHECK(header->asDataObject()->asJson(0, false) == copy->asDataObject()->asJson(0, false));
+
+    spBlockHeader rlpCopy = readBlockHeader(dev::RLP(header->asRLPStream().out()));
+    (*rlpCopy).setHeaderHash(header->hash());
+    BOOST_CHECK(header.getCContent() == rlpCopy.getCContent());
+
+    spBlockHeader changed = readBlockHeader(data);
+    (*changed).setGasUsed(VALUE(0x5209));
+    BOOST_CHECK(header.getCContent() != changed.getCContent());
+
+    // Same number with a leading zero byte is a different header
+    spDataObject bigintData(new DataObject());
+    (*bigintData).copyFrom(data.getCContent());
+    (*bigintData)["gasUsed"] = "0x:bigint 0x005208";
+    spBlockHeader const bigint = readBlockHeader(bigintData);
+    BOOST_CHECK(bigint->gasUsed() == header->gasUsed());
+    BOOST_CHECK(header.getCContent() != bigint.getCContent());
+
+    (*data).removeKey("baseFeePerGas");
+    spBlockHeader const legacy = readBlockHeader(data);
+    BOOST_CHECK(legacy->type() == BlockType::BlockHeaderLegacy);
+    BOOST_CHECK(header.getCContent() != legacy.getCContent());
+}
+
+BOOST_AUTO_TEST_CASE(rlp_listIndexAndPresizedList)
+{
+    RLPStream plain(3);
+    plain << u256(1) << bytes(60, 0xab);
+    plain.appendList(2) << u256(2) << u256(3);
+
+    // 0x01, 0xb83c + 60 bytes, 0xc20203
+    RLPStream presized;
+    presized.appendList(3, 1 + 62 + RLPStream::listSize(2));
+    presized << u256(1) << bytes(60, 0xab);
+    presized.appendList(2, 2) << u256(2) << u256(3);
+    BOOST_CHECK(presized.out() == plain.out());
+
+    RLPStream mismatch;
+    mismatch.appendList(2, 5);
+    mismatch << u256(1);
+    BOOST_CHECK_THROW(mismatch << u256(2), RLPException);
+
+    RLP const rlp(plain.out());
+    RLPList const items(rlp);
+    BOOST_REQUIRE(items.size() == 3);
+    BOOST_CHECK(RLPList(items[2]).size() == 2);
+    BOOST_CHECK(items[2][1].toInt<unsigned>() == 3);
+    BOOST_CHECK(items[1].toBytes() == bytes(60, 0xab));
+    BOOST_CHECK(items[0].toInt<unsigned>() == 1);
+    BOOST_CHECK(items[3].isNull());
+    BOOST_CHECK(RLPList(items[0]).size() == 0);
+
+    bytes buffer = plain.out();
+    buffer.reserve(1024);
+    RLPStream reused(std::move(buffer));
+    BOOST_CHECK(reused.out().empty());
+    BOOST_CHECK(reused.out().capacity() >= 1024);
+    reused.appendList(3, 1 + 62 + RLPStream::listSize(2));
+    reused << u256(1) << bytes(60, 0xab);
+    reused.appendList(2, 2) << u256(2) << u256(3);
+    BOOST_CHECK(reused.out() == plain.out());
+}
+
+namespace
+{
+bool sameRecord(VMLogRecord const& _a, VMLogRecord const& _b)
+{
+    if (_a.isShort != _b.isShort || _a.error != _b.error)
+        return false;
+    if (_a.isShort)
+        return true;
+    return _a.pc == _b.pc && _a.op == _b.op && _a.gas->asBigInt() == _b.gas->asBigInt() &&
+           _a.gasCost->asBigInt() == _b.gasCost->asBigInt() && _a.memSize == _b.memSize && _a.stack == _b.stack &&
+           _a.depth == _b.depth && _a.refund->asBigInt() == _b.refund->asBigInt() && _a.opName == _b.opName &&
+           _a.memory->asString() == _b.memory->asString() && _a.returnData->asString() == _b.returnData->asString();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(vmtrace_parseLines)
+{
+    vector<string> const lines = {
+        R"({"pc":0,"op":96,"gas":"0x5c878","gasCost":"0x3","memory":"0x","memSize":0,"stack":[],"returnStack":[],"returnData":null,"depth":1,"refund":0,"opName":"PUSH1","error":""})",
+        R"({"pc":2,"op":85,"gas":"0x5c875","gasCost":"0x4e20","memSize":32,"stack":["0x1","0x2"],"depth":2,"refund":4800,"opName":"SSTORE","memory":"0x0102","returnData":"0x05"})",
+        R"({ "pc" : 3, "op" : 243, "gas" : "0x10", "gasCost" : "0x0", "memSize" : 0, "stack" : [ "0x0" , "0x20" ], "depth" : 1, "refund" : 0, "opName" : "RETURN", "memory" : ["01", "02"] })",
+        R"({"pc":4,"op":254,"gas":"0x0","gasCost":"0x0","memSize":0,"stack":[],"depth":1,"refund":0,"opName":"INVALID","error":"bad \"opcode\""})",
+        R"({"output":"","gasUsed":"0x5208","time":1434,"error":"out of gas"})",
+        R"({"output":"0x","gasUsed":"0x0"})"};
+
+    VMTraceLog fast;
+    VMTraceLog slow;
+    string data;
+    for (auto const& line : lines)
+    {
+        data += line + "\n\n";
+        slow.append(VMLogRecord(ConvertJsoncppStringToData(line)));
+    }
+    BOOST_CHECK(fast.read(data));
+    BOOST_REQUIRE(fast.size() == lines.size());
+    BOOST_REQUIRE(slow.size() == lines.size());
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        BOOST_CHECK(fast.isShort(i) == slow.isShort(i));
+        BOOST_CHECK(fast.op(i) == slow.op(i));
+        BOOST_CHECK_MESSAGE(sameRecord(fast.record(i), slow.record(i)), "Trace line " + test::fto_string(i));
+    }
+    BOOST_CHECK(fast.record(1).stack.at(1) == "0x2");
+    BOOST_CHECK(fast.record(2).memory->asString() == "0x0102");
+    BOOST_CHECK(fast.record(3).error == R"(bad \"opcode\")");
+
+    // pc wider than 32 bits is kept as is
+    VMTraceLog widePc;
+    BOOST_CHECK(widePc.read(R"({"pc":4294967296,"op":0,"gas":"0x0","gasCost":"0x0","memSize":0,"stack":[],"depth":1,"refund":0,"opName":"STOP"})"));
+    BOOST_REQUIRE(widePc.size() == 1);
+    BOOST_CHECK(widePc.record(0).pc == 4294967296);
+
+    VMTraceLog limited;
+    BOOST_CHECK(!limited.read(data, 2));
+    BOOST_CHECK(limited.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(vmtrace_mappedTrace)
+{
+    size_t const c_lines = 300;
+    fs::path const file = fs::temp_directory_path() / fs::unique_path("retesteth-vmtrace-%%%%%%.jsonl");
+    {
+        fs::ofstream out(file);
+        for (size_t i = 0; i < c_lines; i++)
+            out << R"({"pc":)" << i << R"(,"op":96,"gas":"0x5c878","gasCost":"0x3","memory":"0x","memSize":0,)"
+                << R"("stack":["0x)" << dev::toCompactHex(i + 1) << R"(","0xff"],"returnStack":[],"returnData":null,"depth":1,"refund":0,"opName":"PUSH1"})"
+                << "\n";
+        out << R"({"output":"","gasUsed":"0x5208","time":1434,"error":""})" << "\n";
+    }
+
+    VMTraceLog log;
+    {
+        dev::MappedFile const mapped(file);
+        log.read(mapped.view());
+    }
+
+    vector<VMLogRecord> records;
+    {
+        fs::ifstream in(file);
+        string line;
+        while (getline(in, line))
+            records.emplace_back(VMLogRecord(ConvertJsoncppStringToData(line)));
+    }
+    fs::remove(file);
+
+    BOOST_REQUIRE(log.size() == c_lines + 1);
+    BOOST_REQUIRE(records.size() == c_lines + 1);
+    for (size_t i = 0; i < log.size(); i++)
+        BOOST_CHECK_MESSAGE(sameRecord(log.record(i), records.at(i)), "Trace line " + test::fto_string(i));
+    BOOST_CHECK(log.isShort(c_lines));
+    BOOST_CHECK(log.record(c_lines - 1).stack.at(0) == "0x" + dev::toCompactHex(c_lines));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -374,4 +374,15 @@ BOOST_AUTO_TEST_CASE(expectIndexesArrayValueNotFound)
     }
 }
 
+BOOST_AUTO_TEST_CASE(expectNetworksMemoized)
+{
+    ClientConfig const& cfg = Options::getCurrentConfig();
+    for (auto const& nets : vector<set<string>>{{">=Berlin"}, {"<Berlin"}, {"Frontier", ">=London"}, {"<=Berlin", ">Berlin"}})
+    {
+        vector<FORK> expected;
+        ClientConfig::translateNetworks(nets, cfg.cfgFile().forks(), expected);
+        BOOST_CHECK(cfg.translateNetworks(nets) == expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,6 @@
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <thread>
 
 using namespace std;
 using namespace dev;
@@ -16,6 +17,7 @@ BOOST_AUTO_TEST_CASE(options_initdefault)
     BOOST_CHECK(opt.get().blockLimit == 0);
     BOOST_CHECK(opt.get().checkhash == false);
     BOOST_CHECK(opt.get().clients.initialized() == false);
+    BOOST_CHECK(opt.get().concurrentClients == false);
     BOOST_CHECK(std::vector<string>(opt.get().clients).empty() == true);
     BOOST_CHECK(opt.get().datadir.empty() == true);
     BOOST_CHECK(opt.get().enableClientsOutput == false);
@@ -294,4 +296,39 @@ BOOST_AUTO_TEST_CASE(options_statediff_froktofork)
     }
 }
 
+BOOST_AUTO_TEST_CASE(options_concurrentClientsFilltests)
+{
+    try
+    {
+        const char* argv[] = {"./retesteth", "--", "--concurrentclients", "--filltests"};
+        TestOptions opt(std::size(argv), argv);
+        BOOST_ERROR("Expected Exception!");
+    }
+    catch (Options::InvalidOption const&)
+    {
+    }
+}
+
+BOOST_AUTO_TEST_CASE(options_taskConfigScope)
+{
+    auto& dopt = Options::getDynamicOptions();
+    auto const& config = dopt.getClientConfigs().at(0);
+    dopt.setCurrentConfig(config);
+
+    // A thread sees the config of its task scope, the scope is restored on exit
+    bool threadSawConfig = false;
+    bool threadRestored = false;
+    std::thread task([&]() {
+        {
+            Options::DynamicOptions::TaskConfigScope scope(config);
+            threadSawConfig = &dopt.getCurrentConfig() == &config;
+        }
+        threadRestored = dopt.currentConfigIsSet() && &dopt.getCurrentConfig() == &config;
+    });
+    task.join();
+    BOOST_CHECK(threadSawConfig);
+    BOOST_CHECK(threadRestored);
+    BOOST_CHECK(&dopt.getCurrentConfig() == &config);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
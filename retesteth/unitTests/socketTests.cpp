@@ -0,0 +1,416 @@
+/** @file socketTests.cpp
+ * Unit tests for RPC socket transport against a local stub json-rpc server.
+ */
+
+#include <libdataobj/ConvertFile.h>
+#include <retesteth/EthChecks.h>
+#include <retesteth/Options.h>
+#include <retesteth/helpers/TestHelper.h>
+#include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/ClientReadiness.h>
+#include <retesteth/session/ClientUsage.h>
+#include <retesteth/session/RPCImpl.h>
+#include <retesteth/session/Socket.h>
+#include <retesteth/unitTests/testSuites.h>
+#include <poll.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+using namespace std;
+using namespace test;
+using namespace test::session;
+using namespace test::unittests;
+
+namespace
+{
+// Minimal HTTP/1.1 json-rpc server on 127.0.0.1 that answers every request with the same result
+// or with the reply of the handler to the request body
+// Connections are kept alive, accepted connections are counted
+class StubRpcServer
+{
+public:
+    using Handler = std::function<string(string const& _body)>;
+    StubRpcServer(string const& _reply = c_result) : m_reply(_reply) { start(); }
+    StubRpcServer(Handler const& _handler) : m_handler(_handler) { start(); }
+
+    ~StubRpcServer()
+    {
+        m_stop = true;
+        m_thread.join();
+        close(m_listen);
+    }
+
+    string address() const { return "127.0.0.1:" + to_string(m_port); }
+    size_t connections() const { return m_connections; }
+    static string const& result() { return c_result; }
+
+private:
+    void start()
+    {
+        m_listen = socket(AF_INET, SOCK_STREAM, 0);
+        int const reuse = 1;
+        setsockopt(m_listen, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        struct sockaddr_in sin;
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = inet_addr("127.0.0.1");
+        sin.sin_port = 0;
+        if (bind(m_listen, reinterpret_cast<struct sockaddr const*>(&sin), sizeof(sin)) < 0 || listen(m_listen, 16) < 0)
+            ETH_FAIL_MESSAGE("StubRpcServer: can't listen on 127.0.0.1");
+
+        socklen_t len = sizeof(sin);
+        getsockname(m_listen, reinterpret_cast<struct sockaddr*>(&sin), &len);
+        m_port = ntohs(sin.sin_port);
+        m_thread = std::thread(&StubRpcServer::run, this);
+    }
+
+    void run()
+    {
+        vector<pollfd> fds = {{m_listen, POLLIN, 0}};
+        map<int, string> buffers;
+        while (!m_stop)
+        {
+            if (poll(fds.data(), fds.size(), 20) <= 0)
+                continue;
+
+            vector<pollfd> next = {fds.at(0)};
+            if (fds.at(0).revents & POLLIN)
+            {
+                int const client = accept(m_listen, nullptr, nullptr);
+                if (client >= 0)
+                {
+                    m_connections++;
+                    next.push_back({client, POLLIN, 0});
+                }
+            }
+
+            for (size_t i = 1; i < fds.size(); i++)
+            {
+                int const client = fds.at(i).fd;
+                if (fds.at(i).revents & (POLLIN | POLLHUP | POLLERR))
+                {
+                    char buf[65536];
+                    ssize_t const ret = recv(client, buf, sizeof(buf), 0);
+                    if (ret <= 0)
+                    {
+                        close(client);
+                        buffers.erase(client);
+                        continue;
+                    }
+                    buffers[client].append(buf, ret);
+                    answerCompleteRequests(client, buffers[client]);
+                }
+                next.push_back(fds.at(i));
+            }
+            fds.swap(next);
+        }
+        for (size_t i = 1; i < fds.size(); i++)
+            close(fds.at(i).fd);
+    }
+
+    void answerCompleteRequests(int _client, string& _buffer) const
+    {
+        static string const c_lengthHeader = "content-length:";
+        while (true)
+        {
+            size_t const headerEnd = _buffer.find("\r\n\r\n");
+            if (headerEnd == string::npos)
+                return;
+
+            string headers = _buffer.substr(0, headerEnd);
+            std::transform(headers.begin(), headers.end(), headers.begin(), ::tolower);
+            size_t const lengthPos = headers.find(c_lengthHeader);
+            size_t const bodyLength = lengthPos == string::npos ? 0 : atoi(headers.c_str() + lengthPos + c_lengthHeader.size());
+            if (_buffer.size() < headerEnd + 4 + bodyLength)
+                return;
+            string const reply = m_handler ? m_handler(_buffer.substr(headerEnd + 4, bodyLength)) : m_reply;
+            _buffer.erase(0, headerEnd + 4 + bodyLength);
+
+            string const response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                                    to_string(reply.size()) + "\r\n\r\n" + reply;
+            send(_client, response.c_str(), response.size(), MSG_NOSIGNAL);
+        }
+    }
+
+    static string const c_result;
+    string const m_reply;
+    Handler const m_handler;
+    int m_listen;
+    int m_port;
+    std::thread m_thread;
+    std::atomic<bool> m_stop = false;
+    std::atomic<size_t> m_connections = 0;
+};
+string const StubRpcServer::c_result = R"({"jsonrpc":"2.0","id":1,"result":"0x01"})";
+
+// Accounts with balance 0x0a, nonce 0x01, code 0x6001 and storage slots 1.._slots with the value 2 * slot
+// Replies to a batch in the reverse order, storage comes in pages of the requested size
+string answerAccountBatch(string const& _body, size_t _slots)
+{
+    spDataObject const calls = ConvertJsoncppStringToData(_body);
+    string reply;
+    for (auto it = calls->getSubObjects().rbegin(); it != calls->getSubObjects().rend(); it++)
+    {
+        DataObject const& call = it->getCContent();
+        string const& method = call.atKey("method").asString();
+        string result = R"("0x0a")";
+        if (method == "eth_getTransactionCount")
+            result = R"("0x01")";
+        else if (method == "eth_getCode")
+            result = R"("0x6001")";
+        else if (method == "debug_storageRangeAt")
+        {
+            size_t const begin = max<size_t>(1, size_t(dev::u256(dev::h256(call.atKey("params").at(3).asString()))));
+            size_t const end = min<size_t>(_slots + 1, begin + call.atKey("params").at(4).asInt());
+            result = R"({"complete":)" + string(end > _slots ? "true" : "false") + R"(,"storage":{)";
+            for (size_t slot = begin; slot < end; slot++)
+                result += string(slot == begin ? "" : ",") + "\"" + dev::toHexPrefixed(dev::h256(dev::u256(slot))) + "\":{\"key\":\"" +
+                          dev::toCompactHexPrefixed(slot, 1) + "\",\"value\":\"" + dev::toCompactHexPrefixed(slot * 2, 1) + "\"}";
+            result += "}";
+            if (end <= _slots)
+                result += R"(,"nextKey":")" + dev::toHexPrefixed(dev::h256(dev::u256(end))) + "\"";
+            result += "}";
+        }
+        reply += string(reply.empty() ? "[" : ",") + R"({"jsonrpc":"2.0","id":)" + to_string(call.atKey("id").asInt()) +
+                 R"(,"result":)" + result + "}";
+    }
+    return reply + "]";
+}
+
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(SocketSuite, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(socket_tcpKeepAlive)
+{
+    StubRpcServer server;
+    size_t const c_requests = 1000;
+    string const request = R"({"jsonrpc":"2.0","method":"eth_getBalance","params":["0x1000000000000000000000000000000000000000","0x01"],"id":1})";
+
+    {
+        Socket socket(Socket::TCP, server.address());
+        for (size_t i = 0; i < c_requests; i++)
+        {
+            JsonObjectValidator validator;
+            string const response = socket.sendRequest(request, validator);
+            if (response != StubRpcServer::result())
+            {
+                BOOST_ERROR("Unexpected stub server response: " + response);
+                break;
+            }
+        }
+    }
+
+    // Socket opens its own connection on construction, all http requests go through one more
+    BOOST_CHECK(server.connections() <= 2);
+}
+
+BOOST_AUTO_TEST_CASE(socket_tcpBigRequest)
+{
+    StubRpcServer server;
+    Socket socket(Socket::TCP, server.address());
+    string const request = R"({"jsonrpc":"2.0","method":"test_importRawBlock","params":["0x)" + string(200000, 'a') + R"("],"id":1})";
+    for (size_t i = 0; i < 3; i++)
+    {
+        JsonObjectValidator validator;
+        BOOST_CHECK(socket.sendRequest(request, validator) == StubRpcServer::result());
+    }
+    BOOST_CHECK(server.connections() <= 2);
+}
+
+BOOST_AUTO_TEST_CASE(socket_tcpBatchResponse)
+{
+    string const reply = R"([{"jsonrpc":"2.0","id":2,"result":{"a":"0x01"}},{"jsonrpc":"2.0","id":1,"result":"0x02"}])";
+    StubRpcServer server(reply);
+    Socket socket(Socket::TCP, server.address());
+    string const request = R"([{"jsonrpc":"2.0","method":"eth_getBalance","params":[],"id":1},)"
+                           R"({"jsonrpc":"2.0","method":"eth_getCode","params":[],"id":2}])";
+    JsonObjectValidator validator;
+    BOOST_CHECK(socket.sendRequest(request, validator) == reply);
+}
+
+BOOST_AUTO_TEST_CASE(socket_rpcBatchRemoteAccounts)
+{
+    size_t const c_slots = 30;
+    std::atomic<size_t> batches = 0;
+    StubRpcServer server([&batches, c_slots](string const& _body) {
+        batches++;
+        return answerAccountBatch(_body, c_slots);
+    });
+
+    TempClientConfig const client(R"({
+        "name" : "Batch client on TCP",
+        "socketType" : "tcp",
+        "socketAddress" : [")" + server.address() + R"("],
+        "batchRequests" : true,
+        "forks" : ["Frontier", "Homestead"],
+        "additionalForks" : [],
+        "exceptions" : {}
+    })");
+    Options::DynamicOptions::TaskConfigScope scope(client.config());
+
+    RPCImpl session(Socket::TCP, server.address());
+    vector<spDataObject> const results = session.rpcBatch({{"eth_getBalance", {}}, {"eth_getCode", {}}});
+    BOOST_REQUIRE(results.size() == 2);
+    BOOST_CHECK(results.at(0)->asString() == "0x0a");
+    BOOST_CHECK(results.at(1)->asString() == "0x6001");
+
+    // Fields and the first storage page of both accounts in one batch, the second pages in the next one
+    batches = 0;
+    vector<FH20> const addresses = {
+        FH20("0x095e7baea6a6c7c4c2dfeb977efac326af552d87"), FH20("0xa94f5374fce5edbc8e2a8697c15331677e6ebf0b")};
+    auto const accounts = session.getRemoteAccounts(addresses, VALUE(1), VALUE(0));
+    BOOST_CHECK(batches == 2);
+    BOOST_REQUIRE(accounts.size() == 2);
+    for (size_t i = 0; i < accounts.size(); i++)
+    {
+        auto const& account = accounts.at(i);
+        BOOST_CHECK(account.address() == addresses.at(i));
+        BOOST_CHECK(account.balance().asString() == "0x0a");
+        BOOST_CHECK(account.nonce().asString() == "0x01");
+        BOOST_CHECK(account.code().asString() == "0x6001");
+        BOOST_CHECK(account.storage().size() == c_slots);
+        BOOST_CHECK(account.storage().atKey(dev::u256(c_slots)).asString() == dev::toCompactHexPrefixed(c_slots * 2, 1));
+    }
+
+    // Batches are timed per call under the name of their first method
+    auto const latency = session.takeRPCLatency();
+    BOOST_CHECK(!latency.empty());
+    for (auto const& el : latency)
+        BOOST_CHECK(el.first.substr(0, 6) == "batch:");
+    BOOST_CHECK(session.takeRPCLatency().empty());
+}
+
+BOOST_AUTO_TEST_CASE(socket_jsonValidatorChunks)
+{
+    // Array reply delivered in pieces is complete only at the closing bracket
+    JsonObjectValidator validator;
+    validator.acceptResponse(R"( [{"id":1,"result":[1,)");
+    BOOST_CHECK(!validator.completeResponse());
+    validator.acceptResponse(R"(2]},{"id":2})");
+    BOOST_CHECK(!validator.completeResponse());
+    validator.acceptResponse(R"(]trailing)");
+    BOOST_CHECK(validator.completeResponse());
+    BOOST_CHECK(validator.getResponse() == R"( [{"id":1,"result":[1,2]},{"id":2}])");
+
+    // Single object reply (error on the whole batch) is read as well
+    JsonObjectValidator objectValidator;
+    objectValidator.acceptResponse(R"({"error":{"message":"batch"}})");
+    BOOST_CHECK(objectValidator.completeResponse());
+}
+
+BOOST_AUTO_TEST_CASE(socket_jsonValidatorStrings)
+{
+    // Braces inside strings and escaped quotes split between chunks
+    vector<string> const chunks = {R"({"a":"}]\)", R"(\",)", R"("b":"\)", R"("}",)", R"("c":"\\)", R"("}tail)"};
+    JsonObjectValidator validator;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        validator.acceptResponse(chunks.at(i));
+        BOOST_CHECK(validator.completeResponse() == (i + 1 == chunks.size()));
+    }
+    BOOST_CHECK(validator.getResponse() == R"({"a":"}]\\","b":"\"}","c":"\\"})");
+}
+
+BOOST_AUTO_TEST_CASE(socket_ipcBigResponse)
+{
+    string const path = "/tmp/retesteth-socketTests-" + to_string(getpid()) + ".ipc";
+    unlink(path.c_str());
+    int const listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un saun;
+    memset(&saun, 0, sizeof(saun));
+    saun.sun_family = AF_UNIX;
+    strcpy(saun.sun_path, path.c_str());
+    if (bind(listenSocket, reinterpret_cast<struct sockaddr const*>(&saun), sizeof(saun)) < 0 || listen(listenSocket, 1) < 0)
+        ETH_FAIL_MESSAGE("socket_ipcBigResponse: can't listen on " + path);
+
+    // Response like eth_getBlockByNumber with full transactions, sent in small pieces
+    string response = R"({"jsonrpc":"2.0","id":1,"result":{"transactions":[)";
+    for (size_t i = 0; i < 2000; i++)
+        response += string(i ? "," : "") + R"({"input":"0x)" + string(1000, 'a') + R"(","note":"{["]}"})";
+    response += "]}}";
+
+    std::thread server([listenSocket, &response]() {
+        int const client = accept(listenSocket, nullptr, nullptr);
+        char buf[4096];
+        recv(client, buf, sizeof(buf), 0);
+        for (size_t pos = 0; pos < response.size(); pos += 1000)
+            send(client, response.c_str() + pos, min<size_t>(1000, response.size() - pos), MSG_NOSIGNAL);
+        send(client, "{}", 2, MSG_NOSIGNAL);  // trailing bytes are not a part of the response
+        recv(client, buf, sizeof(buf), 0);
+        close(client);
+    });
+
+    {
+        Socket socket(Socket::IPC, path);
+        JsonObjectValidator validator;
+        string const reply = socket.sendRequest(R"({"jsonrpc":"2.0","method":"eth_getBlockByNumber","params":[],"id":1})", validator);
+        BOOST_CHECK(reply.size() == response.size());
+        BOOST_CHECK(reply == response);
+    }
+    server.join();
+    close(listenSocket);
+    unlink(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(socket_clientReadiness)
+{
+    string address;
+    {
+        StubRpcServer server;
+        address = server.address();
+        BOOST_CHECK(waitForClientVersion(Socket::TCP, address, std::chrono::seconds(5)));
+
+        // Configs may give the address as an http url with a host name
+        string const port = address.substr(address.find(':') + 1);
+        BOOST_CHECK(waitForClientVersion(Socket::TCP, "http://localhost:" + port + "/", std::chrono::seconds(5)));
+    }
+    BOOST_CHECK(waitForClientShutdown(Socket::TCP, address, std::chrono::seconds(5)));
+    BOOST_CHECK(!waitForClientVersion(Socket::TCP, address, std::chrono::milliseconds(100)));
+
+    // File created by another process while waiting
+    string const path = "/tmp/retesteth-socketTests-" + to_string(getpid()) + ".ready";
+    unlink(path.c_str());
+    std::thread creator([&path]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        fclose(fopen(path.c_str(), "w"));
+    });
+    BOOST_CHECK(waitForFile(path, std::chrono::seconds(5)));
+    creator.join();
+    unlink(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(socket_clientUsage)
+{
+    // The command name may hold spaces and brackets
+    string const stat = "4242 (my (client) 1) S 4200 4242 4242 0 -1 4194560 1 0 0 0 0 0 0 0 20 0 1 0 100 1000000 "
+                        "250 18446744073709551615";
+    auto const parsed = parseProcStat(stat, 4);
+    BOOST_REQUIRE(parsed.has_value());
+    BOOST_CHECK(parsed->ppid == 4200);
+    BOOST_CHECK(parsed->rssKB == 1000);
+    BOOST_CHECK(!parseProcStat("4242 (client) S 4200 4242", 4).has_value());
+    BOOST_CHECK(!parseProcStat("4242 client", 4).has_value());
+
+    // Start script with the client and a helper of the client, the unrelated process is not counted
+    std::map<int, ProcStat> const procs = {{10, {1, 100}}, {11, {10, 2000}}, {12, {11, 30}}, {13, {1, 5000}}};
+    BOOST_CHECK(processTreeRSS(procs, 10) == 2130);
+    BOOST_CHECK(processTreeRSS(procs, 99) == 0);
+    BOOST_CHECK(processTreeRSS(readProcStats(), getpid()) > 0);
+
+    ClientUsage const baseline{100 * 1024, {{"eth_getBalance", 100}}};
+    BOOST_CHECK(clientUsageDegraded(baseline, {150 * 1024, {{"eth_getBalance", 700}}}, 64, 8).empty());
+    BOOST_CHECK(clientUsageDegraded(baseline, {200 * 1024, {}}, 64, 8) == "memory growth");
+    BOOST_CHECK(clientUsageDegraded(baseline, {200 * 1024, {}}, 0, 8).empty());
+    BOOST_CHECK(clientUsageDegraded(baseline, {100 * 1024, {{"eth_getBalance", 900}}}, 64, 8) == "latency growth");
+    BOOST_CHECK(clientUsageDegraded(baseline, {100 * 1024, {{"eth_getBalance", 900}}}, 64, 0).empty());
+
+    // A heavy method that was not in the baseline is not compared with the cheap ones
+    BOOST_CHECK(clientUsageDegraded(baseline, {100 * 1024, {{"test_mineBlocks", 50000}}}, 64, 8).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -206,6 +206,82 @@ BOOST_AUTO_TEST_CASE(ssz_bitlist)
         runSerializationCheck(test);
 }
 
+BOOST_AUTO_TEST_CASE(ssz_container)
+{
+    // {a: uint16, b: List[uint8, N], c: uint8}
+    SSZStream stream;
+    Container container;
+    container.addFixed(ssz::uint16(0x1234).data).addVariable({1, 2, 3}).addFixed(ssz::uint8(5).data);
+    stream << container;
+    BOOST_CHECK(dev::toHexPrefixed(stream.data()) == "0x34120700000005010203");
+
+    SSZStream basics;
+    basics << true << uint16_t(0x0102) << ssz::uint32(7);
+    BOOST_CHECK(dev::toHexPrefixed(basics.data()) == "0x01020107000000");
+}
+
+BOOST_AUTO_TEST_CASE(ssz_hashTreeRoot)
+{
+    auto const hex = [](Bytes32 const& _root) { return dev::toHexPrefixed(_root); };
+    bytes data200(200);
+    for (size_t i = 0; i < data200.size(); i++)
+        data200[i] = (i * 7) & 0xff;
+    BOOST_CHECK(hex(merkle::sha256(bytes{'a', 'b', 'c'})) == "0xba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    BOOST_CHECK(hex(merkle::sha256(data200)) == "0xb531abd8dae7232c861ac9f50aff9952d29c8d4c3772551cc5bce5d39d2cd08d");
+    BOOST_CHECK(hex(merkle::zeroHash(1)) == "0xf5a5fd42d16a20302798ef6ed309979b43003d2320d9f0e8ea9831a92759fb4b");
+
+    // Withdrawal {index: uint64, validatorIndex: uint64, address: Bytes20, amount: uint64}
+    Bytes32 const withdrawal = hashTreeRootContainer({hashTreeRoot(ssz::uint64(15)), hashTreeRoot(ssz::uint64(0x112233)),
+        hashTreeRootBasicVector(stringToBytes("0x8888f1f195afa192cfee860698584c030f4c9db1")),
+        hashTreeRoot(ssz::uint64(32000000000))});
+    BOOST_CHECK(hex(withdrawal) == "0xc4d6649b2d5e96c9b2327f3d060bc95d29807a768b86c1929adc5e069a03c159");
+
+    BitVector const bitvector = {true, false, true, true, false, false, false, true, true, true};
+    BOOST_CHECK(hex(hashTreeRoot(bitvector)) == "0x8d03000000000000000000000000000000000000000000000000000000000000");
+    BitList bitlist(5, true);
+    bitlist.resize(305, false);
+    BOOST_CHECK(hex(hashTreeRoot(bitlist, 2048)) == "0x35d610a5cc90d113a83f5271871a672d4cf9db66f81a76c55c156f3771625c9c");
+    BOOST_CHECK_THROW(hashTreeRoot(bitlist, 300), std::invalid_argument);
+
+    SSZStream list;
+    for (uint64_t i = 0; i < 10; i++)
+        list << i * 1000003;
+    BOOST_CHECK(hex(hashTreeRootBasicList(list.data(), 8, 1024)) == "0x2093d11f3a140b1c38be89c87478ec28d66ec7816f8a1ed7ad62d070f7c1fd54");
+    BOOST_CHECK(hex(hashTreeRootBasicList({}, 8, 1024)) == "0x76859427a26d01891b23e04cfc6342b72e4f52caca9d7535d16cd7f36b5d52bb");
+
+    // Several full layers of pairs and an odd tail on each layer
+    merkle::Chunks roots;
+    for (uint64_t i = 0; i < 40000; i++)
+        roots.push_back(merkle::sha256(encoding::integralToBytes(i)));
+    string const bigRoot = "0x664d0fde4e757a3642b3d9abb849a9f5bcaa4e3aff49470b309ff710f811c079";
+    BOOST_CHECK(hex(merkle::merkleize(roots, 65536)) == bigRoot);
+    BOOST_CHECK(hex(hashTreeRootList({roots.begin(), roots.begin() + 3}, 16)) ==
+                "0x63789b03ec46d7b0e83eede7d631b80ccbe2eb0abf2039ed7f332b7f15d9ad09");
+    BOOST_CHECK_THROW(merkle::merkleize(roots, 1024), std::invalid_argument);
+
+    // Cached tree rehashes the changed paths to the same root
+    merkle::MerkleTree tree({roots.begin(), roots.begin() + 39990}, 65536);
+    Bytes32 const first = roots.at(0);
+    tree.setChunk(0, Bytes32{});
+    BOOST_CHECK(tree.root() != merkle::merkleize(roots, 65536));
+    tree.setChunk(0, first);
+    for (size_t i = 39990; i < roots.size(); i++)
+        tree.pushChunk(roots.at(i));
+    BOOST_CHECK(tree.size() == roots.size());
+    BOOST_CHECK(hex(tree.root()) == bigRoot);
+
+    // Tree built from no chunks grows by pushChunk
+    merkle::MerkleTree empty({}, 16);
+    BOOST_CHECK(empty.size() == 0);
+    BOOST_CHECK(empty.root() == merkle::zeroHash(4));
+    for (size_t i = 0; i < 3; i++)
+    {
+        empty.pushChunk(roots.at(i));
+        BOOST_CHECK(empty.root() == merkle::merkleize({roots.begin(), roots.begin() + i + 1}, 16));
+    }
+    BOOST_CHECK(merkle::MerkleTree({}, 1).root() == merkle::zeroHash(0));
+}
+
 // https://eth2book.info/bellatrix/part2/building_blocks/ssz/
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -2,7 +2,10 @@
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/testStructures/types/Ethereum/TrieRoots.h>
 #include <retesteth/testStructures/types/Ethereum/Transactions/TransactionReader.h>
+#include <retesteth/unitTests/testSuites.h>
+#include <libdataobj/ConvertFile.h>
 
 using namespace std;
 using namespace dev;
@@ -607,4 +610,46 @@ BOOST_AUTO_TEST_CASE(transactionLegacy_bigint_serialization)
     ETH_ERROR_REQUIRE_MESSAGE(spTr->hash() == spTr2->hash(), "Transaction deserialized hash is different (before != after) " + spTr->hash().asString() + " != " + spTr2->hash().asString())
 }
 
+BOOST_AUTO_TEST_CASE(transactionsRoot_sampleBlockchainTest)
+{
+    spDataObject const filled = ConvertJsoncppStringToData(test::unittests::c_sampleBlockchainTestFilled);
+    for (auto const& block : filled->getSubObjects().at(0)->atKey("blocks").getSubObjects())
+    {
+        bytes const blockRlp = fromHex(block->atKey("rlp").asString());
+        vector<spTransaction> transactions;
+        for (auto const& tr : RLP(blockRlp)[1])
+            transactions.emplace_back(readTransaction(tr));
+        BOOST_CHECK(transactionsRoot(transactions) == FH32(block->atKey("blockHeader").atKey("transactionsTrie")));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(receiptsRoot_sampleBlockchainTest)
+{
+    string const bloom = "0x" + string(512, '0');
+    auto const receipt = [&bloom](string const& _cumulativeGas, string const& _logs = "[]", string const& _type = "0x0") {
+        return ToolResponseReceipt(ConvertJsoncppStringToData(R"({"type" : ")" + _type + R"(", "root" : "0x", "status" : "0x1",
+            "cumulativeGasUsed" : ")" + _cumulativeGas + R"(", "logsBloom" : ")" + bloom + R"(", "logs" : )" + _logs + R"(,
+            "transactionHash" : "0x0000000000000000000000000000000000000000000000000000000000000001", "gasUsed" : "0xa8f1"})"));
+    };
+
+    // receiptTrie of the blocks of c_sampleBlockchainTestFilled, every transaction uses 0xa8f1 gas
+    BOOST_CHECK(receiptsRoot({}).asString() == "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421");
+    BOOST_CHECK(receiptsRoot({receipt("0xa8f1")}).asString() == "0x9ee2c0569d7ec2e49918c6297bfccbf962c22f5b0a4cd2f5c8a6d1a143f28bee");
+    BOOST_CHECK(receiptsRoot({receipt("0xa8f1"), receipt("0x0151e2")}).asString() ==
+                "0x92cc400fe2f8cf6dd741b1eb472486daadf50174e14338dad9ee5db5f065c7cd");
+
+    // Typed receipt with a log
+    string const logs = R"([{"address" : "0x)" + string(40, '1') + R"(", "topics" : ["0x)" + string(64, '2') +
+                        R"("], "data" : "0x3344", "logIndex" : "0x0"}])";
+    string const encoded = "02f9014501825208b90100" + string(512, '0') + "f83cf83a94" + string(40, '1') + "e1a0" +
+                           string(64, '2') + "823344";
+    BOOST_CHECK(toHex(receipt("0x5208", logs, "0x2").consensusBytes()) == encoded);
+
+    // Receipts without the consensus fields can't be hashed
+    ToolResponseReceipt const partial(ConvertJsoncppStringToData(
+        R"({"transactionHash" : "0x0000000000000000000000000000000000000000000000000000000000000001", "gasUsed" : "0xa8f1"})"));
+    BOOST_CHECK(partial.consensusBytes().empty());
+    BOOST_CHECK_THROW(receiptsRoot({partial}), test::UpwardsException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
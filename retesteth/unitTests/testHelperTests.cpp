@@ -23,10 +23,16 @@
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <libdataobj/ConvertFile.h>
+#include <retesteth/testSuiteRunner/FilledTestIndex.h>
+#include <retesteth/testSuiteRunner/FillerHashIndex.h>
+#include <retesteth/testSuiteRunner/TestSuiteHelperFunctions.h>
+#include <thread>
 
 using namespace std;
 using namespace dev;
 using namespace test;
+namespace fs = boost::filesystem;
 
 namespace
 {
@@ -164,6 +170,33 @@ BOOST_AUTO_TEST_CASE(comapreForks_ZeroStep)
     compareFork(FORK("Homestead"), CMP::ge, FORK("Homestead")) == true);
 }
 
+BOOST_AUTO_TEST_CASE(compareForks_interned)
+{
+    string const name = "Homestead";
+    ETH_FAIL_REQUIRE(FORK(name) == FORK("Homestead"));
+    ETH_FAIL_REQUIRE(FORK(name).id() == FORK(name).id());
+    ETH_FAIL_REQUIRE(FORK("Homestead") != FORK("EIP150"));
+
+    // Ids are the same on every thread, also for a name seen first on another thread
+    size_t homesteadId = 0;
+    size_t newNameId = 0;
+    std::thread other([&homesteadId, &newNameId]() {
+        homesteadId = FORK("Homestead").id();
+        newNameId = FORK("ForkNameInternedOnThread").id();
+    });
+    other.join();
+    ETH_FAIL_REQUIRE(homesteadId == FORK("Homestead").id());
+    ETH_FAIL_REQUIRE(newNameId == FORK("ForkNameInternedOnThread").id());
+    ETH_FAIL_REQUIRE(newNameId != homesteadId);
+
+    auto const& cfg = Options::getCurrentConfig().cfgFile();
+    ETH_FAIL_REQUIRE(cfg.forkProgressionIndex(FORK("UnknownForkName")) == ClientConfigFile::c_forkNotInProgression);
+    ETH_FAIL_REQUIRE(cfg.forkHasFeature(FORK("London"), ForkFeature::EIP1559));
+    ETH_FAIL_REQUIRE(!cfg.forkHasFeature(FORK("Berlin"), ForkFeature::EIP1559));
+    ETH_FAIL_REQUIRE(!cfg.forkHasFeature(FORK("London"), ForkFeature::Merge));
+    ETH_FAIL_REQUIRE(!cfg.forkHasFeature(FORK("UnknownForkName"), ForkFeature::EIP1559));
+}
+
 BOOST_AUTO_TEST_CASE(translateNetworks_doubleNet)
 {
     set<string> rawnetworks = {"Frontier", "<Homestead"};
@@ -277,4 +310,119 @@ BOOST_AUTO_TEST_CASE(getTestSuggestions2)
     BOOST_CHECK(test::inArray(list, string("BCGeneralStateTests/stExample")));
 }
 
+BOOST_AUTO_TEST_CASE(fillerHashIndex_prefetch)
+{
+    fs::path const dir = fs::temp_directory_path() / fs::unique_path("retesteth-fillerhash-%%%%%%");
+    fs::create_directories(dir);
+    fs::path const filler = dir / "exampleFiller.yml";
+    fs::path const filled = dir / "example.json";
+    writeFile(filler, asBytes("example:\n  env:\n    currentNumber: 1\n"));
+    h256 const hash = testsuite::readFillerTestFile(filler).hash;
+    writeFile(filled, asBytes(R"({"example":{"_info":{"sourceHash":")" + hash.hex() +
+                              R"(","comment":"","filling-tool-version":"retesteth-0.3.1-shanghai"},"env":{}}})"));
+
+    // Not the index of the datadir
+    fs::path const indexFile = dir / "fillerHashIndex.json";
+    testsuite::FillerHashIndex index(indexFile);
+    index.prefetch({{filler, filled}});
+    BOOST_CHECK(!fs::exists(indexFile));
+    index.save();
+    BOOST_CHECK(fs::exists(indexFile));
+    BOOST_CHECK(index.fillerHash(filler, false) == hash);
+    BOOST_CHECK(!index.fillerHash(filler, true).has_value());
+    spDataObject const info = index.filledInfo(filled);
+    BOOST_REQUIRE(!info.isEmpty());
+    BOOST_CHECK(info->atKey("example").atKey("_info").atKey("sourceHash").asString() == hash.hex());
+    BOOST_CHECK(!info->atKey("example").atKey("_info").count("comment"));
+    BOOST_CHECK(testsuite::checkFillerHash(filled, filler) == false);
+
+    // Changed files are not taken from the index
+    writeFile(filled, asBytes(R"({"example":{"_info":{"sourceHash":"0x00"}}})"));
+    BOOST_CHECK(index.filledInfo(filled).isEmpty());
+    writeFile(filler, asBytes("example:\n  env:\n    currentNumber: 22\n"));
+    BOOST_CHECK(!index.fillerHash(filler, false).has_value());
+
+    // Removed tests are dropped from the saved index
+    fs::path const otherFiller = dir / "otherFiller.yml";
+    writeFile(otherFiller, asBytes("other:\n  env:\n    currentNumber: 1\n"));
+    fs::remove(filler);
+    fs::remove(filled);
+    index.prefetch({{otherFiller, dir / "other.json"}});
+    index.save();
+    string const saved = dev::contentsString(indexFile);
+    BOOST_CHECK(saved.find(otherFiller.string()) != string::npos);
+    BOOST_CHECK(saved.find(filler.string()) == string::npos);
+    BOOST_CHECK(saved.find(filled.string()) == string::npos);
+    fs::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(filledTestIndex_readTest)
+{
+    fs::path const dir = fs::temp_directory_path() / fs::unique_path("retesteth-filledindex-%%%%%%");
+    fs::create_directories(dir);
+    fs::path const filled = dir / "example.json";
+
+    spDataObject data = dataobject::ConvertJsoncppStringToData(R"({
+        "first_Berlin" : { "_info" : { "sourceHash" : "0x01", "generatedTestHash" : "0x02" }, "note" : "}{[" },
+        "second_London" : { "blocks" : [ { "rlp" : "0x]" } ], "_info" : { "sourceHash" : "0x03" } }
+    })");
+    string const json = data->asJson();
+    writeFile(filled, asBytes(json));
+    testsuite::FilledTestIndex::update(filled, data.getCContent(), json);
+
+    // The index is written once per directory on save, and read from memory until then
+    fs::path const other = dir / "other.json";
+    writeFile(other, asBytes(json));
+    testsuite::FilledTestIndex::update(other, data.getCContent(), json);
+    BOOST_CHECK(!fs::exists(dir / ".retesteth-index"));
+    BOOST_CHECK(testsuite::FilledTestIndex::read(other).has_value());
+    testsuite::FilledTestIndex::save();
+    BOOST_REQUIRE(fs::exists(dir / ".retesteth-index"));
+    spDataObject const index = dataobject::ConvertJsoncppStringToData(dev::contentsString(dir / ".retesteth-index"));
+    BOOST_CHECK(index->count("example.json") && index->count("other.json"));
+    BOOST_CHECK(index->atKey("other.json").atKey("tests").atKey("second_London").atKey("end").asString() ==
+                to_string(testsuite::FilledTestIndex::read(other)->at(1).end));
+
+    auto const records = testsuite::FilledTestIndex::read(filled);
+    BOOST_REQUIRE(records.has_value());
+    BOOST_REQUIRE(records->size() == 2);
+    BOOST_CHECK(records->at(0).name == "first_Berlin");
+    BOOST_CHECK(records->at(0).generatedTestHash == "0x02");
+    BOOST_CHECK(records->at(1).sourceHash == "0x03");
+
+    spDataObject const second = testsuite::FilledTestIndex::readTest(filled, "second_London");
+    BOOST_REQUIRE(!second.isEmpty());
+    BOOST_CHECK(second->getSubObjects().size() == 1);
+    BOOST_CHECK(second->atKey("second_London") == data->atKey("second_London"));
+    BOOST_CHECK(testsuite::FilledTestIndex::readTest(filled, "third").isEmpty());
+
+    // Stale index is not used
+    writeFile(filled, asBytes(json + "\n"));
+    BOOST_CHECK(!testsuite::FilledTestIndex::read(filled).has_value());
+    BOOST_CHECK(testsuite::FilledTestIndex::readTest(filled, "second_London").isEmpty());
+    fs::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(readJsonData_mappedAndSmallFiles)
+{
+    // Below and above the size where files get mapped
+    for (size_t const accounts : {4, 4000})
+    {
+        string json = "{\"test\":{";
+        for (size_t i = 0; i < accounts; i++)
+            json += (i ? "," : "") + string("\"") + dev::toCompactHexPrefixed(i + 1, 20) + "\":{\"balance\":\"0x01\"}";
+        json += "}}";
+
+        fs::path const file = fs::temp_directory_path() / fs::unique_path("retesteth-read-%%%%%%.json");
+        dev::writeFile(file, asBytes(json));
+        BOOST_CHECK(dev::contentsString(file) == json);
+        BOOST_CHECK(dev::MappedFile(file).view() == json);
+        spDataObject const data = test::readJsonData(file);
+        fs::remove(file);
+        BOOST_CHECK(data->atKey("test").getSubObjects().size() == accounts);
+        BOOST_CHECK(data->asJson(0, false) == json);
+    }
+    BOOST_CHECK(dev::MappedFile(fs::temp_directory_path() / "retesteth-missing-file.json").size() == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
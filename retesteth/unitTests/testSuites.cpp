@@ -3,17 +3,45 @@
 #include <retesteth/Options.h>
 #include <retesteth/helpers/TestHelper.h>
 #include <retesteth/helpers/TestOutputHelper.h>
+#include <retesteth/session/Session.h>
 #include <retesteth/testSuites/statetests/StateTests.h>
 #include <retesteth/testSuites/blockchain/BlockchainTests.h>
+#include <retesteth/testStructures/PrepareChainParams.h>
+#include <retesteth/testStructures/types/Ethereum/TrieRoots.h>
+#include <retesteth/testStructures/types/Ethereum/Transactions/TransactionReader.h>
 #include <retesteth/testStructures/types/StateTests/GeneralStateTest.h>
 #include <libdataobj/ConvertFile.h>
+#include <libdevcore/CommonIO.h>
 #include <libdevcore/SHA3.h>
+#include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <mutex>
 
 using namespace std;
 using namespace dev;
 using namespace test;
 using namespace test::unittests;
 using namespace test::teststruct;
+using namespace test::session;
+namespace fs = boost::filesystem;
+
+TempClientConfig::TempClientConfig(string const& _config)
+  : m_dataDir(fs::temp_directory_path() / fs::unique_path("retesteth-configs-%%%%%%"))
+{
+    // The default configs are shared with the loaded configs, a test does not have to set the current config
+    auto const& configs = Options::getDynamicOptions().getClientConfigs();
+    ETH_FAIL_REQUIRE_MESSAGE(configs.size() > 0, "TempClientConfig: no client configs loaded!");
+    fs::path const dataDir = configs.at(0).getConfigPath().parent_path().parent_path();
+    fs::create_directories(m_dataDir / "client");
+    fs::create_directory_symlink(dataDir / "default", m_dataDir / "default");
+    writeFile(m_dataDir / "client" / "config", asBytes(_config));
+    m_config = std::make_unique<ClientConfig>(m_dataDir / "client");
+}
+
+TempClientConfig::~TempClientConfig()
+{
+    fs::remove_all(m_dataDir);
+}
 
 static std::ostringstream strCout;
 std::streambuf* oldCoutStreamBuf;
@@ -323,5 +351,105 @@ BOOST_AUTO_TEST_CASE(run_StateTest_singlenet)
     BOOST_CHECK(strCout.str().find("fork: Shanghai") == string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(run_concurrentClients)
+{
+    string const mockConfig = R"({
+        "name" : "Mock t8n",
+        "socketType" : "mock-tool",
+        "socketAddress" : "mock",
+        "forks" : ["Frontier", "Homestead"],
+        "additionalForks" : [],
+        "exceptions" : {}
+    })";
+    TempClientConfig const first(mockConfig);
+    TempClientConfig const second(mockConfig);
+    std::vector<ClientConfig> const configs = {first.config(), second.config()};
+
+    // Every config opens a session and waits for the other one, run one after another they would time out
+    std::mutex mutex;
+    std::condition_variable started;
+    std::vector<ClientConfigID> seenConfigs;
+    std::vector<std::thread::id> sessionThreads;
+    size_t bothRunning = 0;
+    TestSuite::runFunctionForClientsConcurrently(configs, [&]() {
+        RPCSession::instance(std::this_thread::get_id());
+        std::unique_lock<std::mutex> lock(mutex);
+        seenConfigs.push_back(Options::getCurrentConfig().getId());
+        sessionThreads.push_back(std::this_thread::get_id());
+        started.notify_all();
+        if (started.wait_for(lock, std::chrono::seconds(5), [&seenConfigs]() { return seenConfigs.size() == 2; }))
+            bothRunning++;
+    });
+
+    BOOST_CHECK(bothRunning == 2);
+    BOOST_REQUIRE(seenConfigs.size() == 2);
+    BOOST_CHECK(seenConfigs.at(0) != seenConfigs.at(1));
+    for (auto const& id : sessionThreads)
+        BOOST_CHECK(RPCSession::sessionStatus(id) == RPCSession::NotExist);
+}
+
+BOOST_AUTO_TEST_CASE(run_mockToolBlock)
+{
+    TempClientConfig const mock(R"({
+        "name" : "Mock t8n",
+        "socketType" : "mock-tool",
+        "socketAddress" : "mock",
+        "forks" : ["London"],
+        "additionalForks" : [],
+        "exceptions" : {}
+    })");
+    Options::DynamicOptions::TaskConfigScope scope(mock.config());
+    SessionInterface& session = RPCSession::instance(std::this_thread::get_id());
+
+    spDataObject envData;
+    (*envData)["currentCoinbase"] = "0x2adc25665018aa1fe0e6bc666dac8fc2697ff9ba";
+    (*envData)["currentDifficulty"] = "0x020000";
+    (*envData)["currentGasLimit"] = "0x0f4240";
+    (*envData)["currentNumber"] = "0x01";
+    (*envData)["currentTimestamp"] = "0x03e8";
+    (*envData)["previousHash"] = "0x5e20a0453cecd065ea59c37ac63e079ee08998b6045136a8ce6635c7912ec0b6";
+    spDataObject preData;
+    (*preData)["0x095e7baea6a6c7c4c2dfeb977efac326af552d87"]["balance"] = "0x0de0b6b3a7640000";
+    (*preData)["0x095e7baea6a6c7c4c2dfeb977efac326af552d87"]["code"] = "0x";
+    (*preData)["0x095e7baea6a6c7c4c2dfeb977efac326af552d87"]["nonce"] = "0x00";
+    (*preData)["0x095e7baea6a6c7c4c2dfeb977efac326af552d87"].atKeyPointer("storage") = sDataObject(DataType::Object);
+    State const pre(dataobject::move(preData));
+    session.test_setChainParams(prepareChainParams(FORK("London"), SealEngine::NoProof, pre, StateTestEnv(envData)));
+
+    spDataObject trData;
+    (*trData)["data"] = "0x";
+    (*trData)["gasLimit"] = "0x061a80";
+    (*trData)["gasPrice"] = "0x0a";
+    (*trData)["nonce"] = "0x00";
+    (*trData)["secretKey"] = "0x45a915e4d060149eb4365960e6a7a45f334393093061116b197e3240065ff2d8";
+    (*trData)["to"] = "0x095e7baea6a6c7c4c2dfeb977efac326af552d87";
+    (*trData)["value"] = "0x01";
+    BYTES const rlp = readTransaction(dataobject::move(trData))->getRawBytes();
+
+    // mockRawTransaction, the sender is recovered from the signature like the block does it
+    TestRawTransaction const raw = session.test_rawTransaction(rlp, FORK("London"));
+    BOOST_CHECK(raw.error().empty());
+    BOOST_CHECK(raw.intrinsicGas() == VALUE(21000));
+
+    // mockTransition
+    session.eth_sendRawTransaction(rlp, VALUE(0));
+    session.test_modifyTimestamp(VALUE(0x03e8));
+    session.test_mineBlocks(1);
+    BOOST_REQUIRE(session.eth_blockNumber() == VALUE(1));
+    spEthGetBlockBy const block = session.eth_getBlockByNumber(VALUE(1), Request::LESSOBJECTS);
+    BOOST_CHECK(block->transactions().size() == 1);
+    BOOST_CHECK(block->header()->gasUsed() == VALUE(21000));
+    BOOST_CHECK(session.eth_getTransactionCount(raw.sender(), VALUE(1))->asBigInt() == 1);
+
+    // The mock roots are trie roots, so checkStateRoot agrees with them
+    BOOST_CHECK(block->header()->transactionRoot() == transactionsRoot({readTransaction(rlp)}));
+    BOOST_CHECK(block->header()->receiptTrie().asString() != "0x56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421");
+
+    // The mock keeps the parent difficulty
+    BOOST_CHECK(session.test_calculateDifficulty(FORK("London"), VALUE(1), VALUE(0), VALUE(0x020000), VALUE(15), VALUE(0))
+                == VALUE(0x020000));
+    RPCSession::clear(true);
+}
+
 #endif
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,7 @@
 #pragma once
+#include <retesteth/configs/ClientConfig.h>
+#include <boost/filesystem/path.hpp>
+#include <memory>
 #include <string>
 
 namespace test::unittests
@@ -7,4 +10,18 @@ namespace test::unittests
     extern std::string const c_sampleStateTestFilled;
     extern std::string const c_sampleBlockchainTestFiller;
     extern std::string const c_sampleBlockchainTestFilled;
+
+    // Client config with the _config file in a temp data dir, removed with the object
+    // The genesis templates are taken from the default config of the retesteth data dir
+    class TempClientConfig
+    {
+    public:
+        TempClientConfig(std::string const& _config);
+        ~TempClientConfig();
+        test::ClientConfig const& config() const { return *m_config; }
+
+    private:
+        boost::filesystem::path m_dataDir;
+        std::unique_ptr<test::ClientConfig> m_config;
+    };
 }